@@ -165,7 +165,8 @@ void setup()
 
 #ifdef ESP32
 #if defined(DIRECT_MODE) && defined(RGB_PANEL)
-  disp_draw_buf = (lv_color_t *)gfx->getFramebuffer();
+  // the buffer changes with every flush() on a double buffered panel, see loop()
+  disp_draw_buf = (lv_color_t *)((Arduino_RGB_Display *)gfx)->getFramebuffer();
 #else  // !DIRECT_MODE
   disp_draw_buf = (lv_color_t *)heap_caps_malloc(bufSize * 2, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
   if (!disp_draw_buf)
@@ -233,6 +234,14 @@ void loop()
 #ifdef DIRECT_MODE
 #ifdef RGB_PANEL
   gfx->flush();
+  // a double buffered panel swapped its buffers, LVGL draws into the new
+  // back buffer, which flush() filled with the frame just shown
+  lv_color_t *fb = (lv_color_t *)((Arduino_RGB_Display *)gfx)->getFramebuffer();
+  if (fb != disp_draw_buf)
+  {
+    disp_draw_buf = fb;
+    lv_disp_draw_buf_init(&draw_buf, disp_draw_buf, NULL, bufSize);
+  }
 #else
   gfx->draw16bitRGBBitmap(0, 0, (uint16_t *)disp_draw_buf, screenWidth, screenHeight);
 #endif
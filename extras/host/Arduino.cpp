@@ -0,0 +1,51 @@
+/*
+ * Minimal Arduino API shim for building Arduino_GFX on a Linux host.
+ */
+#include <Arduino.h>
+#include <SPI.h>
+#include <Wire.h>
+
+#include <sched.h>
+#include <time.h>
+
+SPIClass SPI;
+TwoWire Wire;
+
+static uint64_t host_now_us()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+static const uint64_t host_start_us = host_now_us();
+
+void pinMode(uint8_t, uint8_t) {}
+
+void digitalWrite(uint8_t, uint8_t) {}
+
+int digitalRead(uint8_t)
+{
+  return LOW;
+}
+
+unsigned long millis(void)
+{
+  return (unsigned long)((host_now_us() - host_start_us) / 1000);
+}
+
+unsigned long micros(void)
+{
+  return (unsigned long)(host_now_us() - host_start_us);
+}
+
+// delays are not meaningful off-target, do not let panel init sequences
+// slow down host benchmarks
+void delay(unsigned long) {}
+
+void delayMicroseconds(unsigned int) {}
+
+void yield(void)
+{
+  sched_yield();
+}
@@ -0,0 +1,123 @@
+/*
+ * Simulated data bus for host builds.
+ */
+#include "Arduino_HostBus.h"
+#include "Arduino_GFX_Trace.h"
+
+Arduino_HostBus::Arduino_HostBus()
+    : _clock_hz(0), _busy_until(0)
+{
+  resetCounters();
+}
+
+bool Arduino_HostBus::begin(int32_t speed, int8_t dataMode)
+{
+  _speed = speed;
+  _dataMode = dataMode;
+  return true;
+}
+
+void Arduino_HostBus::beginWrite()
+{
+  ++transactions;
+}
+
+void Arduino_HostBus::endWrite()
+{
+}
+
+void Arduino_HostBus::writeCommand(uint8_t c)
+{
+  ++commands;
+  ++command_bytes;
+  last_command = c;
+}
+
+void Arduino_HostBus::writeCommand16(uint16_t c)
+{
+  ++commands;
+  command_bytes += 2;
+  last_command = c;
+}
+
+void Arduino_HostBus::writeCommandBytes(uint8_t *data, uint32_t len)
+{
+  ++commands;
+  command_bytes += len;
+  last_command = len ? data[0] : 0;
+}
+
+void Arduino_HostBus::write(uint8_t d)
+{
+  _sink = d;
+  ++data_bytes;
+}
+
+void Arduino_HostBus::write16(uint16_t d)
+{
+  _sink = d;
+  data_bytes += 2;
+}
+
+void Arduino_HostBus::writeRepeat(uint16_t p, uint32_t len)
+{
+  _sink = p;
+  data_bytes += (uint64_t)len * 2;
+  simulateTransfer((uint64_t)len * 2);
+}
+
+void Arduino_HostBus::writeBytes(uint8_t *data, uint32_t len)
+{
+  uint8_t x = 0;
+  for (uint32_t i = 0; i < len; ++i)
+  {
+    x ^= data[i];
+  }
+  _sink = x;
+  data_bytes += len;
+  simulateTransfer(len);
+}
+
+void Arduino_HostBus::writePixels(uint16_t *data, uint32_t len)
+{
+  uint16_t x = 0;
+  for (uint32_t i = 0; i < len; ++i)
+  {
+    x ^= data[i];
+  }
+  _sink = x;
+  data_bytes += (uint64_t)len * 2;
+  simulateTransfer((uint64_t)len * 2);
+}
+
+void Arduino_HostBus::resetCounters()
+{
+  transactions = 0;
+  commands = 0;
+  command_bytes = 0;
+  data_bytes = 0;
+  last_command = 0;
+}
+
+void Arduino_HostBus::setSimulatedClock(uint32_t hz)
+{
+  _clock_hz = hz;
+  _busy_until = 0;
+}
+
+void Arduino_HostBus::simulateTransfer(uint64_t bytes)
+{
+#if defined(ARDUINO_GFX_TRACE)
+  if (_clock_hz)
+  {
+    uint32_t now = GFX_TRACE_NOW();
+    uint32_t start = ((int32_t)(_busy_until - now) > 0) ? _busy_until : now;
+    uint32_t duration = (uint32_t)((bytes * 8 * 1000000ULL) / _clock_hz);
+    _busy_until = start + (duration ? duration : 1);
+    gfx_trace_record(GFX_TRACE_BEGIN_PHASE, GFX_TRACE_TRACK_BUS, GFX_TRACE_DMA, 0, start);
+    gfx_trace_record(GFX_TRACE_END_PHASE, GFX_TRACE_TRACK_BUS, GFX_TRACE_DMA, 0, _busy_until);
+  }
+#else
+  (void)bytes;
+#endif
+}
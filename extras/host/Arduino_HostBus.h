@@ -0,0 +1,48 @@
+/*
+ * Simulated data bus for host builds. Nothing is sent anywhere, the bus
+ * only counts what a display driver would put on the wire. With a
+ * simulated clock set and ARDUINO_GFX_TRACE defined, pixel transfers are
+ * also recorded on the tracer's bus track as if they were DMA transfers
+ * queued back to back at that clock.
+ */
+#ifndef _ARDUINO_HOSTBUS_H_
+#define _ARDUINO_HOSTBUS_H_
+
+#include "Arduino_DataBus.h"
+
+class Arduino_HostBus : public Arduino_DataBus
+{
+public:
+  Arduino_HostBus();
+  virtual ~Arduino_HostBus() {}
+
+  bool begin(int32_t speed = GFX_NOT_DEFINED, int8_t dataMode = GFX_NOT_DEFINED) override;
+  void beginWrite() override;
+  void endWrite() override;
+  void writeCommand(uint8_t) override;
+  void writeCommand16(uint16_t) override;
+  void writeCommandBytes(uint8_t *data, uint32_t len) override;
+  void write(uint8_t) override;
+  void write16(uint16_t) override;
+  void writeRepeat(uint16_t p, uint32_t len) override;
+  void writeBytes(uint8_t *data, uint32_t len) override;
+  void writePixels(uint16_t *data, uint32_t len) override;
+
+  void resetCounters();
+  void setSimulatedClock(uint32_t hz);
+
+  uint32_t transactions;   ///< beginWrite() calls
+  uint32_t commands;       ///< command writes
+  uint64_t command_bytes;  ///< bytes sent with D/C low
+  uint64_t data_bytes;     ///< bytes sent with D/C high
+  uint32_t last_command;   ///< most recent command value
+
+protected:
+  void simulateTransfer(uint64_t bytes);
+
+  volatile uint8_t _sink; ///< keeps the compiler from dropping pixel reads
+  uint32_t _clock_hz;     ///< 0 disables transfer simulation
+  uint32_t _busy_until;   ///< simulated end of the last transfer, in micros()
+};
+
+#endif // _ARDUINO_HOSTBUS_H_
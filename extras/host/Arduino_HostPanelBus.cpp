@@ -0,0 +1,244 @@
+/*
+ * Host bus with an emulated DCS panel GRAM.
+ */
+#include "Arduino_HostPanelBus.h"
+
+#define DCS_CASET 0x2A
+#define DCS_PASET 0x2B
+#define DCS_RAMWR 0x2C
+#define DCS_RAMWRC 0x3C
+#define DCS_VSCRDEF 0x33
+#define DCS_MADCTL 0x36
+#define DCS_VSCRSADD 0x37
+#define DCS_COLMOD 0x3A
+
+#define DCS_MADCTL_MY 0x80
+#define DCS_MADCTL_MX 0x40
+#define DCS_MADCTL_MV 0x20
+
+Arduino_HostPanelBus::Arduino_HostPanelBus(int16_t w, int16_t h)
+    : _w(w), _h(h), _cmd(0), _param_len(0), _madctl(0),
+      _xs(0), _xe(0), _ys(0), _ye(0), _col(0), _row(0), _tfa(0), _vsa(h), _vsp(0),
+      _pixel_len(0), _pixel_bytes(2)
+{
+  _gram = (uint16_t *)malloc(w * h * 2);
+  clear(0);
+}
+
+Arduino_HostPanelBus::~Arduino_HostPanelBus()
+{
+  free(_gram);
+}
+
+void Arduino_HostPanelBus::clear(uint16_t color)
+{
+  for (int32_t i = 0; i < (int32_t)_w * _h; ++i)
+  {
+    _gram[i] = color;
+  }
+}
+
+void Arduino_HostPanelBus::writeCommand(uint8_t c)
+{
+  Arduino_HostBus::writeCommand(c);
+  _cmd = c;
+  _param_len = 0;
+  _pixel_len = 0;
+  if (c == DCS_RAMWR)
+  {
+    ++windows;
+    uint16_t mask = _align - 1;
+    if ((_xs & mask) || (_ys & mask) || ((_xe + 1) & mask) || ((_ye + 1) & mask))
+    {
+      ++misaligned_windows;
+      _xs &= ~mask;
+      _ys &= ~mask;
+      _xe |= mask;
+      _ye |= mask;
+    }
+    _col = _xs;
+    _row = _ys;
+  }
+}
+
+void Arduino_HostPanelBus::writeCommand16(uint16_t c)
+{
+  Arduino_HostBus::writeCommand16(c);
+  _cmd = 0;
+}
+
+void Arduino_HostPanelBus::writeCommandBytes(uint8_t *data, uint32_t len)
+{
+  Arduino_HostBus::writeCommandBytes(data, len);
+  _cmd = 0;
+}
+
+void Arduino_HostPanelBus::write(uint8_t d)
+{
+  Arduino_HostBus::write(d);
+  feed(d);
+}
+
+void Arduino_HostPanelBus::write16(uint16_t d)
+{
+  Arduino_HostBus::write16(d);
+  feed(d >> 8);
+  feed(d);
+}
+
+void Arduino_HostPanelBus::writeRepeat(uint16_t p, uint32_t len)
+{
+  Arduino_HostBus::writeRepeat(p, len);
+  while (len--)
+  {
+    feed(p >> 8);
+    feed(p);
+  }
+}
+
+void Arduino_HostPanelBus::writeBytes(uint8_t *data, uint32_t len)
+{
+  Arduino_HostBus::writeBytes(data, len);
+  while (len--)
+  {
+    feed(*data++);
+  }
+}
+
+void Arduino_HostPanelBus::writePixels(uint16_t *data, uint32_t len)
+{
+  Arduino_HostBus::writePixels(data, len);
+  while (len--)
+  {
+    feed(*data >> 8);
+    feed(*data++);
+  }
+}
+
+void Arduino_HostPanelBus::feed(uint8_t d)
+{
+  switch (_cmd)
+  {
+  case DCS_CASET:
+  case DCS_PASET:
+    if (_param_len < 4)
+    {
+      _param[_param_len++] = d;
+      if (_param_len == 4)
+      {
+        uint16_t s = (_param[0] << 8) | _param[1];
+        uint16_t e = (_param[2] << 8) | _param[3];
+        if (_cmd == DCS_CASET)
+        {
+          _xs = s;
+          _xe = e;
+        }
+        else
+        {
+          _ys = s;
+          _ye = e;
+        }
+      }
+    }
+    break;
+  case DCS_MADCTL:
+    _madctl = d;
+    _cmd = 0;
+    break;
+  case DCS_COLMOD:
+    _pixel_bytes = ((d & 0x07) == 0x06) ? 3 : 2;
+    _cmd = 0;
+    break;
+  case DCS_VSCRDEF:
+    _param[_param_len++] = d;
+    if (_param_len == 6)
+    {
+      _tfa = (_param[0] << 8) | _param[1];
+      _vsa = (_param[2] << 8) | _param[3];
+      _cmd = 0;
+    }
+    break;
+  case DCS_VSCRSADD:
+    _param[_param_len++] = d;
+    if (_param_len == 2)
+    {
+      _vsp = (_param[0] << 8) | _param[1];
+      _cmd = 0;
+    }
+    break;
+  case DCS_RAMWR:
+  case DCS_RAMWRC:
+    _pixel[_pixel_len++] = d;
+    if (_pixel_len == _pixel_bytes)
+    {
+      if (_pixel_bytes == 3)
+      {
+        writePixel(((_pixel[0] & 0xF8) << 8) | ((_pixel[1] & 0xFC) << 3) | (_pixel[2] >> 3));
+      }
+      else
+      {
+        writePixel((_pixel[0] << 8) | _pixel[1]);
+      }
+      _pixel_len = 0;
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+// Scan line n of the scroll area shows GRAM row _vsp + n, wrapping within
+// the area; the fixed rows above and below show their own rows.
+void Arduino_HostPanelBus::getScreen(uint16_t *dst)
+{
+  for (int16_t y = 0; y < _h; ++y)
+  {
+    int32_t src = y;
+    if ((y >= _tfa) && (y < (_tfa + _vsa)))
+    {
+      src = _vsp + (y - _tfa);
+      if (src >= (_tfa + _vsa))
+      {
+        src -= _vsa;
+      }
+    }
+    if ((src < 0) || (src >= _h))
+    {
+      src = y;
+    }
+    memcpy(dst + (int32_t)y * _w, _gram + src * _w, _w * 2);
+  }
+}
+
+// Maps the RAMWR cursor to GRAM the way the panel does and advances it,
+// wrapping at the end of the column range and then of the page range.
+void Arduino_HostPanelBus::writePixel(uint16_t color)
+{
+  int16_t a, b;
+  if (_madctl & DCS_MADCTL_MV)
+  {
+    a = _row;
+    b = _col;
+  }
+  else
+  {
+    a = _col;
+    b = _row;
+  }
+  // panel mounting as used by Arduino_ILI9341: MX set is the upright view
+  int16_t x = (_madctl & DCS_MADCTL_MX) ? a : (_w - 1 - a);
+  int16_t y = (_madctl & DCS_MADCTL_MY) ? (_h - 1 - b) : b;
+  if ((x >= 0) && (x < _w) && (y >= 0) && (y < _h))
+  {
+    _gram[(int32_t)y * _w + x] = color;
+  }
+
+  if (_col++ >= _xe)
+  {
+    _col = _xs;
+    if (_row++ >= _ye)
+    {
+      _row = _ys;
+    }
+  }
+}
@@ -0,0 +1,59 @@
+/*
+ * Host bus with a DCS panel behind it. On top of the Arduino_HostBus
+ * counters it decodes CASET, PASET, RAMWR and MADCTL of RGB565 controllers
+ * such as the ILI9341, and of RGB666 ones once COLMOD selects 18 bits per
+ * pixel, into an emulated RGB565 GRAM, so what a driver
+ * actually wrote can be compared pixel by pixel with a canvas. VSCRDEF and
+ * VSCRSADD are kept to scan the GRAM out as a vertically scrolled panel
+ * shows it. With setAddrAlign() it behaves like the AMOLED controllers
+ * whose windows must lie on a grid: a RAMWR window off the grid is counted
+ * and widened to it, so the pixels land where such a panel puts them.
+ */
+#ifndef _ARDUINO_HOSTPANELBUS_H_
+#define _ARDUINO_HOSTPANELBUS_H_
+
+#include "Arduino_HostBus.h"
+
+class Arduino_HostPanelBus : public Arduino_HostBus
+{
+public:
+  Arduino_HostPanelBus(int16_t w, int16_t h);
+  ~Arduino_HostPanelBus() override;
+
+  void writeCommand(uint8_t) override;
+  void writeCommand16(uint16_t) override;
+  void writeCommandBytes(uint8_t *data, uint32_t len) override;
+  void write(uint8_t) override;
+  void write16(uint16_t) override;
+  void writeRepeat(uint16_t p, uint32_t len) override;
+  void writeBytes(uint8_t *data, uint32_t len) override;
+  void writePixels(uint16_t *data, uint32_t len) override;
+
+  void clear(uint16_t color);
+  uint16_t *getGram() { return _gram; } ///< panel native orientation, row major
+  void getScreen(uint16_t *dst);        ///< getGram() as shown, vertical scroll applied
+  void setAddrAlign(uint8_t align) { _align = align; }
+
+  uint32_t windows = 0;            ///< RAMWR commands
+  uint32_t misaligned_windows = 0; ///< of those, windows off the setAddrAlign() grid
+
+protected:
+  void feed(uint8_t d);
+  void writePixel(uint16_t color);
+
+  int16_t _w, _h;
+  uint16_t *_gram;
+  uint8_t _cmd;
+  uint8_t _param[6];
+  uint8_t _param_len;
+  uint8_t _madctl;
+  uint16_t _xs, _xe, _ys, _ye; ///< window in memory access order
+  uint16_t _col, _row;         ///< RAMWR cursor
+  uint16_t _tfa, _vsa, _vsp; ///< vertical scroll area and start
+  uint8_t _align = 1;
+  uint8_t _pixel[3];
+  uint8_t _pixel_len;
+  uint8_t _pixel_bytes; ///< 2 for RGB565, 3 for RGB666
+};
+
+#endif // _ARDUINO_HOSTPANELBUS_H_
@@ -0,0 +1,2630 @@
+/*
+ * Host front end of Arduino_GFX_Benchmark. Display output goes to
+ * Arduino_HostBus, so timings measure the library itself, not a real bus.
+ *
+ * usage: gfx_bench [--json] [--quick] [--rotations=<mask>] [--target=<name>]
+ *                  [--trace=<file>] [--bus-hz=<hz>] [--verify] [--oled]
+ *                  [--bound] [--writeback] [--round] [--lt7680] [--scroll]
+ *                  [--te] [--align]
+ *
+ * Built with ARDUINO_GFX_STATS, the Arduino_GFX_Stats counters of every
+ * target are printed to stderr after its results. Built with
+ * ARDUINO_GFX_TRACE, --trace writes the last events of the run as Chrome
+ * trace JSON, with bus transfers simulated at --bus-hz (default 40 MHz).
+ *
+ * --verify skips the benchmark. It draws the same scene on an ILI9341 whose
+ * bus emulates the panel GRAM and on an Arduino_Canvas, in every rotation,
+ * and flushes it from canvases with hardware rotation. The RGB332 and
+ * packed 4 and 2 bpp canvases draw a scene in colors they store exactly
+ * and are flushed to the panel. Arduino_Canvas_Indexed must flush both
+ * scenes like Arduino_Canvas and keep palette entries set by hand in place
+ * through a mask level raise, Arduino_Canvas_3bit must match Arduino_Canvas
+ * reduced to 3 bits. Arduino_Canvas_Mono draws 58 random scenes
+ * per layout and rotation, also through its generic per pixel writers. An
+ * ILI9488_18bit draws the scene against Arduino_Canvas and a scene of
+ * every bitmap writer against an RGB565 ILI9488, and Arduino_Canvas_24bit
+ * is flushed to it. It exits with 1 if any pixel differs.
+ *
+ * --oled skips the benchmark. It flushes a vertical byte Arduino_Canvas_Mono
+ * to an SSD1306 and an SH1106 on Arduino_Wire and prints the I2C
+ * transmissions and bytes each kind of update costs, as counted by the host
+ * Wire shim. Random drawing in every rotation is then flushed after every
+ * few operations into a shadow GRAM decoded from the I2C bytes, and for
+ * the horizontal byte layout into the emulated GRAM of an ILI9341. It exits
+ * with 1 if a readback differs from the canvas.
+ *
+ * --bound skips the benchmark. It times the per call cost of the Arduino_TFT
+ * hot path (1x1 fills, repeated colors and pixel blocks through an
+ * Arduino_GFX pointer) on an ILI9341 and on an
+ * Arduino_TFT_Bound<Arduino_ILI9341, Arduino_HostBus>. It exits with 1 if
+ * the verify and bitmap scenes, in every rotation, put different bytes on
+ * the wire from the two, as digested by a hashing bus.
+ *
+ * --writeback skips the benchmark. It draws on a 480x480 canvas that tracks
+ * its changes the way Arduino_RGB_Display does with auto_flush and prints
+ * the cache write-back calls, bytes and cache lines per scene, written back
+ * per primitive as before and deferred through Arduino_GFX_WriteBack. It
+ * exits with 1 if a deferred flush left a changed byte out or covered more
+ * cache lines than the per primitive write-back.
+ *
+ * --round skips the benchmark. It flushes a 240x240 Arduino_Canvas to a
+ * GC9A01 whose bus emulates the panel GRAM, square, with the panel in
+ * round mode and with the canvas in round mode, and prints the bus bytes
+ * of each. It exits with 1 if a pixel inside the circle differs from the
+ * canvas, also for the verify scene drawn on the round panel directly.
+ *
+ * --lt7680 skips the benchmark. It runs an LT7680 on a bus that decodes the
+ * register writes and carries out the BTE memory copy, chroma key, pattern
+ * fill and MCU write operations they start on an emulated display RAM.
+ * Surface uploads, blits, sprites, pattern fills and scrolls are checked
+ * against the same operations done on the host, triple buffered page flips
+ * against the main window and canvas addresses, repeated page setups
+ * against the surfaces already allocated, and the bus bytes a sprite
+ * costs are printed next to pushing its pixels. It exits with 1 on any
+ * difference.
+ *
+ * --scroll skips the benchmark. It adds lines to a log between a fixed
+ * header and footer of an ILI9341 and of an ILI9488_18bit whose buses
+ * emulate the panel GRAM and vertical scroll, once scrolled by the panel
+ * and once redrawn, and prints the bus bytes per line of each. The 12 pixel
+ * lines do not divide the scroll areas, so fills, pixel runs, opaque text
+ * and a bitmap of every writer cross the row where the scrolled rows wrap.
+ * It exits with 1 if the scrolled screen ever differs from the redrawn one.
+ *
+ * --te skips the benchmark. It flushes the full screen and a 128 row band
+ * of an ILI9341 in 16 row bands at 80, 40 and 20 MHz against a simulated
+ * 59 Hz panel scan, written straight away, from the next TE edge on and
+ * through Arduino_GFX_TESync, at random times. It prints for each how many
+ * bands the scan overtook, how many flushes showed across two frames and
+ * how long a flush waited to start, and exits with 1 if the scan overtook
+ * a band of a flush Arduino_GFX_TESync had planned.
+ *
+ * --align skips the benchmark. It makes random small changes at odd
+ * coordinates to a 240x536 Arduino_Canvas in every rotation and flushes
+ * only the changed areas to an RM67162 whose bus emulates a panel that
+ * needs even aligned windows. It prints the windows, the ones off the grid
+ * and the bus bytes of these partial flushes, of the same areas sent as
+ * they are and of full flushes. The same runs on an ILI9488_18bit, which
+ * has no grid but converts the pixels to RGB666, and on a GC9A01 in round
+ * mode put on the same grid. It exits with 1 if a partial flush sent a
+ * window off the grid or left the panel differing from the canvas, or if
+ * an ILI9341 on the grid accepts a scroll area.
+ */
+#include <Arduino_GFX_Library.h>
+#include <Arduino_GFX_WriteBack.h>
+#include <display/Arduino_LT7680_Configs.h>
+
+#include "Arduino_HostBus.h"
+#include "Arduino_HostPanelBus.h"
+
+class StdoutPrint : public Print
+{
+public:
+  size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+  size_t write(const uint8_t *buffer, size_t size) override { return fwrite(buffer, 1, size, stdout); }
+};
+
+static uint64_t host_bus_bytes(void *ctx)
+{
+  Arduino_HostBus *bus = (Arduino_HostBus *)ctx;
+  return bus->command_bytes + bus->data_bytes;
+}
+
+class StderrPrint : public Print
+{
+public:
+  size_t write(uint8_t c) override { return fputc(c, stderr) == EOF ? 0 : 1; }
+  size_t write(const uint8_t *buffer, size_t size) override { return fwrite(buffer, 1, size, stderr); }
+};
+
+static void print_stats(const char *target)
+{
+#if defined(ARDUINO_GFX_STATS)
+  StderrPrint err;
+  gfx_stats_t s = Arduino_GFX::getStats(true);
+  fprintf(stderr, "# stats %s\n", target);
+  Arduino_GFX::printStats(&err, &s);
+#else
+  (void)target;
+#endif
+}
+
+class FilePrint : public Print
+{
+public:
+  FilePrint(FILE *f) : _f(f) {}
+  size_t write(uint8_t c) override { return fputc(c, _f) == EOF ? 0 : 1; }
+  size_t write(const uint8_t *buffer, size_t size) override { return fwrite(buffer, 1, size, _f); }
+
+private:
+  FILE *_f;
+};
+
+// per pixel drawing heavy, so runs of writePixel() calls get exercised
+static void draw_verify_scene(Arduino_GFX *gfx)
+{
+  gfx->fillScreen(RGB565_BLACK);
+  gfx->drawPixel(0, 0, RGB565_WHITE);
+  gfx->drawPixel(gfx->width() - 1, gfx->height() - 1, RGB565_WHITE);
+  for (int16_t i = 0; i < 40; ++i)
+  {
+    gfx->drawPixel(10 + i, 5, RGB565_RED + i); // row run
+    gfx->drawPixel(5, 10 + i, RGB565_GREEN + i); // column run
+  }
+  gfx->drawLine(0, 0, gfx->width() - 1, gfx->height() - 1, RGB565_YELLOW);
+  gfx->drawLine(gfx->width() - 1, 3, 7, 60, RGB565_CYAN);
+  gfx->drawLine(20, 200, 21, 20, RGB565_MAGENTA);
+  gfx->drawCircle(60, 80, 50, RGB565_ORANGE);
+  gfx->drawCircle(gfx->width() - 10, 100, 30, RGB565_MAROON); // clipped
+  gfx->drawEllipse(120, 160, 70, 30, RGB565_BLUE);
+  gfx->drawRoundRect(30, 150, 100, 60, 12, RGB565_WHITE);
+  gfx->drawTriangle(10, 300, 200, 230, 150, 310, RGB565_GREENYELLOW);
+  gfx->drawArc(160, 60, 40, 35, 20, 290, RGB565_PURPLE);
+  gfx->setTextColor(RGB565_WHITE);
+  gfx->setTextSize(1);
+  gfx->setCursor(3, 120);
+  gfx->print("Hello, pixel runs!");
+  gfx->setTextSize(2, 3, 0);
+  gfx->setCursor(8, 220);
+  gfx->print("GFX 0123");
+  gfx->setTextColor(RGB565_BLACK, RGB565_LIGHTGREY);
+  gfx->setTextSize(1);
+  gfx->setCursor(100, 20);
+  gfx->print("bg text");
+}
+
+// 24x16 test bitmaps of every format, filled by init_bitmaps()
+static uint8_t bm_1bit[3 * 16];
+static uint8_t bm_gray[24 * 16];
+static uint8_t bm_index[24 * 16];
+static uint16_t bm_palette[256];
+static uint8_t bm_3bit[12 * 16];
+static uint16_t bm_16bit[24 * 16];
+static uint16_t bm_16bit_be[24 * 16];
+static uint8_t bm_24bit[24 * 16 * 3];
+
+static void init_bitmaps()
+{
+  uint32_t seed = 2024;
+  for (uint16_t i = 0; i < 24 * 16; ++i)
+  {
+    seed = (seed * 1103515245) + 12345;
+    uint16_t c = seed >> 12;
+    bm_gray[i] = seed >> 20;
+    bm_index[i] = (i % 7) ? ((seed >> 9) & 0x0F) : 0; // 0 is the chroma key
+    bm_16bit[i] = ((i % 5) == 0) ? RGB565_MAGENTA : c; // magenta is the transparent color
+    bm_16bit_be[i] = (c << 8) | (c >> 8);
+    bm_24bit[i * 3] = seed >> 24;
+    bm_24bit[(i * 3) + 1] = seed >> 16;
+    bm_24bit[(i * 3) + 2] = seed >> 8;
+    if (i < sizeof(bm_1bit))
+    {
+      bm_1bit[i] = seed >> 13;
+    }
+    if (i < sizeof(bm_3bit))
+    {
+      bm_3bit[i] = seed >> 15;
+    }
+  }
+  for (uint16_t i = 0; i < 256; ++i)
+  {
+    bm_palette[i] = (i * 0x1111) ^ 0x5A5A;
+  }
+}
+
+// every bitmap writer, from RAM and through the PROGMEM overloads, with
+// masks, keys and clipping at the edges
+static void draw_bitmap_scene(Arduino_GFX *gfx)
+{
+  const uint8_t *pgm_1bit = bm_1bit, *pgm_gray = bm_gray, *pgm_24bit = bm_24bit;
+  const uint16_t *pgm_16bit = bm_16bit;
+  int16_t w = gfx->width(), h = gfx->height();
+  gfx->fillScreen(RGB565_DARKGREY);
+  gfx->drawBitmap(4, 4, pgm_1bit, 24, 16, RGB565_RED);
+  gfx->drawBitmap(32, 4, bm_1bit, 24, 16, RGB565_GREEN);
+  gfx->drawBitmap(60, 4, pgm_1bit, 24, 16, RGB565_BLUE, RGB565_YELLOW);
+  gfx->drawBitmap(88, 4, bm_1bit, 24, 16, RGB565_CYAN, RGB565_BLACK);
+  gfx->drawXBitmap(116, 4, pgm_1bit, 24, 16, RGB565_WHITE);
+  gfx->drawGrayscaleBitmap(4, 24, pgm_gray, 24, 16);
+  gfx->drawGrayscaleBitmap(32, 24, bm_gray, 24, 16);
+  gfx->drawGrayscaleBitmap(60, 24, pgm_gray, pgm_1bit, 24, 16);
+  gfx->drawGrayscaleBitmap(88, 24, bm_gray, bm_1bit, 24, 16);
+  gfx->drawIndexedBitmap(4, 44, bm_index, bm_palette, 24, 16);
+  gfx->drawIndexedBitmap(32, 44, bm_index, bm_palette, (uint8_t)0, 24, 16);
+  gfx->drawIndexedBitmap(60, 44, bm_index, bm_palette, (int16_t)20, (int16_t)16, (int16_t)4);
+  gfx->draw3bitRGBBitmap(88, 44, bm_3bit, 24, 16);
+  gfx->draw16bitRGBBitmap(4, 64, pgm_16bit, 24, 16);
+  gfx->draw16bitRGBBitmap(32, 64, bm_16bit, 24, 16);
+  gfx->draw16bitRGBBitmapWithMask(60, 64, pgm_16bit, pgm_1bit, 24, 16);
+  gfx->draw16bitRGBBitmapWithMask(88, 64, bm_16bit, bm_1bit, 24, 16);
+  gfx->draw16bitRGBBitmapWithTranColor(116, 64, bm_16bit, RGB565_MAGENTA, 24, 16);
+  gfx->draw16bitBeRGBBitmap(144, 64, bm_16bit_be, 24, 16);
+  gfx->draw24bitRGBBitmap(4, 84, pgm_24bit, 24, 16);
+  gfx->draw24bitRGBBitmap(32, 84, bm_24bit, 24, 16);
+  gfx->draw24bitRGBBitmap(60, 84, pgm_24bit, pgm_1bit, 24, 16);
+  gfx->draw24bitRGBBitmap(88, 84, bm_24bit, bm_1bit, 24, 16);
+  gfx->drawBitmap(w - 10, 110, bm_1bit, 24, 16, RGB565_ORANGE, RGB565_NAVY);
+  gfx->drawGrayscaleBitmap(-7, 110, bm_gray, 24, 16);
+  gfx->drawIndexedBitmap(w - 12, 130, bm_index, bm_palette, 24, 16);
+  gfx->draw16bitRGBBitmap(w - 9, h - 7, bm_16bit, 24, 16);
+  gfx->draw16bitRGBBitmap(-5, h - 11, pgm_16bit, 24, 16);
+  gfx->draw24bitRGBBitmap(-8, 150, bm_24bit, 24, 16);
+  gfx->draw16bitBeRGBBitmap(w - 20, -6, bm_16bit_be, 24, 16);
+}
+
+static int verify_gram(const char *what, uint8_t r, const uint16_t *gram, const uint16_t *fb, int16_t w = 240, int16_t h = 320)
+{
+  uint32_t diff = 0;
+  int32_t first = -1;
+  for (int32_t i = 0; i < (int32_t)w * h; ++i)
+  {
+    if (gram[i] != fb[i])
+    {
+      if (first < 0)
+      {
+        first = i;
+      }
+      ++diff;
+    }
+  }
+  if (diff)
+  {
+    fprintf(stderr, "verify %s %d: %u pixels differ, first at %d,%d\n",
+            what, r, (unsigned)diff, (int)(first % w), (int)(first / w));
+    return 1;
+  }
+  fprintf(stderr, "verify %s %d: ok\n", what, r);
+  return 0;
+}
+
+// colors RGB332 stores exactly, the first 4 or 8 fit a packed palette
+static const uint16_t exact_colors[] = {
+    RGB565_BLACK, RGB565_WHITE, RGB565_RED, RGB565_BLUE,
+    RGB565_GREEN, RGB565_YELLOW, RGB565_CYAN, RGB565_MAGENTA};
+
+// the verify scene's primitives in the first n exact colors, plus lines of
+// negative length and glyphs at every pixel offset within a packed byte
+static void draw_exact_scene(Arduino_GFX *gfx, uint8_t n)
+{
+  const uint16_t *c = exact_colors;
+  gfx->fillScreen(c[0]);
+  for (int16_t i = 0; i < 16; ++i)
+  {
+    // from 40 down to -35 wide, from 25 down to -35 high
+    gfx->drawFastHLine(3 + i, 10 + (i * 3), 40 - (i * 5), c[1 + (i % (n - 1))]);
+    gfx->drawFastVLine(60 + (i * 3), 100 + i, 25 - (i * 4), c[1 + ((i + 1) % (n - 1))]);
+  }
+  gfx->drawFastHLine(-5, 3, gfx->width() + 10, c[1]);
+  gfx->drawFastVLine(gfx->width() - 2, gfx->height() + 4, -20, c[2]);
+  gfx->fillRect(5, 150, 37, 11, c[2]);
+  gfx->fillRect(-7, gfx->height() - 30, 30, 40, c[3]);
+  gfx->drawRect(101, 181, 77, 33, c[n - 1]);
+  gfx->fillCircle(gfx->width() - 20, 40, 30, c[n - 2]);
+  gfx->drawTriangle(10, 230, 120, 200, 70, 239, c[1]);
+  gfx->setTextSize(1);
+  gfx->setTextColor(c[1], c[2]);
+  for (int16_t i = 0; i < 4; ++i)
+  {
+    gfx->setCursor(7 + i, 60 + (i * 9));
+    gfx->print("Ab 9");
+  }
+  gfx->setTextColor(c[3]);
+  gfx->setCursor(33, 62);
+  gfx->print("over");
+  gfx->setCursor(gfx->width() - 9, 100); // clipped by the edge
+  gfx->print("edge");
+  gfx->setTextSize(2);
+  gfx->setTextColor(c[n - 1], c[0]);
+  gfx->setCursor(20, 120);
+  gfx->print("x2");
+}
+
+// Arduino_Canvas_Mono with its block writers bypassed, every primitive
+// reaches the buffer one bit at a time through writePixelPreclipped()
+class MonoReference : public Arduino_Canvas_Mono
+{
+public:
+  MonoReference(int16_t w, int16_t h, bool verticalByte) : Arduino_Canvas_Mono(w, h, nullptr, 0, 0, verticalByte) {}
+
+  // the generic writers skip negative lengths, the block writers extend
+  // left or up
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override
+  {
+    if (h < 0)
+    {
+      y += h + 1;
+      h = -h;
+    }
+    Arduino_GFX::writeFastVLine(x, y, h, color);
+  }
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override
+  {
+    if (w < 0)
+    {
+      x += w + 1;
+      w = -w;
+    }
+    Arduino_GFX::writeFastHLine(x, y, w, color);
+  }
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override
+  {
+    Arduino_GFX::writeFillRectPreclipped(x, y, w, h, color);
+  }
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color) override
+  {
+    Arduino_GFX::drawBitmap(x, y, bitmap, w, h, color);
+  }
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) override
+  {
+    Arduino_GFX::drawBitmap(x, y, bitmap, w, h, color);
+  }
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg) override
+  {
+    Arduino_GFX::drawBitmap(x, y, bitmap, w, h, color, bg);
+  }
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) override
+  {
+    Arduino_GFX::drawBitmap(x, y, bitmap, w, h, color, bg);
+  }
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg) override
+  {
+    Arduino_GFX::drawChar(x, y, c, color, bg);
+  }
+};
+
+// 19x11, rows padded to whole bytes
+static const uint8_t mono_bitmap[] = {
+    0xF0, 0x0F, 0xE0, 0x81, 0x81, 0x20, 0xA5, 0x5A, 0xA0, 0x3C, 0xC3, 0x00,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0xAA, 0xAA, 0xA0,
+    0x18, 0x18, 0x00, 0x7E, 0x7E, 0x60, 0x81, 0x00, 0x20};
+static uint8_t mono_bitmap_ram[sizeof(mono_bitmap)];
+
+static uint32_t mono_seed;
+
+static int16_t mono_rand(int16_t n)
+{
+  mono_seed = (mono_seed * 1103515245) + 12345;
+  return ((mono_seed >> 8) & 0x7FFF) % n;
+}
+
+// one random primitive, positions and lengths reaching 20 pixels past every
+// edge, lengths negative too
+static void mono_op(Arduino_GFX *gfx, const int16_t *v)
+{
+  int16_t x = v[1] - 20, y = v[2] - 20, a = v[3] - 40, b = v[4] - 40;
+  uint16_t color = (v[5] & 1) ? RGB565_WHITE : RGB565_BLACK;
+  uint16_t bg = (v[5] & 2) ? RGB565_WHITE : RGB565_BLACK;
+  switch (v[0])
+  {
+  case 0:
+    gfx->drawPixel(x, y, color);
+    break;
+  case 1:
+    gfx->drawFastHLine(x, y, a, color);
+    break;
+  case 2:
+    gfx->drawFastVLine(x, y, b, color);
+    break;
+  case 3:
+    gfx->fillRect(x, y, a, b, color);
+    break;
+  case 4:
+    gfx->drawRect(x, y, (a < 0) ? -a : a, (b < 0) ? -b : b, color);
+    break;
+  case 5:
+    gfx->drawBitmap(x, y, mono_bitmap, 19, 11, color);
+    break;
+  case 6:
+    gfx->drawBitmap(x, y, mono_bitmap, 19, 11, color, bg);
+    break;
+  case 7:
+    gfx->drawBitmap(x, y, mono_bitmap_ram, 19, 11, color);
+    break;
+  case 8:
+    gfx->drawBitmap(x, y, mono_bitmap_ram, 19, 11, color, bg);
+    break;
+  case 9:
+    gfx->setTextColor(color, bg); // transparent if they match
+    // the generic glyph writer clips only at the right and bottom edges
+    gfx->setCursor((x < 0) ? -x : x, (y < 0) ? -y : y);
+    gfx->print("Az 09");
+    break;
+  case 10:
+    gfx->drawLine(x, y, x + a, y + b, color);
+    break;
+  default:
+    gfx->fillCircle(x, y, v[4] % 20, color);
+  }
+}
+
+// random scenes on Arduino_Canvas_Mono and on MonoReference must leave the
+// same bytes, in both layouts and every rotation
+static int verify_mono()
+{
+  static const char *layouts[] = {"horizontal", "vertical"};
+  const uint16_t scenes = 58;
+  memcpy(mono_bitmap_ram, mono_bitmap, sizeof(mono_bitmap));
+  int failed = 0;
+  for (uint8_t l = 0; l < 2; ++l)
+  {
+    Arduino_Canvas_Mono *mono = new Arduino_Canvas_Mono(128, 64, nullptr, 0, 0, l == 1);
+    mono->begin(GFX_SKIP_OUTPUT_BEGIN);
+    MonoReference *ref = new MonoReference(128, 64, l == 1);
+    ref->begin(GFX_SKIP_OUTPUT_BEGIN);
+    uint8_t *fb = mono->getFramebuffer();
+    uint8_t *ref_fb = ref->getFramebuffer();
+    for (uint8_t r = 0; r < 4; ++r)
+    {
+      mono->setRotation(r);
+      ref->setRotation(r);
+      mono_seed = 777 + r;
+      uint16_t diff = 0;
+      for (uint16_t s = 0; s < scenes; ++s)
+      {
+        mono->fillScreen((s & 1) ? RGB565_WHITE : RGB565_BLACK);
+        ref->fillScreen((s & 1) ? RGB565_WHITE : RGB565_BLACK);
+        mono->setTextSize(1);
+        ref->setTextSize(1);
+        for (uint8_t n = 0; n < 40; ++n)
+        {
+          int16_t v[6] = {mono_rand(12), mono_rand(mono->width() + 40), mono_rand(mono->height() + 40),
+                          mono_rand(81), mono_rand(81), mono_rand(4)};
+          mono_op(mono, v);
+          mono_op(ref, v);
+        }
+        if (memcmp(fb, ref_fb, 128 * 64 / 8))
+        {
+          ++diff;
+        }
+      }
+      if (diff)
+      {
+        fprintf(stderr, "verify Mono %s %d: %u of %u scenes differ\n", layouts[l], r, diff, scenes);
+        failed = 1;
+      }
+      else
+      {
+        fprintf(stderr, "verify Mono %s %d: ok\n", layouts[l], r);
+      }
+    }
+    delete ref;
+    delete mono;
+  }
+  return failed;
+}
+
+// Arduino_TFT_18bit stages its RGB666 conversion: every pixel path of an
+// ILI9488_18bit against Arduino_Canvas, and the bitmap writers against the
+// RGB565 ones of an ILI9488, as is Arduino_Canvas_24bit flushed to it
+static int verify_18bit()
+{
+  Arduino_HostPanelBus *panel_bus = new Arduino_HostPanelBus(320, 480);
+  Arduino_ILI9488_18bit *panel = new Arduino_ILI9488_18bit(panel_bus);
+  panel->begin();
+  Arduino_HostPanelBus *ref_bus = new Arduino_HostPanelBus(320, 480);
+  Arduino_ILI9488 *ref = new Arduino_ILI9488(ref_bus);
+  ref->begin();
+  Arduino_Canvas *canvas = new Arduino_Canvas(320, 480, panel);
+  canvas->begin(GFX_SKIP_OUTPUT_BEGIN);
+  uint16_t *gram = panel_bus->getGram();
+  uint16_t *ref_gram = ref_bus->getGram();
+  uint16_t *fb = canvas->getFramebuffer();
+
+  int failed = 0;
+  for (uint8_t r = 0; r < 4; ++r)
+  {
+    panel->setRotation(r);
+    canvas->setRotation(r);
+    panel_bus->clear(RGB565_BLACK);
+    draw_verify_scene(panel);
+    draw_verify_scene(canvas);
+    failed |= verify_gram("ILI9488_18bit", r, gram, fb, 320, 480);
+    ref->setRotation(r);
+    panel_bus->clear(RGB565_BLACK);
+    ref_bus->clear(RGB565_BLACK);
+    draw_bitmap_scene(panel);
+    draw_bitmap_scene(ref);
+    failed |= verify_gram("ILI9488_18bit bitmaps", r, gram, ref_gram, 320, 480);
+  }
+
+  // writeIndexedPixelsDouble() sends every index twice
+  panel->setRotation(0);
+  canvas->setRotation(0);
+  panel_bus->clear(RGB565_BLACK);
+  canvas->fillScreen(RGB565_BLACK);
+  panel->startWrite();
+  panel->writeAddrWindow(3, 5, 48, 16);
+  panel->writeIndexedPixelsDouble(bm_index, bm_palette, 24 * 16);
+  panel->endWrite();
+  for (int16_t i = 0; i < 24 * 16; ++i)
+  {
+    canvas->drawFastHLine(3 + ((i % 24) * 2), 5 + (i / 24), 2, bm_palette[bm_index[i]]);
+  }
+  failed |= verify_gram("ILI9488_18bit indexed double", 0, gram, fb, 320, 480);
+
+  Arduino_Canvas_24bit *canvas24 = new Arduino_Canvas_24bit(320, 480, panel);
+  canvas24->begin(GFX_SKIP_OUTPUT_BEGIN);
+  for (uint8_t r = 0; r < 4; ++r)
+  {
+    canvas24->setRotation(r);
+    canvas->setRotation(r);
+    draw_verify_scene(canvas24);
+    draw_verify_scene(canvas);
+    panel_bus->clear(RGB565_BLACK);
+    canvas24->flush();
+    failed |= verify_gram("Canvas_24bit", r, gram, fb, 320, 480);
+    ref->setRotation(r);
+    ref_bus->clear(RGB565_BLACK);
+    draw_bitmap_scene(canvas24);
+    draw_bitmap_scene(ref);
+    panel_bus->clear(RGB565_BLACK);
+    canvas24->flush();
+    failed |= verify_gram("Canvas_24bit bitmaps", r, gram, ref_gram, 320, 480);
+  }
+  delete canvas24;
+
+  delete canvas;
+  delete ref;
+  delete ref_bus;
+  delete panel;
+  delete panel_bus;
+  return failed;
+}
+
+// Palette entries set by hand on Arduino_Canvas_Indexed above colors added
+// by drawing must keep their index after more colors than the palette
+// holds have raised the mask level, so a palette rotation moves the colors
+// that were set, and colors set after the raise must be matched by drawing
+// them.
+static int verify_indexed_palette()
+{
+  Arduino_HostPanelBus *panel_bus = new Arduino_HostPanelBus(240, 320);
+  Arduino_ILI9341 *panel = new Arduino_ILI9341(panel_bus);
+  panel->begin();
+  Arduino_Canvas_Indexed *canvas = new Arduino_Canvas_Indexed(240, 320, panel);
+  canvas->begin(GFX_SKIP_OUTPUT_BEGIN);
+  uint8_t *fb = canvas->getFramebuffer();
+  uint16_t *palette = canvas->getColorIndex();
+
+  static const uint16_t hand[4] = {0x1234, 0x5678, 0x9ABC, 0xDEF0};
+  static const uint16_t hand2[4] = {0x1235, 0x5679, 0x9ABD, 0xDEF3}; // off both raised masks
+  for (int32_t c = 0; c < 100; ++c)
+  {
+    canvas->drawPixel(c, 40, (uint16_t)(c * 0x9E37));
+  }
+  canvas->setPalette(hand, 200, 4);
+  for (int16_t i = 0; i < 4; ++i)
+  {
+    canvas->fillRect(i * 10, 0, 10, 10, hand[i]);
+  }
+  // more distinct colors than the palette holds, raising the mask once
+  for (int32_t c = 100; c < 260; ++c)
+  {
+    canvas->drawPixel(c % 240, 40 + (c / 240), (uint16_t)(c * 0x9E37));
+  }
+  for (int16_t i = 0; i < 4; ++i)
+  {
+    canvas->fillRect(i * 10, 10, 10, 10, hand[i]);
+  }
+  canvas->setPalette(hand2, 200, 4);
+  for (int16_t i = 0; i < 4; ++i)
+  {
+    canvas->fillRect(i * 10, 20, 10, 10, hand2[i]);
+  }
+
+  uint32_t diff = 0;
+  uint16_t before[4];
+  for (int16_t i = 0; i < 4; ++i)
+  {
+    before[i] = palette[200 + i];
+    diff += (palette[200 + i] == hand2[i]);                  // masked when set
+    diff += ((palette[200 + i] & ~hand2[i]) != 0);
+    diff += (fb[i * 10] != (200 + i));                       // drawn before the raise
+    diff += (fb[(10 * 240) + (i * 10)] != (200 + i));        // and after it
+    diff += (fb[(20 * 240) + (i * 10)] != (200 + i));        // set after it
+  }
+  canvas->rotatePalette(200, 203);
+  panel_bus->clear(RGB565_BLACK);
+  canvas->flush();
+  const uint16_t *gram = panel_bus->getGram();
+  for (int16_t i = 0; i < 4; ++i)
+  {
+    diff += (gram[i * 10] != before[(i + 3) & 3]);
+  }
+
+  int failed = 0;
+  if (diff)
+  {
+    fprintf(stderr, "verify Indexed palette: %u checks failed\n", (unsigned)diff);
+    failed = 1;
+  }
+  else
+  {
+    fprintf(stderr, "verify Indexed palette: ok\n");
+  }
+  delete canvas;
+  delete panel;
+  delete panel_bus;
+  return failed;
+}
+
+static int verify()
+{
+  Arduino_HostPanelBus *panel_bus = new Arduino_HostPanelBus(240, 320);
+  Arduino_ILI9341 *panel = new Arduino_ILI9341(panel_bus);
+  panel->begin();
+  Arduino_Canvas *canvas = new Arduino_Canvas(240, 320, panel);
+  canvas->begin(GFX_SKIP_OUTPUT_BEGIN);
+  uint16_t *gram = panel_bus->getGram();
+  uint16_t *fb = canvas->getFramebuffer();
+
+  int failed = 0;
+  for (uint8_t r = 0; r < 4; ++r)
+  {
+    panel_bus->clear(RGB565_BLACK);
+    panel->setRotation(r);
+    draw_verify_scene(panel);
+    canvas->setRotation(r);
+    draw_verify_scene(canvas);
+    failed |= verify_gram("rotation", r, gram, fb);
+  }
+
+  // a canvas in screen order that has the panel rotate at flush time, with
+  // the panel itself in rotation 0 and 1
+  Arduino_Canvas *rotated = new Arduino_Canvas(240, 320, panel);
+  rotated->begin(GFX_SKIP_OUTPUT_BEGIN);
+  rotated->setHardwareRotation(panel);
+  for (uint8_t r = 0; r < 4; ++r)
+  {
+    panel->setRotation(0);
+    panel_bus->clear(RGB565_BLACK);
+    rotated->setRotation(r);
+    draw_verify_scene(rotated);
+    rotated->flush();
+    canvas->setRotation(r);
+    draw_verify_scene(canvas);
+    failed |= verify_gram("hardware rotation", r, gram, fb);
+    if (panel->getRotation() != 0)
+    {
+      fprintf(stderr, "verify hardware rotation %d: panel left in rotation %d\n", r, panel->getRotation());
+      failed = 1;
+    }
+  }
+  delete rotated;
+
+  // a 320x200 canvas 16 pixels down on the panel in rotation 1, software
+  // rotated as the reference
+  Arduino_Canvas *landscape = new Arduino_Canvas(320, 200, panel, 0, 16);
+  landscape->begin(GFX_SKIP_OUTPUT_BEGIN);
+  Arduino_Canvas *landscape_hw = new Arduino_Canvas(320, 200, panel, 0, 16);
+  landscape_hw->begin(GFX_SKIP_OUTPUT_BEGIN);
+  landscape_hw->setHardwareRotation(panel);
+  for (uint8_t r = 0; r < 4; ++r)
+  {
+    panel->setRotation(1);
+    landscape->setRotation(r);
+    draw_verify_scene(landscape);
+    panel_bus->clear(RGB565_BLACK);
+    landscape->flush();
+    memcpy(fb, gram, 240 * 320 * 2);
+    landscape_hw->setRotation(r);
+    draw_verify_scene(landscape_hw);
+    panel_bus->clear(RGB565_BLACK);
+    landscape_hw->flush();
+    failed |= verify_gram("hardware rotation on rotation 1", r, gram, fb);
+  }
+  delete landscape_hw;
+  delete landscape;
+
+  // the low bit depth canvases in colors they store exactly, flushed to the
+  // panel in rotation 0
+  Arduino_Canvas_RGB332 *rgb332 = new Arduino_Canvas_RGB332(240, 320, panel);
+  rgb332->begin(GFX_SKIP_OUTPUT_BEGIN);
+  Arduino_Canvas_Packed *packed4 = new Arduino_Canvas_Packed(240, 320, panel, 0, 0, 0, 4);
+  packed4->begin(GFX_SKIP_OUTPUT_BEGIN);
+  Arduino_Canvas_Packed *packed2 = new Arduino_Canvas_Packed(240, 320, panel, 0, 0, 0, 2);
+  packed2->begin(GFX_SKIP_OUTPUT_BEGIN);
+  panel->setRotation(0);
+  for (uint8_t r = 0; r < 4; ++r)
+  {
+    canvas->setRotation(r);
+    draw_exact_scene(canvas, 8);
+    rgb332->setRotation(r);
+    draw_exact_scene(rgb332, 8);
+    panel_bus->clear(RGB565_BLACK);
+    rgb332->flush();
+    failed |= verify_gram("RGB332", r, gram, fb);
+    packed4->setRotation(r);
+    draw_exact_scene(packed4, 8);
+    panel_bus->clear(RGB565_BLACK);
+    packed4->flush();
+    failed |= verify_gram("Packed 4bpp", r, gram, fb);
+
+    draw_exact_scene(canvas, 4);
+    packed2->setRotation(r);
+    draw_exact_scene(packed2, 4);
+    panel_bus->clear(RGB565_BLACK);
+    packed2->flush();
+    failed |= verify_gram("Packed 2bpp", r, gram, fb);
+  }
+  delete packed2;
+  delete packed4;
+  delete rgb332;
+
+  // the other canvases on the shared rasterizer core: the indexed one with
+  // a palette that holds every color, the 3-bit one against the canvas
+  // reduced to 3 bits as draw3bitRGBBitmap() expands them
+  Arduino_Canvas_Indexed *indexed = new Arduino_Canvas_Indexed(240, 320, panel);
+  indexed->begin(GFX_SKIP_OUTPUT_BEGIN);
+  Arduino_Canvas_3bit *rgb3 = new Arduino_Canvas_3bit(240, 320, panel);
+  rgb3->begin(GFX_SKIP_OUTPUT_BEGIN);
+  uint16_t *reduced = (uint16_t *)malloc(240 * 320 * 2);
+  for (uint8_t r = 0; r < 4; ++r)
+  {
+    for (uint8_t s = 0; s < 2; ++s)
+    {
+      const char *what[2][2] = {{"Indexed", "3bit"}, {"Indexed exact colors", "3bit exact colors"}};
+      canvas->setRotation(r);
+      indexed->setRotation(r);
+      rgb3->setRotation(r);
+      if (s)
+      {
+        draw_exact_scene(canvas, 8);
+        draw_exact_scene(indexed, 8);
+        draw_exact_scene(rgb3, 8);
+      }
+      else
+      {
+        draw_verify_scene(canvas);
+        draw_verify_scene(indexed);
+        draw_verify_scene(rgb3);
+      }
+      panel_bus->clear(RGB565_BLACK);
+      indexed->flush();
+      failed |= verify_gram(what[s][0], r, gram, fb);
+
+      for (int32_t i = 0; i < 240 * 320; ++i)
+      {
+        uint8_t v = RGB565_TO_RGB3(fb[i]);
+        reduced[i] = ((v & 0b100) ? RGB565_RED : 0) | ((v & 0b010) ? RGB565_GREEN : 0) | ((v & 0b001) ? RGB565_BLUE : 0);
+      }
+      panel_bus->clear(RGB565_BLACK);
+      rgb3->flush();
+      failed |= verify_gram(what[s][1], r, gram, reduced);
+    }
+  }
+  free(reduced);
+  delete rgb3;
+  delete indexed;
+
+  delete canvas;
+  delete panel;
+  delete panel_bus;
+
+  failed |= verify_mono();
+  failed |= verify_indexed_palette();
+  init_bitmaps();
+  failed |= verify_18bit();
+  return failed;
+}
+
+static void oled_update(const char *display, const char *update, Arduino_Canvas_Mono *canvas)
+{
+  uint32_t t = Wire.transmissions;
+  uint32_t b = Wire.bytes_written;
+  canvas->flush();
+  printf("%s,%s,%u,%u\n", display, update,
+         (unsigned)(Wire.transmissions - t), (unsigned)(Wire.bytes_written - b));
+}
+
+static void oled_updates(const char *display, Arduino_G *oled)
+{
+  Arduino_Canvas_Mono *canvas = new Arduino_Canvas_Mono(128, 64, oled, 0, 0, true);
+  canvas->begin();
+  canvas->fillScreen(RGB565_BLACK);
+  canvas->setTextColor(RGB565_WHITE, RGB565_BLACK);
+  canvas->setCursor(0, 0);
+  canvas->print("12:34:56");
+  oled_update(display, "full", canvas);
+
+  oled_update(display, "none", canvas);
+
+  canvas->setCursor(42, 0);
+  canvas->print('7');
+  oled_update(display, "digit", canvas);
+
+  canvas->setCursor(20, 28);
+  canvas->print("status ok");
+  oled_update(display, "text_line", canvas);
+
+  canvas->drawFastHLine(0, 60, 128, RGB565_WHITE);
+  canvas->drawPixel(0, 0, RGB565_WHITE);
+  oled_update(display, "two_pages", canvas);
+
+  canvas->fillScreen(RGB565_WHITE);
+  oled_update(display, "fill_screen", canvas);
+
+  delete canvas;
+}
+
+// Page GRAM of an SSD1306 or SH1106, fed by the Wire shim. A transmission
+// starts with its control byte, 0x00 for commands and 0x40 for data. The
+// SSD1306 is run in horizontal addressing mode, so data fills the
+// PAGEADDR/COLUMNADDR window and wraps to its next page; the SH1106 writes
+// along the page from the column set.
+class OledShadow
+{
+public:
+  OledShadow(bool sh1106) : _sh1106(sh1106) { memset(gram, 0, sizeof(gram)); }
+
+  static void receive(void *ctx, uint8_t d, bool first) { ((OledShadow *)ctx)->feed(d, first); }
+
+  uint8_t gram[8][132];
+
+protected:
+  // parameter bytes that follow a command
+  uint8_t params(uint8_t c)
+  {
+    switch (c)
+    {
+    case 0x20:
+      return _sh1106 ? 0 : 1;
+    case 0x21:
+    case 0x22:
+    case 0xA3:
+      return _sh1106 ? 0 : 2;
+    case 0x26:
+    case 0x27:
+      return _sh1106 ? 0 : 6;
+    case 0x29:
+    case 0x2A:
+      return _sh1106 ? 0 : 5;
+    case 0x81:
+    case 0x8D:
+    case 0xA8:
+    case 0xAD:
+    case 0xD3:
+    case 0xD5:
+    case 0xD9:
+    case 0xDA:
+    case 0xDB:
+      return 1;
+    }
+    return 0;
+  }
+
+  void feed(uint8_t d, bool first)
+  {
+    if (first)
+    {
+      _data = (d == 0x40);
+      _need = 0;
+      return;
+    }
+    if (_data)
+    {
+      if ((_page < 8) && (_col < 132))
+      {
+        gram[_page][_col] = d;
+      }
+      ++_col;
+      if (!_sh1106 && (_col > _col_end))
+      {
+        _col = _col_start;
+        _page = (_page >= _page_end) ? _page_start : (_page + 1);
+      }
+      return;
+    }
+    if (_need)
+    {
+      _param[_param_len++] = d;
+      if (--_need == 0)
+      {
+        if (_cmd == 0x21)
+        {
+          _col = _col_start = _param[0];
+          _col_end = _param[1];
+        }
+        else if (_cmd == 0x22)
+        {
+          _page = _page_start = _param[0];
+          _page_end = _param[1];
+        }
+      }
+      return;
+    }
+    _cmd = d;
+    _param_len = 0;
+    _need = params(d);
+    if (_sh1106 && ((d & 0xF8) == 0xB0))
+    {
+      _page = d & 0x07;
+    }
+    else if (_sh1106 && (d < 0x10))
+    {
+      _col = (_col & 0xF0) | d;
+    }
+    else if (_sh1106 && (d < 0x20))
+    {
+      _col = (_col & 0x0F) | ((d & 0x0F) << 4);
+    }
+  }
+
+  bool _sh1106;
+  bool _data = false;
+  uint8_t _cmd = 0;
+  uint8_t _param[6];
+  uint8_t _param_len = 0;
+  uint8_t _need = 0;
+  uint8_t _page = 0, _page_start = 0, _page_end = 7;
+  uint8_t _col = 0, _col_start = 0, _col_end = 127;
+};
+
+// Random drawing on a vertical byte canvas, flushed after every 5
+// operations, must read back from the shadow GRAM at column offset col.
+static int oled_shadow(const char *display, Arduino_G *oled, bool sh1106, uint8_t col)
+{
+  Arduino_Canvas_Mono *canvas = new Arduino_Canvas_Mono(128, 64, oled, 0, 0, true);
+  canvas->begin();
+  OledShadow *shadow = new OledShadow(sh1106);
+  Wire.receiver = OledShadow::receive;
+  Wire.receiver_ctx = shadow;
+  const uint8_t *fb = canvas->getFramebuffer();
+  memcpy(mono_bitmap_ram, mono_bitmap, sizeof(mono_bitmap));
+
+  int failed = 0;
+  for (uint8_t r = 0; r < 4; ++r)
+  {
+    canvas->setRotation(r);
+    canvas->setTextSize(1);
+    mono_seed = 555 + r;
+    uint32_t diff = 0;
+    for (uint16_t n = 0; (n < 400) && !diff; ++n)
+    {
+      int16_t v[6] = {mono_rand(12), mono_rand(canvas->width() + 40), mono_rand(canvas->height() + 40),
+                      mono_rand(81), mono_rand(81), mono_rand(4)};
+      mono_op(canvas, v);
+      if ((n % 5) == 4)
+      {
+        canvas->flush();
+        for (uint8_t p = 0; p < 8; ++p)
+        {
+          for (uint8_t x = 0; x < 128; ++x)
+          {
+            diff += (shadow->gram[p][col + x] != fb[(p * 128) + x]);
+          }
+        }
+      }
+    }
+    if (diff)
+    {
+      fprintf(stderr, "oled %s %d: %u bytes read back differ\n", display, r, (unsigned)diff);
+      failed = 1;
+    }
+    else
+    {
+      fprintf(stderr, "oled %s %d: ok\n", display, r);
+    }
+  }
+
+  Wire.receiver = nullptr;
+  delete shadow;
+  delete canvas;
+  return failed;
+}
+
+// The horizontal byte layout flushes changed rows as a bitmap, here to an
+// ILI9341 whose bus emulates the panel GRAM.
+static int oled_horizontal()
+{
+  Arduino_HostPanelBus *panel_bus = new Arduino_HostPanelBus(240, 320);
+  Arduino_ILI9341 *panel = new Arduino_ILI9341(panel_bus);
+  panel->begin();
+  panel_bus->clear(RGB565_BLUE);
+  Arduino_Canvas_Mono *canvas = new Arduino_Canvas_Mono(128, 64, panel, 0, 0, false);
+  canvas->begin(GFX_SKIP_OUTPUT_BEGIN);
+  const uint8_t *fb = canvas->getFramebuffer();
+  const uint16_t *gram = panel_bus->getGram();
+  memcpy(mono_bitmap_ram, mono_bitmap, sizeof(mono_bitmap));
+
+  int failed = 0;
+  for (uint8_t r = 0; r < 4; ++r)
+  {
+    canvas->setRotation(r);
+    canvas->setTextSize(1);
+    mono_seed = 666 + r;
+    uint32_t diff = 0;
+    for (uint16_t n = 0; (n < 400) && !diff; ++n)
+    {
+      int16_t v[6] = {mono_rand(12), mono_rand(canvas->width() + 40), mono_rand(canvas->height() + 40),
+                      mono_rand(81), mono_rand(81), mono_rand(4)};
+      mono_op(canvas, v);
+      if ((n % 5) == 4)
+      {
+        canvas->flush();
+        for (int16_t y = 0; y < 64; ++y)
+        {
+          for (int16_t x = 0; x < 128; ++x)
+          {
+            bool on = fb[(y * 16) + (x >> 3)] & (0x80 >> (x & 7));
+            diff += (gram[(y * 240) + x] != (on ? RGB565_WHITE : RGB565_BLACK));
+          }
+        }
+      }
+    }
+    if (diff)
+    {
+      fprintf(stderr, "oled horizontal %d: %u pixels read back differ\n", r, (unsigned)diff);
+      failed = 1;
+    }
+    else
+    {
+      fprintf(stderr, "oled horizontal %d: ok\n", r);
+    }
+  }
+
+  delete canvas;
+  delete panel;
+  delete panel_bus;
+  return failed;
+}
+
+static int oled()
+{
+  printf("display,update,i2c_transmissions,i2c_bytes\n");
+  // the OLED drivers and Arduino_Wire have no virtual destructor, keep
+  // them on the stack instead of deleting them
+  Arduino_Wire ssd1306_bus(0x3C, 0x00, 0x40, &Wire);
+  Arduino_SSD1306 ssd1306(&ssd1306_bus);
+  oled_updates("SSD1306", &ssd1306);
+  int failed = oled_shadow("SSD1306", &ssd1306, false, 0);
+
+  Arduino_Wire sh1106_bus(0x3C, 0x00, 0x40, &Wire);
+  Arduino_SH1106 sh1106(&sh1106_bus);
+  oled_updates("SH1106", &sh1106);
+  failed |= oled_shadow("SH1106", &sh1106, true, 2);
+
+  failed |= oled_horizontal();
+  return failed;
+}
+
+// Folds every byte a driver puts on the wire, with its D/C level, into an
+// FNV-1a digest, so two drivers can be compared byte for byte
+class HashingBus : public Arduino_HostBus
+{
+public:
+  void writeCommand(uint8_t c) override
+  {
+    Arduino_HostBus::writeCommand(c);
+    hash(c, false);
+  }
+  void writeCommand16(uint16_t c) override
+  {
+    Arduino_HostBus::writeCommand16(c);
+    hash(c >> 8, false);
+    hash(c, false);
+  }
+  void writeCommandBytes(uint8_t *data, uint32_t len) override
+  {
+    Arduino_HostBus::writeCommandBytes(data, len);
+    while (len--)
+    {
+      hash(*data++, false);
+    }
+  }
+  void write(uint8_t d) override
+  {
+    Arduino_HostBus::write(d);
+    hash(d, true);
+  }
+  void write16(uint16_t d) override
+  {
+    Arduino_HostBus::write16(d);
+    hash(d >> 8, true);
+    hash(d, true);
+  }
+  void writeRepeat(uint16_t p, uint32_t len) override
+  {
+    Arduino_HostBus::writeRepeat(p, len);
+    while (len--)
+    {
+      hash(p >> 8, true);
+      hash(p, true);
+    }
+  }
+  void writeBytes(uint8_t *data, uint32_t len) override
+  {
+    Arduino_HostBus::writeBytes(data, len);
+    while (len--)
+    {
+      hash(*data++, true);
+    }
+  }
+  void writePixels(uint16_t *data, uint32_t len) override
+  {
+    Arduino_HostBus::writePixels(data, len);
+    while (len--)
+    {
+      hash(*data >> 8, true);
+      hash(*data++, true);
+    }
+  }
+
+  uint32_t digest = 2166136261u;
+
+protected:
+  void hash(uint8_t d, bool dc)
+  {
+    digest = (digest ^ (d | (dc ? 0x100 : 0))) * 16777619u;
+  }
+};
+
+// the verify and bitmap scenes must put the same bytes on the wire from a
+// plain and from a bound ILI9341, in every rotation
+static int bound_digest()
+{
+  HashingBus *plain_bus = new HashingBus();
+  Arduino_ILI9341 *plain = new Arduino_ILI9341(plain_bus);
+  plain->begin();
+  HashingBus *bound_bus = new HashingBus();
+  Arduino_TFT_Bound<Arduino_ILI9341, HashingBus> *bound =
+      new Arduino_TFT_Bound<Arduino_ILI9341, HashingBus>(bound_bus);
+  bound->begin();
+  init_bitmaps();
+
+  int failed = 0;
+  for (uint8_t r = 0; r < 4; ++r)
+  {
+    plain->setRotation(r);
+    draw_verify_scene(plain);
+    draw_bitmap_scene(plain);
+    bound->setRotation(r);
+    draw_verify_scene(bound);
+    draw_bitmap_scene(bound);
+    if ((plain_bus->digest != bound_bus->digest) || (plain_bus->data_bytes != bound_bus->data_bytes))
+    {
+      fprintf(stderr, "bound digest %d: %08x over %llu data bytes, plain %08x over %llu\n", r,
+              (unsigned)bound_bus->digest, (unsigned long long)bound_bus->data_bytes,
+              (unsigned)plain_bus->digest, (unsigned long long)plain_bus->data_bytes);
+      failed = 1;
+    }
+    else
+    {
+      fprintf(stderr, "bound digest %d: ok\n", r);
+    }
+  }
+
+  delete bound;
+  delete bound_bus;
+  delete plain;
+  delete plain_bus;
+  return failed;
+}
+
+static double bound_ns_per_call(Arduino_TFT *tft, uint8_t op)
+{
+  static uint16_t pixels[16];
+  const uint32_t calls = 1000000;
+  tft->startWrite();
+  uint32_t start = micros();
+  for (uint32_t i = 0; i < calls; ++i)
+  {
+    switch (op)
+    {
+    case 0:
+      tft->writeFillRectPreclipped(i & 127, (i >> 7) & 127, 1, 1, i);
+      break;
+    case 1:
+      tft->writeRepeat(i, 4);
+      break;
+    default:
+      tft->writePixels(pixels, 16);
+    }
+  }
+  uint32_t elapsed = micros() - start;
+  tft->endWrite();
+  return elapsed * 1000.0 / calls;
+}
+
+static int bound()
+{
+  static const char *ops[] = {"fill_1x1", "repeat_4", "pixels_16"};
+  Arduino_HostBus *host_bus = new Arduino_HostBus();
+  Arduino_ILI9341 *ili9341 = new Arduino_ILI9341(host_bus);
+  ili9341->begin();
+  Arduino_TFT_Bound<Arduino_ILI9341, Arduino_HostBus> *bound =
+      new Arduino_TFT_Bound<Arduino_ILI9341, Arduino_HostBus>(host_bus);
+  bound->begin();
+
+  printf("op,virtual_ns_per_call,bound_ns_per_call\n");
+  for (uint8_t op = 0; op < 3; ++op)
+  {
+    // best of 3, alternating, to keep frequency scaling out of the ratio
+    double v = 1e9, b = 1e9, t;
+    for (uint8_t r = 0; r < 3; ++r)
+    {
+      t = bound_ns_per_call(ili9341, op);
+      v = (t < v) ? t : v;
+      t = bound_ns_per_call(bound, op);
+      b = (t < b) ? t : b;
+    }
+    printf("%s,%.1f,%.1f\n", ops[op], v, b);
+  }
+
+  delete bound;
+  delete ili9341;
+  delete host_bus;
+  return bound_digest();
+}
+
+#define WB_CACHE_LINE 32 // ESP32-S3 data cache line, the unit written back
+
+static uint8_t *wb_covered;
+static uintptr_t wb_base;
+static uint64_t wb_deferred_lines;
+
+// cache lines a write-back of size bytes at framebuffer offset covers
+static uint32_t wb_lines(uint32_t offset, uint32_t size)
+{
+  return ((offset + size + WB_CACHE_LINE - 1) / WB_CACHE_LINE) - (offset / WB_CACHE_LINE);
+}
+
+static void wb_stub(uintptr_t addr, uint32_t size)
+{
+  memset(wb_covered + (addr - wb_base), 1, size);
+  wb_deferred_lines += wb_lines(addr - wb_base, size);
+}
+
+// Arduino_Canvas standing in for Arduino_RGB_Display with auto_flush
+class WriteBackCanvas : public Arduino_Canvas
+{
+public:
+  WriteBackCanvas(int16_t w, int16_t h)
+      : Arduino_Canvas(w, h, nullptr), writeback(wb_stub)
+  {
+  }
+
+  ~WriteBackCanvas()
+  {
+    free(_changed);
+    free(wb_covered);
+    wb_covered = nullptr;
+  }
+
+  bool begin(int32_t = GFX_NOT_DEFINED) override
+  {
+    if (!Arduino_Canvas::begin(GFX_SKIP_OUTPUT_BEGIN))
+    {
+      return false;
+    }
+    _changed = (uint8_t *)calloc((size_t)WIDTH * HEIGHT * 2, 1);
+    wb_covered = (uint8_t *)calloc((size_t)WIDTH * HEIGHT * 2, 1);
+    wb_base = (uintptr_t)_framebuffer;
+    return _changed && wb_covered && writeback.begin(_framebuffer, WIDTH, HEIGHT, 2);
+  }
+
+  void endWrite(void) override
+  {
+    writeback.flush();
+    for (uint32_t i = 0; i < (uint32_t)WIDTH * HEIGHT * 2; ++i)
+    {
+      if (_changed[i] && !wb_covered[i])
+      {
+        ++missed;
+      }
+    }
+    memset(_changed, 0, (size_t)WIDTH * HEIGHT * 2);
+    memset(wb_covered, 0, (size_t)WIDTH * HEIGHT * 2);
+  }
+
+  void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override
+  {
+    Arduino_Canvas::writePixelPreclipped(x, y, color);
+    changed(x, y, 1, 1);
+    immediate(x, y, 1, 1);
+  }
+
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override
+  {
+    Arduino_Canvas::writeFastVLine(x, y, h, color);
+    if (_ordered_in_range(x, 0, MAX_X) && Raster::clipSpan(y, h, MAX_Y))
+    {
+      changed(x, y, 1, h);
+      for (int16_t j = 0; j < h; ++j)
+      {
+        immediate(x, y + j, 1, 1);
+      }
+    }
+  }
+
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override
+  {
+    Arduino_Canvas::writeFastHLine(x, y, w, color);
+    if (_ordered_in_range(y, 0, MAX_Y) && Raster::clipSpan(x, w, MAX_X))
+    {
+      changed(x, y, w, 1);
+      immediate(x, y, w, 1);
+    }
+  }
+
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override
+  {
+    Arduino_Canvas::writeFillRectPreclipped(x, y, w, h, color);
+    changed(x, y, w, h);
+    immediate(0, y, WIDTH, h); // whole rows, as the display did
+  }
+
+  Arduino_GFX_WriteBack writeback;
+  uint32_t immediate_calls = 0;
+  uint64_t immediate_bytes = 0;
+  uint64_t immediate_lines = 0;
+  uint32_t missed = 0;
+
+private:
+  // one write-back of consecutive rows, as the display did per primitive
+  void immediate(int16_t x, int16_t y, int16_t w, int16_t h)
+  {
+    uint32_t size = (w == WIDTH) ? ((uint32_t)WIDTH * h * 2) : ((uint32_t)w * 2);
+    ++immediate_calls;
+    immediate_bytes += size;
+    immediate_lines += wb_lines(((uint32_t)y * WIDTH + x) * 2, size);
+  }
+
+  void changed(int16_t x, int16_t y, int16_t w, int16_t h)
+  {
+    for (int16_t j = y; j < y + h; ++j)
+    {
+      memset(_changed + ((int32_t)j * WIDTH + x) * 2, 1, w * 2);
+    }
+    writeback.mark(x, y, w, h);
+  }
+
+  uint8_t *_changed = nullptr;
+};
+
+static int writeback()
+{
+  static const char *scenes[] = {"text", "lines", "circles", "fill_rects", "fill_screen"};
+  WriteBackCanvas *canvas = new WriteBackCanvas(480, 480);
+  canvas->begin();
+
+  printf("scene,immediate_calls,immediate_bytes,immediate_cache_lines,deferred_calls,deferred_bytes,deferred_cache_lines\n");
+  int failed = 0;
+  for (uint8_t s = 0; s < 5; ++s)
+  {
+    canvas->immediate_calls = 0;
+    canvas->immediate_bytes = 0;
+    canvas->immediate_lines = 0;
+    wb_deferred_lines = 0;
+    canvas->writeback.calls = 0;
+    canvas->writeback.bytes = 0;
+    canvas->missed = 0;
+    switch (s)
+    {
+    case 0:
+      canvas->setTextColor(RGB565_WHITE, RGB565_BLACK);
+      for (int16_t i = 0; i < 10; ++i)
+      {
+        canvas->setTextSize(1 + (i & 1));
+        canvas->setCursor(4, 10 + i * 40);
+        canvas->print("Temperature 21.5 C");
+      }
+      break;
+    case 1:
+      for (int16_t i = 0; i < 480; i += 12)
+      {
+        canvas->drawLine(0, i, 479, 479 - i, RGB565_YELLOW);
+      }
+      break;
+    case 2:
+      for (int16_t i = 10; i < 240; i += 10)
+      {
+        canvas->drawCircle(240, 240, i, RGB565_CYAN);
+      }
+      break;
+    case 3:
+      for (int16_t i = 0; i < 20; ++i)
+      {
+        canvas->fillRect(i * 23, i * 17, 40, 30, RGB565_RED);
+      }
+      break;
+    default:
+      canvas->fillScreen(RGB565_BLUE);
+    }
+    printf("%s,%u,%llu,%llu,%u,%llu,%llu\n", scenes[s],
+           (unsigned)canvas->immediate_calls, (unsigned long long)canvas->immediate_bytes, (unsigned long long)canvas->immediate_lines,
+           (unsigned)canvas->writeback.calls, (unsigned long long)canvas->writeback.bytes, (unsigned long long)wb_deferred_lines);
+    if (wb_deferred_lines > canvas->immediate_lines)
+    {
+      fprintf(stderr, "writeback %s: deferred wrote back %llu cache lines, immediate %llu\n", scenes[s],
+              (unsigned long long)wb_deferred_lines, (unsigned long long)canvas->immediate_lines);
+      failed = 1;
+    }
+    if (canvas->missed)
+    {
+      fprintf(stderr, "writeback %s: %u changed bytes not written back\n", scenes[s], (unsigned)canvas->missed);
+      failed = 1;
+    }
+  }
+
+  delete canvas;
+  return failed;
+}
+
+// pixels at least this far inside the edge of a round panel must be drawn
+static bool round_inside(int16_t x, int16_t y, int16_t size)
+{
+  float c = (size - 1) / 2.0f, r = size / 2.0f - 1.5f;
+  return ((x - c) * (x - c) + (y - c) * (y - c)) <= (r * r);
+}
+
+// the emulated GRAM follows the ILI9341 MADCTL convention, which the
+// GC9A01 mirrors in x
+static uint32_t round_diff(const uint16_t *gram, const uint16_t *fb, int16_t size)
+{
+  uint32_t diff = 0;
+  for (int16_t y = 0; y < size; ++y)
+  {
+    for (int16_t x = 0; x < size; ++x)
+    {
+      if (round_inside(x, y, size) && (gram[y * size + (size - 1 - x)] != fb[y * size + x]))
+      {
+        ++diff;
+      }
+    }
+  }
+  return diff;
+}
+
+static int round_flush()
+{
+  static const char *modes[] = {"square", "round_output", "round_canvas"};
+  Arduino_HostPanelBus *panel_bus = new Arduino_HostPanelBus(240, 240);
+  Arduino_GC9A01 *panel = new Arduino_GC9A01(panel_bus, GFX_NOT_DEFINED, 0, true);
+  panel->begin();
+  Arduino_Canvas *canvas = new Arduino_Canvas(240, 240, panel);
+  canvas->begin(GFX_SKIP_OUTPUT_BEGIN);
+  draw_verify_scene(canvas);
+
+  printf("flush,bus_bytes,transactions\n");
+  int failed = 0;
+  for (uint8_t m = 0; m < 3; ++m)
+  {
+    if (m == 1)
+    {
+      panel->enableRoundMode();
+    }
+    else if (m == 2)
+    {
+      // a second panel, so only the canvas is round
+      delete panel;
+      panel = new Arduino_GC9A01(panel_bus, GFX_NOT_DEFINED, 0, true);
+      panel->begin();
+      delete canvas;
+      canvas = new Arduino_Canvas(240, 240, panel);
+      canvas->begin(GFX_SKIP_OUTPUT_BEGIN);
+      canvas->enableRoundMode();
+      draw_verify_scene(canvas);
+    }
+    panel_bus->clear(RGB565_BLACK);
+    panel_bus->resetCounters();
+    canvas->flush();
+    printf("%s,%llu,%u\n", modes[m], (unsigned long long)(panel_bus->command_bytes + panel_bus->data_bytes), (unsigned)panel_bus->transactions);
+    uint32_t diff = round_diff(panel_bus->getGram(), canvas->getFramebuffer(), 240);
+    if (diff)
+    {
+      fprintf(stderr, "round %s: %u pixels inside the circle differ\n", modes[m], (unsigned)diff);
+      failed = 1;
+    }
+  }
+
+  // primitives clipped to the circle on the round panel itself
+  delete canvas;
+  canvas = new Arduino_Canvas(240, 240, nullptr);
+  canvas->begin(GFX_SKIP_OUTPUT_BEGIN);
+  draw_verify_scene(canvas);
+  panel->enableRoundMode();
+  panel_bus->clear(RGB565_BLACK);
+  draw_verify_scene(panel);
+  uint32_t diff = round_diff(panel_bus->getGram(), canvas->getFramebuffer(), 240);
+  if (diff)
+  {
+    fprintf(stderr, "round scene: %u pixels inside the circle differ\n", (unsigned)diff);
+    failed = 1;
+  }
+
+  delete canvas;
+  delete panel;
+  delete panel_bus;
+  return failed;
+}
+
+#define SCROLL_TOP 20
+#define SCROLL_BOTTOM 20
+#define SCROLL_LINE_H 12
+
+// digits of a 10 row GFXfont for the opaque text of --scroll, all the
+// same 5x7 glyph
+static const uint8_t scroll_font_bitmap[] = {0x74, 0x67, 0x5C, 0xC6, 0x2E};
+static const GFXglyph scroll_font_glyphs[] = {
+    {0, 5, 7, 6, 0, -7}, {0, 5, 7, 6, 0, -7}, {0, 5, 7, 6, 0, -7}, {0, 5, 7, 6, 0, -7}, {0, 5, 7, 6, 0, -7},
+    {0, 5, 7, 6, 0, -7}, {0, 5, 7, 6, 0, -7}, {0, 5, 7, 6, 0, -7}, {0, 5, 7, 6, 0, -7}, {0, 5, 7, 6, 0, -7}};
+static const GFXfont scroll_font = {(uint8_t *)scroll_font_bitmap, (GFXglyph *)scroll_font_glyphs, '0', '9', 10};
+
+// Log line n of --scroll at y: background, transparent and opaque text,
+// an icon, one bitmap of every other writer and a column of single pixels
+static void scroll_line(Arduino_GFX *gfx, int16_t y, uint16_t n)
+{
+  uint16_t icon[10 * 10];
+  for (int16_t i = 0; i < 10 * 10; ++i)
+  {
+    icon[i] = (uint16_t)((n * 0x9E37) ^ (i * 0x0841));
+  }
+  gfx->fillRect(0, y, gfx->width(), SCROLL_LINE_H, (n & 1) ? RGB565_NAVY : RGB565_BLACK);
+  gfx->draw16bitRGBBitmap(2, y + 1, icon, 10, 10);
+  gfx->setTextColor(RGB565_WHITE);
+  gfx->setCursor(16, y + 2);
+  gfx->printf("line %u", n);
+  gfx->setTextColor(RGB565_GREEN, RGB565_MAROON);
+  gfx->setCursor(64, y + 2);
+  gfx->printf("#%02u", n % 100);
+  gfx->setFont(&scroll_font);
+  gfx->setCursor(86, y + 8);
+  gfx->printf("%02u", n % 100);
+  gfx->setFont((const GFXfont *)NULL);
+
+  // rows n % 6 on of the --verify bitmaps, 16 x 10, the PROGMEM writers on
+  // odd lines
+  int16_t r = n % 6;
+  if (n & 1)
+  {
+    gfx->drawBitmap(100, y + 1, (const uint8_t *)bm_1bit + (r * 2), 16, 10, RGB565_ORANGE, RGB565_DARKGREEN);
+    gfx->drawGrayscaleBitmap(118, y + 1, (const uint8_t *)bm_gray + (r * 16), 16, 10);
+    gfx->draw24bitRGBBitmap(172, y + 1, (const uint8_t *)bm_24bit + (r * 16 * 3), 16, 10);
+  }
+  else
+  {
+    gfx->drawBitmap(100, y + 1, bm_1bit + (r * 2), 16, 10, RGB565_ORANGE, RGB565_DARKGREEN);
+    gfx->drawGrayscaleBitmap(118, y + 1, bm_gray + (r * 16), 16, 10);
+    gfx->draw24bitRGBBitmap(172, y + 1, bm_24bit + (r * 16 * 3), 16, 10);
+  }
+  gfx->drawIndexedBitmap(136, y + 1, bm_index + (r * 16), bm_palette, 16, 10);
+  gfx->drawIndexedBitmap(154, y + 1, bm_index + (r * 24), bm_palette, (int16_t)16, (int16_t)10, (int16_t)8);
+  gfx->draw16bitBeRGBBitmap(190, y + 1, bm_16bit_be + (r * 16), 16, 10);
+  gfx->startWrite();
+  for (int16_t j = 0; j < SCROLL_LINE_H; ++j)
+  {
+    gfx->writePixel(gfx->width() - 4, y + j, (j & 1) ? RGB565_YELLOW : RGB565_RED);
+  }
+  gfx->endWrite();
+}
+
+static void scroll_fixed(Arduino_GFX *gfx)
+{
+  int16_t h = gfx->height();
+  gfx->fillRect(0, 0, gfx->width(), SCROLL_TOP, RGB565_DARKGREY);
+  gfx->fillRect(0, h - SCROLL_BOTTOM, gfx->width(), SCROLL_BOTTOM, RGB565_DARKGREY);
+  gfx->setTextColor(RGB565_WHITE);
+  gfx->setCursor(4, 6);
+  gfx->print("header");
+  gfx->setCursor(4, h - SCROLL_BOTTOM + 6);
+  gfx->print("footer");
+}
+
+// --scroll on one panel type, scroller and redrawer each on their own
+// emulated panel
+static int scroll_panel(const char *name, Arduino_TFT *scroller, Arduino_HostPanelBus *scroll_bus,
+                        Arduino_TFT *redrawer, Arduino_HostPanelBus *redraw_bus)
+{
+  int16_t w = scroller->width(), h = scroller->height();
+  scroller->begin();
+  redrawer->begin();
+  uint16_t *screen = (uint16_t *)malloc((int32_t)w * h * 2);
+
+  int failed = 0;
+  if (!scroller->setScrollArea(SCROLL_TOP, SCROLL_BOTTOM))
+  {
+    fprintf(stderr, "scroll: %s has no scroll area\n", name);
+    failed = 1;
+  }
+  scroller->fillScreen(RGB565_BLACK);
+  scroll_fixed(scroller);
+  scroll_bus->resetCounters();
+  redraw_bus->resetCounters();
+
+  const uint16_t lines = 60;
+  const int16_t bottom = h - SCROLL_BOTTOM;
+  for (uint16_t n = 0; (n < lines) && !failed; ++n)
+  {
+    scroller->scrollTo(scroller->getScrollOffset() + SCROLL_LINE_H);
+    scroll_line(scroller, bottom - SCROLL_LINE_H, n);
+
+    redrawer->fillRect(0, SCROLL_TOP, 240, bottom - SCROLL_TOP, RGB565_BLACK);
+    for (int16_t k = n, y = bottom - SCROLL_LINE_H; (k >= 0) && ((y + SCROLL_LINE_H) > SCROLL_TOP); --k, y -= SCROLL_LINE_H)
+    {
+      scroll_line(redrawer, y, k);
+    }
+    scroll_fixed(redrawer);
+
+    scroll_bus->getScreen(screen);
+    uint16_t *ref = redraw_bus->getGram();
+    uint32_t diff = 0;
+    for (int32_t i = 0; i < (int32_t)w * h; ++i)
+    {
+      diff += (screen[i] != ref[i]);
+    }
+    if (diff)
+    {
+      fprintf(stderr, "scroll %s line %u: %u pixels differ\n", name, n, (unsigned)diff);
+      failed = 1;
+    }
+  }
+
+  printf("%s,scroll,%llu\n", name, (unsigned long long)((scroll_bus->command_bytes + scroll_bus->data_bytes) / lines));
+  printf("%s,redraw,%llu\n", name, (unsigned long long)((redraw_bus->command_bytes + redraw_bus->data_bytes) / lines));
+
+  free(screen);
+  delete redrawer;
+  delete redraw_bus;
+  delete scroller;
+  delete scroll_bus;
+  return failed;
+}
+
+static int scroll()
+{
+  init_bitmaps();
+  printf("panel,update,bus_bytes_per_line\n");
+  Arduino_HostPanelBus *scroll_bus = new Arduino_HostPanelBus(240, 320);
+  Arduino_HostPanelBus *redraw_bus = new Arduino_HostPanelBus(240, 320);
+  int failed = scroll_panel("ILI9341", new Arduino_ILI9341(scroll_bus), scroll_bus,
+                            new Arduino_ILI9341(redraw_bus), redraw_bus);
+  // RGB666 pixels, converted in Arduino_TFT_18bit
+  scroll_bus = new Arduino_HostPanelBus(320, 480);
+  redraw_bus = new Arduino_HostPanelBus(320, 480);
+  failed |= scroll_panel("ILI9488_18bit", new Arduino_ILI9488_18bit(scroll_bus), scroll_bus,
+                         new Arduino_ILI9488_18bit(redraw_bus), redraw_bus);
+  return failed;
+}
+
+// Panel scan for --te. TE edges come every period_us from time 0 on, and
+// the clock moves with the bytes the ILI9341 puts on the bus at bus_hz and
+// with the waits of the scheduler, so the run is the same on every host.
+class SimulatedTE : public Arduino_GFX_TE
+{
+public:
+  SimulatedTE(Arduino_HostBus *bus, uint32_t bus_hz, uint32_t period_us)
+      : Arduino_GFX_TE(320), _bus(bus), _bus_hz(bus_hz), _period_us(period_us)
+  {
+  }
+
+  uint32_t now(void) override
+  {
+    uint64_t bytes = _bus->command_bytes + _bus->data_bytes;
+    return _waited + (uint32_t)((bytes * 8 * 1000000ULL) / _bus_hz);
+  }
+
+  void waitUntil(uint32_t t) override
+  {
+    uint32_t n = now();
+    if ((int32_t)(t - n) > 0)
+    {
+      _waited += t - n;
+    }
+    poll();
+  }
+
+  void poll(void) override
+  {
+    while (_next_edge <= now())
+    {
+      edge(_next_edge);
+      _next_edge += _period_us;
+    }
+  }
+
+  // time the scan reaches row in frame n of the simulated panel
+  int64_t scanTime(int64_t n, int16_t row)
+  {
+    return (n * _period_us) + GFX_TE_BLANK_US + (((int64_t)(_period_us - GFX_TE_BLANK_US) * row) / 320);
+  }
+
+  // whether the scan is inside rows y to y + h - 1 at some time in [start, end)
+  bool overtakes(int16_t y, int16_t h, uint32_t start, uint32_t end)
+  {
+    for (int64_t n = ((int64_t)start / _period_us) - 1; n <= (((int64_t)end / _period_us) + 1); ++n)
+    {
+      if ((scanTime(n, y) < end) && (scanTime(n, y + h) > start))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // first frame that scans row y after end
+  int64_t shownIn(int16_t y, uint32_t end)
+  {
+    int64_t n = ((int64_t)end / _period_us) - 1;
+    while (scanTime(n, y) < end)
+    {
+      ++n;
+    }
+    return n;
+  }
+
+protected:
+  Arduino_HostBus *_bus;
+  uint32_t _bus_hz;
+  uint32_t _period_us;
+  uint32_t _waited = 0;
+  uint32_t _next_edge = 0;
+};
+
+struct TEFlush
+{
+  SimulatedTE *te;
+  Arduino_ILI9341 *panel;
+  uint16_t *fb;
+  uint32_t called;      // time of the flush call
+  uint32_t start_delay; // to the first band
+  int64_t frame;        // first frame showing the first band
+  bool torn;            // a band first shows in another frame
+  uint32_t overtaken;   // bands the scan passed while they were written
+};
+
+static void te_write(void *ctx, int16_t y, int16_t h)
+{
+  TEFlush *f = (TEFlush *)ctx;
+  uint32_t start = f->te->now();
+  f->panel->draw16bitRGBBitmap(0, y, f->fb + ((int32_t)y * 240), 240, h);
+  uint32_t end = f->te->now();
+
+  int64_t frame = f->te->shownIn(y, end);
+  if (f->frame < 0)
+  {
+    f->frame = frame;
+    f->start_delay = start - f->called;
+  }
+  else if (frame != f->frame)
+  {
+    f->torn = true;
+  }
+  if (f->te->overtakes(y, h, start, end))
+  {
+    ++f->overtaken;
+  }
+}
+
+static int te_sync()
+{
+  static const char *modes[] = {"direct", "vsync", "te_sync"};
+  static const uint32_t bus_mhz[] = {80, 40, 20};
+  static const int16_t regions[][2] = {{0, 320}, {96, 128}};
+  const uint16_t flushes = 50;
+  const int16_t band_rows = 16;
+  uint16_t *fb = (uint16_t *)calloc(240 * 320, 2);
+
+  printf("mode,bus_mhz,rows,flushes,planned,overtaken_bands,torn_flushes,avg_start_delay_us\n");
+  int failed = 0;
+  for (uint8_t b = 0; b < 3; ++b)
+  {
+    for (uint8_t r = 0; r < 2; ++r)
+    {
+      for (uint8_t m = 0; m < 3; ++m)
+      {
+        Arduino_HostBus *bus = new Arduino_HostBus();
+        Arduino_ILI9341 *panel = new Arduino_ILI9341(bus);
+        panel->begin();
+        bus->resetCounters();
+        // a 59 Hz panel, the scheduler assumes 60 Hz until it measured TE
+        SimulatedTE *te = new SimulatedTE(bus, bus_mhz[b] * 1000000, 16950);
+        Arduino_GFX_TESync *sync = new Arduino_GFX_TESync(te);
+
+        uint32_t seed = 12345;
+        uint16_t planned = 0, torn = 0;
+        uint32_t overtaken = 0;
+        uint64_t delay = 0;
+        // the first flush measures the bus, it is not counted
+        for (int16_t i = -1; i < flushes; ++i)
+        {
+          seed = (seed * 1103515245) + 12345;
+          te->waitUntil(te->now() + ((seed >> 8) % 33000));
+
+          TEFlush f = {te, panel, fb, te->now(), 0, -1, false, 0};
+          bool ok = true;
+          if (m == 2)
+          {
+            ok = sync->flush(regions[r][0], regions[r][1], band_rows, te_write, &f);
+          }
+          else
+          {
+            if (m == 1)
+            {
+              te->waitEdge(2 * GFX_TE_FRAME_US);
+            }
+            for (int16_t y = regions[r][0]; y < (regions[r][0] + regions[r][1]); y += band_rows)
+            {
+              te_write(&f, y, band_rows);
+            }
+          }
+          if (i < 0)
+          {
+            continue;
+          }
+          planned += ok;
+          torn += f.torn;
+          overtaken += f.overtaken;
+          delay += f.start_delay;
+          if ((m == 2) && ok && (f.torn || f.overtaken))
+          {
+            fprintf(stderr, "te_sync %u MHz, %d rows, flush %d: %u bands overtaken%s\n",
+                    (unsigned)bus_mhz[b], regions[r][1], i, (unsigned)f.overtaken, f.torn ? ", torn" : "");
+            failed = 1;
+          }
+        }
+        printf("%s,%u,%d,%u,%u,%u,%u,%u\n", modes[m], (unsigned)bus_mhz[b], regions[r][1], flushes,
+               (m == 2) ? planned : 0, (unsigned)overtaken, torn, (unsigned)(delay / flushes));
+
+        delete sync;
+        delete te;
+        delete panel;
+        delete bus;
+      }
+    }
+  }
+
+  free(fb);
+  return failed;
+}
+
+// LT7680 display RAM at 16 bpp, with the BTE operations Arduino_LT7680
+// starts through BLT_CTRL0 carried out as the controller would.
+class LT7680RegisterBus final : public Arduino_DataBus
+{
+public:
+  LT7680RegisterBus() { ram = (uint16_t *)calloc(LT7680_SDRAM_SIZE / 2, 2); }
+  ~LT7680RegisterBus() { free(ram); }
+
+  bool begin(int32_t, int8_t) override { return ram != nullptr; }
+  void beginWrite() override {}
+  void endWrite() override {}
+  void writeCommand(uint8_t c) override
+  {
+    _reg = c;
+    ++bytes;
+  }
+  void writeCommand16(uint16_t) override {}
+  void writeCommandBytes(uint8_t *, uint32_t) override {}
+  void write(uint8_t d) override
+  {
+    ++bytes;
+    if (_reg == LT7680_MRWDP)
+    {
+      mcuData(d);
+      return;
+    }
+    _regs[_reg] = d;
+    if ((_reg == LT7680_BLT_CTRL0) && (d & 0x10))
+    {
+      bte();
+    }
+  }
+  void write16(uint16_t) override {}
+  void writeRepeat(uint16_t, uint32_t) override {}
+  void writeBytes(uint8_t *data, uint32_t len) override
+  {
+    while (len--)
+    {
+      write(*data++);
+    }
+  }
+  void writePixels(uint16_t *, uint32_t) override {}
+
+  uint16_t *pixel(uint8_t str, uint8_t wth, uint8_t xy, uint32_t i, uint32_t j)
+  {
+    uint32_t addr = reg32(str);
+    return ram + (addr / 2) + (reg16(xy + 2) + j) * reg16(wth) + reg16(xy) + i;
+  }
+
+  uint16_t reg16(uint8_t r) { return _regs[r] | (_regs[r + 1] << 8); }
+  uint32_t reg32(uint8_t r) { return reg16(r) | ((uint32_t)reg16(r + 2) << 16); }
+
+  uint16_t *ram;
+  uint64_t bytes = 0;
+  uint32_t operations = 0;
+
+protected:
+
+  void bte()
+  {
+    uint8_t op = _regs[LT7680_BLT_CTRL1] & 0x0F;
+    uint16_t w = reg16(LT7680_BLT_WTH_LO), h = reg16(LT7680_BLT_HIG_LO);
+    uint16_t key = ((_regs[LT7680_BGCR] & 0xF8) << 8) | ((_regs[LT7680_BGCG] & 0xFC) << 3) | (_regs[LT7680_BGCB] >> 3);
+    uint8_t pattern = (_regs[LT7680_BLT_CTRL0] & 0x01) ? 16 : 8;
+    ++operations;
+    _mcu_left = 0;
+    for (uint32_t j = 0; j < h; ++j)
+    {
+      for (uint32_t i = 0; i < w; ++i)
+      {
+        uint16_t *d = pixel(LT7680_DT_STR_LO, LT7680_DT_WTH_LO, LT7680_DT_X_LO, i, j);
+        switch (op)
+        {
+        case 2: // memory copy, S0 raster operation only
+          *d = *pixel(LT7680_S0_STR_LO, LT7680_S0_WTH_LO, LT7680_S0_X_LO, i, j);
+          break;
+        case 5: // memory copy with chroma key
+        {
+          uint16_t s = *pixel(LT7680_S0_STR_LO, LT7680_S0_WTH_LO, LT7680_S0_X_LO, i, j);
+          if (s != key)
+          {
+            *d = s;
+          }
+          break;
+        }
+        case 6: // pattern fill
+          *d = *pixel(LT7680_S0_STR_LO, LT7680_S0_WTH_LO, LT7680_S0_X_LO, i % pattern, j % pattern);
+          break;
+        }
+      }
+    }
+    if (op == 0)
+    {
+      _mcu_left = (uint32_t)w * h * 2;
+      _mcu_w = w;
+      _mcu_i = 0;
+    }
+  }
+
+  void mcuData(uint8_t d)
+  {
+    if (!_mcu_left)
+    {
+      return;
+    }
+    uint32_t p = _mcu_i / 2;
+    uint16_t *dp = pixel(LT7680_DT_STR_LO, LT7680_DT_WTH_LO, LT7680_DT_X_LO, p % _mcu_w, p / _mcu_w);
+    *dp = (_mcu_i & 1) ? ((*dp & 0x00FF) | (d << 8)) : ((*dp & 0xFF00) | d);
+    ++_mcu_i;
+    --_mcu_left;
+  }
+
+  uint8_t _reg = 0;
+  uint8_t _regs[256] = {};
+  uint32_t _mcu_left = 0, _mcu_i = 0;
+  uint16_t _mcu_w = 0;
+};
+
+// copies w x h pixels the way the BTE does, top down and left to right,
+// leaving out the key colour when key >= 0
+static void lt_copy(const uint16_t *src, uint16_t src_w, int16_t sx, int16_t sy, uint16_t w, uint16_t h,
+                    uint16_t *dst, uint16_t dst_w, int16_t dx, int16_t dy, int32_t key = -1)
+{
+  for (uint16_t j = 0; j < h; ++j)
+  {
+    for (uint16_t i = 0; i < w; ++i)
+    {
+      uint16_t c = src[(sy + j) * src_w + sx + i];
+      if (c != key)
+      {
+        dst[(dy + j) * dst_w + dx + i] = c;
+      }
+    }
+  }
+}
+
+static int lt_check(const char *op, LT7680RegisterBus *bus, const uint16_t *ref, uint32_t pixels, uint16_t w)
+{
+  for (uint32_t i = 0; i < pixels; ++i)
+  {
+    if (bus->ram[i] != ref[i])
+    {
+      fprintf(stderr, "lt7680 %s: pixel (%u, %u) is 0x%04x, expected 0x%04x\n", op,
+              (unsigned)(i % w), (unsigned)(i / w), bus->ram[i], ref[i]);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static int lt7680()
+{
+  LT7680RegisterBus *bus = new LT7680RegisterBus();
+  Arduino_LT7680 *lt = new Arduino_LT7680(bus, ER5517);
+  lt->begin();
+
+  const uint16_t W = lt->getSurfaceWidth(LT7680_SCREEN), H = lt->getSurfaceHeight(LT7680_SCREEN);
+  const uint32_t pixels = (uint32_t)W * H;
+  uint16_t *ref = (uint16_t *)calloc(pixels, 2);
+  uint16_t *moved = (uint16_t *)malloc(pixels * 2);
+  memcpy(ref, bus->ram, pixels * 2);
+
+  // a 30x20 sprite with a key colour border, and a 16x16 pattern
+  const uint16_t key = RGB565_MAGENTA;
+  uint16_t sprite[30 * 20], pattern[16 * 16];
+  for (uint16_t i = 0; i < 30 * 20; ++i)
+  {
+    uint16_t x = i % 30, y = i / 30;
+    sprite[i] = ((x < 3) || (x > 26) || (y < 2) || (y > 17)) ? key : (uint16_t)(x * 2049 + y * 97);
+  }
+  for (uint16_t i = 0; i < 16 * 16; ++i)
+  {
+    pattern[i] = (uint16_t)(i * 257 + 1);
+  }
+
+  int failed = 0;
+  int8_t s = lt->createSurface(30, 20);
+  int8_t p = lt->createSurface(16, 16);
+  if ((s < 0) || (p < 0) || (lt->getSurfaceWidth(s) != 32))
+  {
+    fprintf(stderr, "lt7680 createSurface: handles %d, %d, width %u\n", s, p, lt->getSurfaceWidth(s));
+    failed = 1;
+  }
+  lt->writeSurface(s, 0, 0, sprite, 30, 20);
+  lt->writeSurface(p, 0, 0, pattern, 16, 16);
+
+  lt->blit(s, 0, 0, 30, 20, LT7680_SCREEN, 10, 10);
+  lt_copy(sprite, 30, 0, 0, 30, 20, ref, W, 10, 10);
+  failed |= lt_check("blit", bus, ref, pixels, W);
+
+  lt->blitChromaKey(s, 0, 0, 30, 20, LT7680_SCREEN, 100, 50, key);
+  lt_copy(sprite, 30, 0, 0, 30, 20, ref, W, 100, 50, key);
+  failed |= lt_check("blitChromaKey", bus, ref, pixels, W);
+
+  lt->patternFill(p, LT7680_SCREEN, 20, 200, 100, 70);
+  for (uint16_t j = 0; j < 70; ++j)
+  {
+    for (uint16_t i = 0; i < 100; ++i)
+    {
+      ref[(200 + j) * W + 20 + i] = pattern[(j % 16) * 16 + (i % 16)];
+    }
+  }
+  failed |= lt_check("patternFill", bus, ref, pixels, W);
+
+  // scrolling over itself in every direction, against a copy taken first
+  static const int16_t scrolls[][2] = {{0, 37}, {0, -23}, {13, 0}, {-9, 0}, {5, -4}};
+  for (uint8_t i = 0; i < 5; ++i)
+  {
+    int16_t dx = scrolls[i][0], dy = scrolls[i][1];
+    lt->scrollRect(LT7680_SCREEN, 40, 40, 160, 400, dx, dy);
+    memcpy(moved, ref, pixels * 2);
+    lt_copy(moved, W, 40, 40, 160, 400, ref, W, 40 + dx, 40 + dy);
+    failed |= lt_check("scrollRect", bus, ref, pixels, W);
+  }
+
+  // triple buffering: the main window cycles through the pages, the canvas
+  // is always the page after the one shown and a copying flip starts it as
+  // the shown page
+  if (!lt->beginPages(3))
+  {
+    fprintf(stderr, "lt7680 beginPages: out of display RAM\n");
+    failed = 1;
+  }
+  uint32_t pages[3] = {bus->reg32(LT7680_MISA_LO), bus->reg32(LT7680_CVSSA_LO), 0};
+  for (uint8_t i = 0; i < 6; ++i)
+  {
+    lt->blit(s, 0, 0, 30, 20, lt->getBackPage(), i * 32, 700);
+    lt->flipPage(i == 5);
+    uint32_t shown = bus->reg32(LT7680_MISA_LO), drawn = bus->reg32(LT7680_CVSSA_LO);
+    if (i == 0)
+    {
+      pages[2] = drawn;
+    }
+    if ((shown != pages[(i + 1) % 3]) || (drawn != pages[(i + 2) % 3]) || (pages[2] == pages[0]) || (pages[2] == pages[1]))
+    {
+      fprintf(stderr, "lt7680 flipPage %u: shown 0x%x, drawn 0x%x\n", i, (unsigned)shown, (unsigned)drawn);
+      failed = 1;
+    }
+  }
+  if (memcmp(bus->ram + bus->reg32(LT7680_MISA_LO) / 2, bus->ram + bus->reg32(LT7680_CVSSA_LO) / 2, pixels * 2) != 0)
+  {
+    fprintf(stderr, "lt7680 flipPage: copy differs from the page shown\n");
+    failed = 1;
+  }
+  lt->beginPages(1);
+  if ((bus->reg32(LT7680_MISA_LO) != pages[0]) || (bus->reg32(LT7680_CVSSA_LO) != pages[0]))
+  {
+    fprintf(stderr, "lt7680 beginPages(1): not back on the screen\n");
+    failed = 1;
+  }
+  // pages set up again reuse their surfaces
+  for (uint8_t i = 0; i < LT7680_MAX_SURFACES; ++i)
+  {
+    if (!lt->beginPages(2 + (i & 1)) || (bus->reg32(LT7680_CVSSA_LO) != pages[1]))
+    {
+      fprintf(stderr, "lt7680 beginPages again %u: pages not reused\n", i);
+      failed = 1;
+      break;
+    }
+  }
+  lt->beginPages(1);
+
+  // bus traffic of drawing the sprite once it is a surface, and pushed
+  printf("operation,bus_bytes\n");
+  bus->bytes = 0;
+  lt->blitChromaKey(s, 0, 0, 30, 20, LT7680_SCREEN, 150, 600, key);
+  printf("sprite_blit,%llu\n", (unsigned long long)bus->bytes);
+  bus->bytes = 0;
+  lt->draw16bitRGBBitmap(150, 640, sprite, 30, 20);
+  printf("sprite_pushed,%llu\n", (unsigned long long)bus->bytes);
+  bus->bytes = 0;
+  lt->scrollRect(LT7680_SCREEN, 0, 0, W, H - 16, 0, 16);
+  printf("scroll_screen,%llu\n", (unsigned long long)bus->bytes);
+
+  free(moved);
+  free(ref);
+  delete lt;
+  delete bus;
+  return failed;
+}
+
+static bool selected(const char *only, const char *target)
+{
+  return !only || (strcmp(only, target) == 0);
+}
+
+// the emulated GRAM follows the ILI9341 MADCTL convention, which the
+// RM67162 and the GC9A01 mirror in x; round panels only count inside the
+// circle
+static uint32_t align_diff(const uint16_t *gram, const uint16_t *fb, int16_t w, int16_t h, bool mirror, bool round)
+{
+  uint32_t diff = 0;
+  for (int16_t y = 0; y < h; ++y)
+  {
+    for (int16_t x = 0; x < w; ++x)
+    {
+      if (round && !round_inside(x, y, w))
+      {
+        continue;
+      }
+      diff += (gram[(int32_t)y * w + (mirror ? (w - 1 - x) : x)] != fb[(int32_t)y * w + x]);
+    }
+  }
+  return diff;
+}
+
+// --align on one panel in rotation 0, grid being its address window grid.
+// A round panel only takes partial updates, full flushes are clipped to
+// the circle off the grid.
+static int align_panel(const char *name, Arduino_TFT *panel, Arduino_HostPanelBus *panel_bus, uint8_t grid, bool mirror, bool round = false)
+{
+  static const char *modes[] = {"partial", "partial_unaligned", "full"};
+  const uint16_t updates = 100;
+  int16_t w = panel->width(), h = panel->height();
+  panel_bus->setAddrAlign(grid);
+  panel->begin();
+  Arduino_Canvas *canvas = new Arduino_Canvas(w, h, panel);
+  canvas->begin(GFX_SKIP_OUTPUT_BEGIN);
+
+  int failed = 0;
+  for (uint8_t m = 0; m < 3; ++m)
+  {
+    // the unaligned areas are only sent in rotation 0, where the canvas
+    // area is the framebuffer area, and only matter on a grid
+    if (((m == 1) && (grid < 2)) || (round && (m != 0)))
+    {
+      continue;
+    }
+    for (uint8_t r = 0; r < ((m == 1) ? 1 : 4); ++r)
+    {
+      canvas->setRotation(r);
+      draw_verify_scene(canvas);
+      if (round)
+      {
+        canvas->flushRect(0, 0, canvas->width(), canvas->height());
+      }
+      else
+      {
+        canvas->flush();
+      }
+      panel_bus->resetCounters();
+      panel_bus->windows = 0;
+      panel_bus->misaligned_windows = 0;
+
+      uint32_t seed = 4321 + r;
+      uint32_t diff = 0;
+      for (uint16_t n = 0; n < updates; ++n)
+      {
+        int16_t v[4];
+        for (uint8_t i = 0; i < 4; ++i)
+        {
+          seed = (seed * 1103515245) + 12345;
+          v[i] = (seed >> 8) & 0x7FFF;
+        }
+        int16_t rw = 1 + (v[2] % 41), rh = 1 + (v[3] % 23);
+        int16_t x = (v[0] % (canvas->width() + 20)) - 10, y = (v[1] % (canvas->height() + 20)) - 10;
+        if (n & 1)
+        {
+          canvas->fillRect(x, y, rw, rh, (uint16_t)(seed >> 5));
+        }
+        else
+        {
+          canvas->drawLine(x, y, x + rw - 1, y + rh - 1, (uint16_t)(seed >> 5));
+        }
+
+        if (m == 0)
+        {
+          canvas->flushRect(x, y, rw, rh);
+        }
+        else if (m == 1)
+        {
+          panel->Arduino_G::draw16bitRGBBitmapRect(0, 0, canvas->getFramebuffer(), w, h, x, y, rw, rh);
+        }
+        else
+        {
+          canvas->flush();
+        }
+        diff = align_diff(panel_bus->getGram(), canvas->getFramebuffer(), w, h, mirror, round);
+        if (diff && (m != 1))
+        {
+          fprintf(stderr, "align %s %s %d update %u: %u pixels differ\n", name, modes[m], r, n, (unsigned)diff);
+          failed = 1;
+          break;
+        }
+      }
+      if ((m != 1) && panel_bus->misaligned_windows)
+      {
+        fprintf(stderr, "align %s %s %d: %u windows off the grid\n", name, modes[m], r, (unsigned)panel_bus->misaligned_windows);
+        failed = 1;
+      }
+      printf("%s,%s,%d,%u,%u,%llu,%u\n", name, modes[m], r, (unsigned)panel_bus->windows, (unsigned)panel_bus->misaligned_windows,
+             (unsigned long long)((panel_bus->command_bytes + panel_bus->data_bytes) / updates), (unsigned)diff);
+    }
+  }
+
+  delete canvas;
+  delete panel;
+  delete panel_bus;
+  return failed;
+}
+
+// a driver put on an address window grid of 2
+template <class Driver>
+class OnGrid : public Driver
+{
+public:
+  OnGrid(Arduino_DataBus *bus) : Driver(bus)
+  {
+    this->_addr_align = 2;
+  }
+};
+
+static int align()
+{
+  printf("panel,flush,rotation,windows,misaligned_windows,bus_bytes_per_update,pixels_differing\n");
+  Arduino_HostPanelBus *panel_bus = new Arduino_HostPanelBus(240, 536);
+  int failed = align_panel("RM67162", new Arduino_RM67162(panel_bus, GFX_NOT_DEFINED, 0, false), panel_bus, 2, true);
+  // no grid, but RGB666 pixels converted in Arduino_TFT_18bit
+  panel_bus = new Arduino_HostPanelBus(320, 480);
+  failed |= align_panel("ILI9488_18bit", new Arduino_ILI9488_18bit(panel_bus), panel_bus, 1, false);
+
+  // in round mode on a grid the whole grown part goes out, not the part
+  // clipped to the circle
+  panel_bus = new Arduino_HostPanelBus(240, 240);
+  Arduino_TFT *round = new OnGrid<Arduino_GC9A01>(panel_bus);
+  round->enableRoundMode();
+  failed |= align_panel("GC9A01_round", round, panel_bus, 2, true, true);
+
+  // and the wrap row of a scroll area would break the grid
+  panel_bus = new Arduino_HostPanelBus(240, 320);
+  Arduino_TFT *scroller = new OnGrid<Arduino_ILI9341>(panel_bus);
+  scroller->begin();
+  if (scroller->setScrollArea(20, 20))
+  {
+    fprintf(stderr, "align ILI9341 on a grid: scroll area accepted\n");
+    failed = 1;
+  }
+  delete scroller;
+  delete panel_bus;
+  return failed;
+}
+
+int main(int argc, char **argv)
+{
+  uint8_t format = GFX_BENCH_CSV;
+  bool quick = false;
+  uint8_t rotations = 0b0001;
+  const char *only = nullptr;
+  const char *trace_file = nullptr;
+  uint32_t bus_hz = 40000000;
+  bool verify_only = false;
+  bool oled_only = false;
+  bool bound_only = false;
+  bool writeback_only = false;
+  bool round_only = false;
+  bool lt7680_only = false;
+  bool scroll_only = false;
+  bool te_only = false;
+  bool align_only = false;
+  for (int i = 1; i < argc; ++i)
+  {
+    if (strcmp(argv[i], "--json") == 0)
+    {
+      format = GFX_BENCH_JSON;
+    }
+    else if (strcmp(argv[i], "--quick") == 0)
+    {
+      quick = true;
+    }
+    else if (strncmp(argv[i], "--rotations=", 12) == 0)
+    {
+      rotations = strtoul(argv[i] + 12, nullptr, 0);
+    }
+    else if (strncmp(argv[i], "--target=", 9) == 0)
+    {
+      only = argv[i] + 9;
+    }
+    else if (strncmp(argv[i], "--trace=", 8) == 0)
+    {
+      trace_file = argv[i] + 8;
+    }
+    else if (strncmp(argv[i], "--bus-hz=", 9) == 0)
+    {
+      bus_hz = strtoul(argv[i] + 9, nullptr, 0);
+    }
+    else if (strcmp(argv[i], "--verify") == 0)
+    {
+      verify_only = true;
+    }
+    else if (strcmp(argv[i], "--oled") == 0)
+    {
+      oled_only = true;
+    }
+    else if (strcmp(argv[i], "--bound") == 0)
+    {
+      bound_only = true;
+    }
+    else if (strcmp(argv[i], "--writeback") == 0)
+    {
+      writeback_only = true;
+    }
+    else if (strcmp(argv[i], "--round") == 0)
+    {
+      round_only = true;
+    }
+    else if (strcmp(argv[i], "--lt7680") == 0)
+    {
+      lt7680_only = true;
+    }
+    else if (strcmp(argv[i], "--scroll") == 0)
+    {
+      scroll_only = true;
+    }
+    else if (strcmp(argv[i], "--te") == 0)
+    {
+      te_only = true;
+    }
+    else if (strcmp(argv[i], "--align") == 0)
+    {
+      align_only = true;
+    }
+    else
+    {
+      fprintf(stderr, "usage: %s [--json] [--quick] [--rotations=<mask>] [--target=<name>] [--trace=<file>] [--bus-hz=<hz>] [--verify] [--oled] [--bound] [--writeback] [--round] [--lt7680] [--scroll] [--te] [--align]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  if (verify_only)
+  {
+    return verify();
+  }
+  if (oled_only)
+  {
+    return oled();
+  }
+  if (bound_only)
+  {
+    return bound();
+  }
+  if (writeback_only)
+  {
+    return writeback();
+  }
+  if (round_only)
+  {
+    return round_flush();
+  }
+  if (lt7680_only)
+  {
+    return lt7680();
+  }
+  if (scroll_only)
+  {
+    return scroll();
+  }
+  if (te_only)
+  {
+    return te_sync();
+  }
+  if (align_only)
+  {
+    return align();
+  }
+
+  StdoutPrint out;
+  Arduino_GFX_Benchmark bench(&out, format);
+  bench.setRotations(rotations);
+  if (quick)
+  {
+    bench.setIterationPolicy(1, 1, 2000);
+  }
+
+  Arduino_HostBus *host_bus = new Arduino_HostBus();
+  bench.setBusByteCounter(host_bus_bytes, host_bus);
+  if (trace_file)
+  {
+#if defined(ARDUINO_GFX_TRACE)
+    host_bus->setSimulatedClock(bus_hz);
+    gfx_trace_init(1 << 20);
+#else
+    (void)bus_hz;
+    fprintf(stderr, "--trace needs a build with -DARDUINO_GFX_TRACE=ON\n");
+    return 1;
+#endif
+  }
+  bench.begin();
+#if defined(ARDUINO_GFX_STATS)
+  Arduino_StatsBus stats_bus(host_bus);
+  Arduino_DataBus *bus = &stats_bus;
+#else
+  Arduino_DataBus *bus = host_bus;
+#endif
+
+  Arduino_ILI9341 *ili9341 = new Arduino_ILI9341(bus);
+  ili9341->begin();
+  print_stats("init");
+  if (selected(only, "ILI9341"))
+  {
+    bench.run("ILI9341", ili9341);
+    print_stats("ILI9341");
+  }
+
+  if (selected(only, "ILI9341_Bound"))
+  {
+    // bound to the host bus type, so without Arduino_StatsBus in between
+    Arduino_TFT_Bound<Arduino_ILI9341, Arduino_HostBus> *bound =
+        new Arduino_TFT_Bound<Arduino_ILI9341, Arduino_HostBus>(host_bus);
+    bound->begin();
+    bench.run("ILI9341_Bound", bound);
+    print_stats("ILI9341_Bound");
+    delete bound;
+  }
+
+  if (selected(only, "ILI9488_18bit"))
+  {
+    Arduino_ILI9488_18bit *ili9488 = new Arduino_ILI9488_18bit(bus);
+    ili9488->begin();
+    bench.run("ILI9488_18bit", ili9488);
+    print_stats("ILI9488_18bit");
+    delete ili9488;
+  }
+
+  if (selected(only, "Canvas_18bit"))
+  {
+    Arduino_ILI9488_18bit *ili9488 = new Arduino_ILI9488_18bit(bus);
+    ili9488->begin();
+    Arduino_Canvas *canvas = new Arduino_Canvas(320, 480, ili9488);
+    canvas->begin(GFX_SKIP_OUTPUT_BEGIN);
+    bench.runFlush("Canvas_18bit", canvas);
+    print_stats("Canvas_18bit");
+    delete canvas;
+    delete ili9488;
+  }
+
+  if (selected(only, "Canvas_24bit"))
+  {
+    Arduino_ILI9488_18bit *ili9488 = new Arduino_ILI9488_18bit(bus);
+    ili9488->begin();
+    Arduino_Canvas_24bit *canvas24 = new Arduino_Canvas_24bit(320, 480, ili9488);
+    canvas24->begin(GFX_SKIP_OUTPUT_BEGIN);
+    bench.run("Canvas_24bit", canvas24);
+    bench.runFlush("Canvas_24bit", canvas24);
+    print_stats("Canvas_24bit");
+    delete canvas24;
+    delete ili9488;
+  }
+
+  if (selected(only, "Canvas"))
+  {
+    Arduino_Canvas *canvas = new Arduino_Canvas(240, 320, ili9341);
+    canvas->begin(GFX_SKIP_OUTPUT_BEGIN);
+    bench.run("Canvas", canvas);
+    bench.runFlush("Canvas", canvas);
+    print_stats("Canvas");
+    delete canvas;
+  }
+
+  if (selected(only, "Canvas_HWRotation"))
+  {
+    Arduino_Canvas *canvas = new Arduino_Canvas(240, 320, ili9341);
+    canvas->begin(GFX_SKIP_OUTPUT_BEGIN);
+    canvas->setHardwareRotation(ili9341);
+    bench.run("Canvas_HWRotation", canvas);
+    bench.runFlush("Canvas_HWRotation", canvas);
+    print_stats("Canvas_HWRotation");
+    delete canvas;
+  }
+
+  if (selected(only, "Canvas_Indexed"))
+  {
+    Arduino_Canvas_Indexed *indexed = new Arduino_Canvas_Indexed(240, 320, ili9341);
+    indexed->begin(GFX_SKIP_OUTPUT_BEGIN);
+    bench.run("Canvas_Indexed", indexed);
+    bench.runFlush("Canvas_Indexed", indexed);
+    print_stats("Canvas_Indexed");
+    delete indexed;
+  }
+
+  if (selected(only, "Canvas_3bit"))
+  {
+    Arduino_Canvas_3bit *canvas3 = new Arduino_Canvas_3bit(240, 320, ili9341);
+    canvas3->begin(GFX_SKIP_OUTPUT_BEGIN);
+    bench.run("Canvas_3bit", canvas3);
+    bench.runFlush("Canvas_3bit", canvas3);
+    print_stats("Canvas_3bit");
+    delete canvas3;
+  }
+
+  if (selected(only, "Canvas_RGB332"))
+  {
+    Arduino_Canvas_RGB332 *rgb332 = new Arduino_Canvas_RGB332(240, 320, ili9341);
+    rgb332->begin(GFX_SKIP_OUTPUT_BEGIN);
+    bench.run("Canvas_RGB332", rgb332);
+    bench.runFlush("Canvas_RGB332", rgb332);
+    print_stats("Canvas_RGB332");
+    delete rgb332;
+  }
+
+  if (selected(only, "Canvas_Packed4"))
+  {
+    Arduino_Canvas_Packed *packed4 = new Arduino_Canvas_Packed(240, 320, ili9341, 0, 0, 0, 4);
+    packed4->begin(GFX_SKIP_OUTPUT_BEGIN);
+    bench.run("Canvas_Packed4", packed4);
+    bench.runFlush("Canvas_Packed4", packed4);
+    print_stats("Canvas_Packed4");
+    delete packed4;
+  }
+
+  if (selected(only, "Canvas_Packed2"))
+  {
+    Arduino_Canvas_Packed *packed2 = new Arduino_Canvas_Packed(240, 320, ili9341, 0, 0, 0, 2);
+    packed2->begin(GFX_SKIP_OUTPUT_BEGIN);
+    bench.run("Canvas_Packed2", packed2);
+    bench.runFlush("Canvas_Packed2", packed2);
+    print_stats("Canvas_Packed2");
+    delete packed2;
+  }
+
+  if (selected(only, "Canvas_Mono"))
+  {
+    Arduino_Canvas_Mono *mono = new Arduino_Canvas_Mono(128, 64, ili9341);
+    mono->begin(GFX_SKIP_OUTPUT_BEGIN);
+    bench.run("Canvas_Mono", mono);
+    bench.runFlush("Canvas_Mono", mono);
+    print_stats("Canvas_Mono");
+    delete mono;
+  }
+
+  bench.end();
+  delete ili9341;
+  delete host_bus;
+
+#if defined(ARDUINO_GFX_TRACE)
+  if (trace_file)
+  {
+    gfx_trace_enable(false);
+    FILE *f = fopen(trace_file, "w");
+    if (!f)
+    {
+      perror(trace_file);
+      return 1;
+    }
+    FilePrint fp(f);
+    gfx_trace_dump_json(&fp);
+    fclose(f);
+  }
+#endif
+  return 0;
+}
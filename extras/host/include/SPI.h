@@ -0,0 +1,25 @@
+/*
+ * Minimal Arduino SPI shim for host builds. Display drivers only need the
+ * SPI mode constants, SPIClass is declared so the library header compiles.
+ */
+#ifndef _HOST_SPI_H_
+#define _HOST_SPI_H_
+
+#include <Arduino.h>
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x01
+#define SPI_MODE2 0x02
+#define SPI_MODE3 0x03
+
+class SPIClass
+{
+public:
+  void begin() {}
+  void end() {}
+  uint8_t transfer(uint8_t) { return 0; }
+};
+
+extern SPIClass SPI;
+
+#endif // _HOST_SPI_H_
@@ -0,0 +1,36 @@
+/*
+ * Minimal Arduino String shim for host builds.
+ */
+#ifndef _HOST_WSTRING_H_
+#define _HOST_WSTRING_H_
+
+#include <string>
+
+class String
+{
+public:
+  String(const char *cstr = "") : _s(cstr ? cstr : "") {}
+  String(const std::string &s) : _s(s) {}
+  String(char c) : _s(1, c) {}
+  String(int v) : _s(std::to_string(v)) {}
+  String(unsigned int v) : _s(std::to_string(v)) {}
+  String(long v) : _s(std::to_string(v)) {}
+  String(unsigned long v) : _s(std::to_string(v)) {}
+
+  const char *c_str() const { return _s.c_str(); }
+  unsigned int length() const { return _s.length(); }
+  char operator[](unsigned int index) const { return _s[index]; }
+
+  String &operator+=(const String &rhs)
+  {
+    _s += rhs._s;
+    return *this;
+  }
+  friend String operator+(const String &lhs, const String &rhs) { return String(lhs._s + rhs._s); }
+  bool operator==(const String &rhs) const { return _s == rhs._s; }
+
+private:
+  std::string _s;
+};
+
+#endif // _HOST_WSTRING_H_
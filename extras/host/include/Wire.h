@@ -0,0 +1,49 @@
+/*
+ * Minimal Arduino Wire shim for host builds. Transmissions are not sent
+ * anywhere, only counted, so I2C traffic of a driver can be measured. A
+ * receiver set by a host test sees every byte as the device would.
+ */
+#ifndef _HOST_WIRE_H_
+#define _HOST_WIRE_H_
+
+#include <Arduino.h>
+
+#define I2C_BUFFER_LENGTH 128
+
+class TwoWire
+{
+public:
+  void begin() {}
+  void setClock(uint32_t) {}
+  void beginTransmission(uint8_t)
+  {
+    ++transmissions;
+    _first = true;
+  }
+  uint8_t endTransmission(bool = true) { return 0; }
+  size_t write(uint8_t d)
+  {
+    ++bytes_written;
+    if (receiver)
+    {
+      receiver(receiver_ctx, d, _first);
+    }
+    _first = false;
+    return 1;
+  }
+  uint8_t requestFrom(uint8_t, uint8_t) { return 0; }
+  int available() { return 0; }
+  int read() { return -1; }
+
+  uint32_t transmissions = 0;
+  uint32_t bytes_written = 0;
+  void (*receiver)(void *ctx, uint8_t d, bool first) = nullptr; ///< first is set for the first byte of a transmission
+  void *receiver_ctx = nullptr;
+
+private:
+  bool _first = false;
+};
+
+extern TwoWire Wire;
+
+#endif // _HOST_WIRE_H_
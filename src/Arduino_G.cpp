@@ -11,6 +11,47 @@ Arduino_G::Arduino_G(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h)
 {
 }
 
+void Arduino_G::draw16bitRGBBitmapRect(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h, int16_t rx, int16_t ry, int16_t rw, int16_t rh)
+{
+  if (rx < 0)
+  {
+    rw += rx;
+    rx = 0;
+  }
+  if (ry < 0)
+  {
+    rh += ry;
+    ry = 0;
+  }
+  if ((rx + rw) > w)
+  {
+    rw = w - rx;
+  }
+  if ((ry + rh) > h)
+  {
+    rh = h - ry;
+  }
+  if ((rw <= 0) || (rh <= 0))
+  {
+    return;
+  }
+
+  bitmap += ((int32_t)ry * w) + rx;
+  if (rw == w)
+  {
+    draw16bitRGBBitmap(x + rx, y + ry, bitmap, rw, rh);
+  }
+  else
+  {
+    // rows of the part are not contiguous in the bitmap
+    for (int16_t j = 0; j < rh; j++)
+    {
+      draw16bitRGBBitmap(x + rx, y + ry + j, bitmap, rw, 1);
+      bitmap += w;
+    }
+  }
+}
+
 // utility functions
 bool gfx_draw_bitmap_to_framebuffer(
     uint16_t *from_bitmap, int16_t bitmap_w, int16_t bitmap_h,
@@ -18,6 +18,11 @@ public:
   virtual void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) = 0;
   virtual void draw24bitRGBBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h) = 0;
 
+  // Sends the part rx, ry, rw, rh of a w x h bitmap drawn at x, y, e.g. the
+  // changed area of a canvas framebuffer. Displays with an address window
+  // grid grow the part to it, the extra pixels coming from the bitmap.
+  virtual void draw16bitRGBBitmapRect(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h, int16_t rx, int16_t ry, int16_t rw, int16_t rh);
+
 protected:
   int16_t
       WIDTH,  ///< This is the 'raw' display width - never changes
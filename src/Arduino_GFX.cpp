@@ -53,6 +53,15 @@ Arduino_GFX::Arduino_GFX(int16_t w, int16_t h) : Arduino_G(w, h)
 #endif // !defined(ATTINY_CORE)
 }
 
+Arduino_GFX::~Arduino_GFX()
+{
+  if (_isRoundMode)
+  {
+    free(_roundMinX);
+    free(_roundMaxX);
+  }
+}
+
 /**************************************************************************/
 /*!
   @brief  Write a line. Check straight or slash line and call corresponding function
@@ -175,6 +184,7 @@ void Arduino_GFX::writePixel(int16_t x, int16_t y, uint16_t color)
 /**************************************************************************/
 void Arduino_GFX::drawPixel(int16_t x, int16_t y, uint16_t color)
 {
+  GFX_STATS_SCOPE(GFX_STATS_PIXEL);
   startWrite();
   writePixel(x, y, color);
   endWrite();
@@ -329,6 +339,7 @@ GFX_INLINE void Arduino_GFX::endWrite()
 void Arduino_GFX::drawFastVLine(int16_t x, int16_t y,
                                 int16_t h, uint16_t color)
 {
+  GFX_STATS_SCOPE(GFX_STATS_VLINE);
   startWrite();
   writeFastVLine(x, y, h, color);
   endWrite();
@@ -346,6 +357,7 @@ void Arduino_GFX::drawFastVLine(int16_t x, int16_t y,
 void Arduino_GFX::drawFastHLine(int16_t x, int16_t y,
                                 int16_t w, uint16_t color)
 {
+  GFX_STATS_SCOPE(GFX_STATS_HLINE);
   startWrite();
   writeFastHLine(x, y, w, color);
   endWrite();
@@ -364,6 +376,7 @@ void Arduino_GFX::drawFastHLine(int16_t x, int16_t y,
 void Arduino_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
                            uint16_t color)
 {
+  GFX_STATS_SCOPE(GFX_STATS_FILL_RECT);
   startWrite();
   writeFillRect(x, y, w, h, color);
   endWrite();
@@ -377,6 +390,7 @@ void Arduino_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
 /**************************************************************************/
 void Arduino_GFX::fillScreen(uint16_t color)
 {
+  GFX_STATS_SCOPE(GFX_STATS_FILL_SCREEN);
   fillRect(0, 0, _width, _height, color);
 }
 
@@ -393,6 +407,7 @@ void Arduino_GFX::fillScreen(uint16_t color)
 void Arduino_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
                            uint16_t color)
 {
+  GFX_STATS_SCOPE(GFX_STATS_LINE);
   // Update in subclasses if desired!
   startWrite();
   writeLine(x0, y0, x1, y1, color);
@@ -411,6 +426,7 @@ void Arduino_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
 void Arduino_GFX::drawCircle(int16_t x, int16_t y,
                              int16_t r, uint16_t color)
 {
+  GFX_STATS_SCOPE(GFX_STATS_CIRCLE);
   startWrite();
   writeEllipseHelper(x, y, r, r, 0xf, color);
   endWrite();
@@ -519,6 +535,7 @@ void Arduino_GFX::writeEllipseHelper(int32_t x, int32_t y,
 void Arduino_GFX::fillCircle(int16_t x, int16_t y,
                              int16_t r, uint16_t color)
 {
+  GFX_STATS_SCOPE(GFX_STATS_FILL_CIRCLE);
   startWrite();
   writeFillEllipseHelper(x, y, r, r, 3, 0, color);
   endWrite();
@@ -618,6 +635,7 @@ void Arduino_GFX::writeFillEllipseHelper(int32_t x, int32_t y,
 /**************************************************************************/
 void Arduino_GFX::drawEllipse(int16_t x, int16_t y, int16_t rx, int16_t ry, uint16_t color)
 {
+  GFX_STATS_SCOPE(GFX_STATS_ELLIPSE);
   startWrite();
   writeEllipseHelper(x, y, rx, ry, 0xf, color);
   endWrite();
@@ -637,6 +655,7 @@ void Arduino_GFX::drawEllipse(int16_t x, int16_t y, int16_t rx, int16_t ry, uint
 /**************************************************************************/
 void Arduino_GFX::fillEllipse(int16_t x, int16_t y, int16_t rx, int16_t ry, uint16_t color)
 {
+  GFX_STATS_SCOPE(GFX_STATS_FILL_ELLIPSE);
   startWrite();
   writeFillEllipseHelper(x, y, rx, ry, 3, 0, color);
   endWrite();
@@ -656,6 +675,7 @@ void Arduino_GFX::fillEllipse(int16_t x, int16_t y, int16_t rx, int16_t ry, uint
 /**************************************************************************/
 void Arduino_GFX::drawArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float start, float end, uint16_t color)
 {
+  GFX_STATS_SCOPE(GFX_STATS_ARC);
   if (r1 < r2)
   {
     _swap_int16_t(r1, r2);
@@ -703,6 +723,7 @@ void Arduino_GFX::drawArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float st
 /**************************************************************************/
 void Arduino_GFX::fillArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float start, float end, uint16_t color)
 {
+  GFX_STATS_SCOPE(GFX_STATS_FILL_ARC);
   if (r1 < r2)
   {
     _swap_int16_t(r1, r2);
@@ -852,6 +873,7 @@ void Arduino_GFX::writeFillArcHelper(int16_t cx, int16_t cy, int16_t oradius, in
 void Arduino_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
                            uint16_t color)
 {
+  GFX_STATS_SCOPE(GFX_STATS_RECT);
   startWrite();
   writeFastHLine(x, y, w, color);
   writeFastHLine(x, y + h - 1, w, color);
@@ -874,6 +896,7 @@ void Arduino_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
 void Arduino_GFX::drawRoundRect(int16_t x, int16_t y, int16_t w,
                                 int16_t h, int16_t r, uint16_t color)
 {
+  GFX_STATS_SCOPE(GFX_STATS_ROUND_RECT);
   int16_t max_radius = ((w < h) ? w : h) / 2; // 1/2 minor axis
   if (r > max_radius)
     r = max_radius;
@@ -905,6 +928,7 @@ void Arduino_GFX::drawRoundRect(int16_t x, int16_t y, int16_t w,
 void Arduino_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w,
                                 int16_t h, int16_t r, uint16_t color)
 {
+  GFX_STATS_SCOPE(GFX_STATS_FILL_ROUND_RECT);
   int16_t max_radius = ((w < h) ? w : h) / 2; // 1/2 minor axis
   if (r > max_radius)
     r = max_radius;
@@ -932,6 +956,7 @@ void Arduino_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w,
 void Arduino_GFX::drawTriangle(int16_t x0, int16_t y0,
                                int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color)
 {
+  GFX_STATS_SCOPE(GFX_STATS_TRIANGLE);
   startWrite();
   writeLine(x0, y0, x1, y1, color);
   writeLine(x1, y1, x2, y2, color);
@@ -954,6 +979,7 @@ void Arduino_GFX::drawTriangle(int16_t x0, int16_t y0,
 void Arduino_GFX::fillTriangle(int16_t x0, int16_t y0,
                                int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color)
 {
+  GFX_STATS_SCOPE(GFX_STATS_FILL_TRIANGLE);
   int16_t a, b, y, last;
 
   // Sort coordinates by Y order (y2 >= y1 >= y0)
@@ -1072,6 +1098,7 @@ void Arduino_GFX::fillTriangle(int16_t x0, int16_t y0,
 void Arduino_GFX::drawBitmap(int16_t x, int16_t y,
                              const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
   uint8_t byte = 0;
 
@@ -1113,6 +1140,7 @@ void Arduino_GFX::drawBitmap(int16_t x, int16_t y,
                              const uint8_t bitmap[], int16_t w, int16_t h,
                              uint16_t color, uint16_t bg)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
   uint8_t byte = 0;
 
@@ -1149,6 +1177,7 @@ void Arduino_GFX::drawBitmap(int16_t x, int16_t y,
 void Arduino_GFX::drawBitmap(int16_t x, int16_t y,
                              uint8_t *bitmap, int16_t w, int16_t h, uint16_t color)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
   uint8_t byte = 0;
 
@@ -1189,6 +1218,7 @@ void Arduino_GFX::drawBitmap(int16_t x, int16_t y,
 void Arduino_GFX::drawBitmap(int16_t x, int16_t y,
                              uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
   uint8_t byte = 0;
 
@@ -1229,6 +1259,7 @@ void Arduino_GFX::drawBitmap(int16_t x, int16_t y,
 void Arduino_GFX::drawXBitmap(int16_t x, int16_t y,
                               const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
   uint8_t byte = 0;
 
@@ -1269,6 +1300,7 @@ void Arduino_GFX::drawXBitmap(int16_t x, int16_t y,
 void Arduino_GFX::drawGrayscaleBitmap(int16_t x, int16_t y,
                                       const uint8_t bitmap[], int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   uint8_t v;
   startWrite();
   for (int16_t j = 0; j < h; j++, y++)
@@ -1295,6 +1327,7 @@ void Arduino_GFX::drawGrayscaleBitmap(int16_t x, int16_t y,
 void Arduino_GFX::drawGrayscaleBitmap(int16_t x, int16_t y,
                                       uint8_t *bitmap, int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   uint8_t v;
   startWrite();
   for (int16_t j = 0; j < h; j++, y++)
@@ -1325,6 +1358,7 @@ void Arduino_GFX::drawGrayscaleBitmap(int16_t x, int16_t y,
                                       const uint8_t bitmap[], const uint8_t mask[],
                                       int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   int16_t bw = (w + 7) / 8; // Bitmask scanline pad = whole byte
   uint8_t byte = 0;
   uint8_t v;
@@ -1367,6 +1401,7 @@ void Arduino_GFX::drawGrayscaleBitmap(int16_t x, int16_t y,
 void Arduino_GFX::drawGrayscaleBitmap(int16_t x, int16_t y,
                                       uint8_t *bitmap, uint8_t *mask, int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   int16_t bw = (w + 7) / 8; // Bitmask scanline pad = whole byte
   uint8_t byte = 0;
   uint8_t v;
@@ -1409,6 +1444,7 @@ void Arduino_GFX::drawIndexedBitmap(
     int16_t x, int16_t y,
     uint8_t *bitmap, uint16_t *color_index, int16_t w, int16_t h, int16_t x_skip)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   int32_t offset = 0;
   startWrite();
   for (int16_t j = 0; j < h; j++, y++)
@@ -1439,6 +1475,7 @@ void Arduino_GFX::drawIndexedBitmap(
     int16_t x, int16_t y,
     uint8_t *bitmap, uint16_t *color_index, uint8_t chroma_key, int16_t w, int16_t h, int16_t x_skip)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   int32_t offset = 0;
   uint8_t color_key;
   startWrite();
@@ -1470,6 +1507,7 @@ void Arduino_GFX::drawIndexedBitmap(
 void Arduino_GFX::draw3bitRGBBitmap(int16_t x, int16_t y,
                                     uint8_t *bitmap, int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   int32_t offset = 0, idx = 0;
   uint8_t c = 0;
   uint16_t d;
@@ -1511,6 +1549,7 @@ void Arduino_GFX::draw3bitRGBBitmap(int16_t x, int16_t y,
 void Arduino_GFX::draw16bitRGBBitmap(int16_t x, int16_t y,
                                      const uint16_t bitmap[], int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   int32_t offset = 0;
   startWrite();
   for (int16_t j = 0; j < h; j++, y++)
@@ -1536,6 +1575,7 @@ void Arduino_GFX::draw16bitRGBBitmap(int16_t x, int16_t y,
 void Arduino_GFX::draw16bitRGBBitmap(int16_t x, int16_t y,
                                      uint16_t *bitmap, int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   int32_t offset = 0;
   startWrite();
   for (int16_t j = 0; j < h; j++, y++)
@@ -1563,6 +1603,7 @@ void Arduino_GFX::draw16bitRGBBitmapWithTranColor(
     int16_t x, int16_t y,
     uint16_t *bitmap, uint16_t transparent_color, int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   int32_t offset = 0;
   uint16_t color;
   startWrite();
@@ -1593,6 +1634,7 @@ void Arduino_GFX::draw16bitRGBBitmapWithTranColor(
 void Arduino_GFX::draw16bitBeRGBBitmap(int16_t x, int16_t y,
                                        uint16_t *bitmap, int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   int32_t offset = 0;
   uint16_t p;
   startWrite();
@@ -1625,6 +1667,7 @@ void Arduino_GFX::draw16bitRGBBitmapWithMask(int16_t x, int16_t y,
                                              const uint16_t bitmap[], const uint8_t mask[],
                                              int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   int32_t offset = 0;
   int16_t bw = (w + 7) / 8; // Bitmask scanline pad = whole byte
   uint8_t byte = 0;
@@ -1667,6 +1710,7 @@ void Arduino_GFX::draw16bitRGBBitmapWithMask(int16_t x, int16_t y,
 void Arduino_GFX::draw16bitRGBBitmapWithMask(int16_t x, int16_t y,
                                              uint16_t *bitmap, uint8_t *mask, int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   int32_t offset = 0, maskIdx = 0;
   uint8_t byte = 0;
   startWrite();
@@ -1705,6 +1749,7 @@ void Arduino_GFX::draw16bitRGBBitmapWithMask(int16_t x, int16_t y,
 void Arduino_GFX::draw24bitRGBBitmap(int16_t x, int16_t y,
                                      const uint8_t bitmap[], int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   int32_t offset = 0;
   startWrite();
   for (int16_t j = 0; j < h; j++, y++)
@@ -1731,6 +1776,7 @@ void Arduino_GFX::draw24bitRGBBitmap(int16_t x, int16_t y,
 void Arduino_GFX::draw24bitRGBBitmap(int16_t x, int16_t y,
                                      uint8_t *bitmap, int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   int32_t offset = 0;
   startWrite();
   for (int16_t j = 0; j < h; j++, y++)
@@ -1761,6 +1807,7 @@ void Arduino_GFX::draw24bitRGBBitmap(int16_t x, int16_t y,
                                      const uint8_t bitmap[], const uint8_t mask[],
                                      int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   int32_t offset = 0;
   int16_t bw = (w + 7) / 8; // Bitmask scanline pad = whole byte
   uint8_t byte = 0;
@@ -1803,6 +1850,7 @@ void Arduino_GFX::draw24bitRGBBitmap(int16_t x, int16_t y,
 void Arduino_GFX::draw24bitRGBBitmap(int16_t x, int16_t y,
                                      uint8_t *bitmap, uint8_t *mask, int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   int32_t offset = 0;
   int16_t bw = (w + 7) / 8; // Bitmask scanline pad = whole byte
   uint8_t byte = 0;
@@ -1993,6 +2041,7 @@ void Arduino_GFX::u8g2_font_decode_len(uint8_t len, uint8_t is_foreground, uint1
 void Arduino_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
                            uint16_t color, uint16_t bg)
 {
+  GFX_STATS_SCOPE(GFX_STATS_CHAR);
   int16_t block_w, block_h, curX, curY, curW, curH;
 
 #if !defined(ATTINY_CORE)
@@ -2255,6 +2304,7 @@ void Arduino_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
 /**************************************************************************/
 size_t Arduino_GFX::write(uint8_t c)
 {
+  GFX_STATS_SCOPE(GFX_STATS_CHAR);
 #if !defined(ATTINY_CORE)
   if (gfxFont) // custom font
   {
@@ -3019,6 +3069,10 @@ bool Arduino_GFX::enableRoundMode()
   {
     return false;
   }
+  else if (_isRoundMode)
+  {
+    return true;
+  }
   else
   {
     // startWrite();
@@ -7,6 +7,7 @@
 
 #include "Arduino_G.h"
 #include "Arduino_DataBus.h"
+#include "Arduino_GFX_Stats.h"
 #include <Print.h>
 
 #if !defined(ATTINY_CORE)
@@ -139,6 +140,7 @@
 #if !defined(ATTINY_CORE)
 GFX_INLINE GFXglyph *pgm_read_glyph_ptr(const GFXfont *gfxFont, uint8_t c)
 {
+  GFX_STATS_COUNT(glyph_lookups);
 #ifdef __AVR__
   return &(((GFXglyph *)pgm_read_pointer(&gfxFont->glyph))[c]);
 #else
@@ -171,6 +173,7 @@ class Arduino_GFX : public Print, public Arduino_G
 {
 public:
   Arduino_GFX(int16_t w, int16_t h); // Constructor
+  ~Arduino_GFX();
 
   // This MUST be defined by the subclass:
   virtual bool begin(int32_t speed = GFX_NOT_DEFINED) = 0;
@@ -251,6 +254,13 @@ public:
   virtual void fillArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float start, float end, uint16_t color);
   virtual void writeFillArcHelper(int16_t cx, int16_t cy, int16_t oradius, int16_t iradius, float start, float end, uint16_t color);
 
+#if defined(ARDUINO_GFX_STATS)
+  // counters are shared by all displays, canvases and Arduino_StatsBus instances
+  static gfx_stats_t getStats(bool reset = false);
+  static void resetStats();
+  static void printStats(Print *out, const gfx_stats_t *s);
+#endif // defined(ARDUINO_GFX_STATS)
+
 // TFT optimization code, too big for ATMEL family
 #if defined(LITTLE_FOOT_PRINT)
   void writeSlashLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
@@ -478,6 +488,21 @@ protected:
   bool _isRoundMode = false;
   int16_t *_roundMinX;
   int16_t *_roundMaxX;
+
+  // Round mode: clips the span *x1..*x2 of row (or, the circle being
+  // symmetric, column) v to the visible circle, false when none is left
+  bool clipRoundSpan(int16_t v, int16_t *x1, int16_t *x2)
+  {
+    if (*x1 < _roundMinX[v])
+    {
+      *x1 = _roundMinX[v];
+    }
+    if (*x2 > _roundMaxX[v])
+    {
+      *x2 = _roundMaxX[v];
+    }
+    return *x1 <= *x2;
+  }
 };
 
 #endif // _ARDUINO_GFX_H_
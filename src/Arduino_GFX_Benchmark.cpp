@@ -0,0 +1,438 @@
+#include "Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#include "Arduino_GFX.h"
+#include "Arduino_GFX_Benchmark.h"
+
+static const char *gfx_bench_primitive_names[GFX_BENCH_PRIMITIVE_COUNT] = {
+    "pixel",
+    "hline",
+    "vline",
+    "line",
+    "rect",
+    "fill_rect",
+    "circle",
+    "fill_circle",
+    "fill_triangle",
+    "fill_round_rect",
+    "bitmap_16bit",
+    "text",
+    "text_bg",
+    "fill_screen",
+};
+
+static const int16_t gfx_bench_default_sizes[] = {8, 32, 128};
+
+static const gfx_bench_font_t gfx_bench_default_fonts[] = {
+    {"glcd", nullptr, 1},
+    {"glcd_x2", nullptr, 2},
+};
+
+static const char gfx_bench_text[] = "Hello World!";
+
+Arduino_GFX_Benchmark::Arduino_GFX_Benchmark(Print *out, uint8_t format)
+    : _out(out), _format(format),
+      _warmup(GFX_BENCH_DEFAULT_WARMUP),
+      _min_iterations(GFX_BENCH_DEFAULT_MIN_ITERATIONS),
+      _min_time_us(GFX_BENCH_DEFAULT_MIN_TIME_US),
+      _rotation_mask(0b0001),
+      _bus_bytes(nullptr), _bus_bytes_ctx(nullptr),
+      _bitmap(nullptr), _bitmap_size(0)
+{
+  setSizes(gfx_bench_default_sizes, sizeof(gfx_bench_default_sizes) / sizeof(gfx_bench_default_sizes[0]));
+  setFonts(gfx_bench_default_fonts, sizeof(gfx_bench_default_fonts) / sizeof(gfx_bench_default_fonts[0]));
+}
+
+/**************************************************************************/
+/*!
+   @brief  Set how every measurement is taken. The primitive is first
+           called warmup times untimed, then timed in doubling batches
+           (starting at min_iterations calls) until min_time_us elapsed.
+           Keep these fixed when comparing builds.
+*/
+/**************************************************************************/
+void Arduino_GFX_Benchmark::setIterationPolicy(uint8_t warmup, uint32_t min_iterations, uint32_t min_time_us)
+{
+  _warmup = warmup;
+  _min_iterations = min_iterations ? min_iterations : 1;
+  _min_time_us = min_time_us;
+}
+
+void Arduino_GFX_Benchmark::setSizes(const int16_t *sizes, uint8_t count)
+{
+  if (count > GFX_BENCH_MAX_SIZES)
+  {
+    count = GFX_BENCH_MAX_SIZES;
+  }
+  for (uint8_t i = 0; i < count; ++i)
+  {
+    _sizes[i] = sizes[i];
+  }
+  _size_count = count;
+}
+
+/**************************************************************************/
+/*!
+   @brief  Select the rotations to run, bit n set means rotation n
+*/
+/**************************************************************************/
+void Arduino_GFX_Benchmark::setRotations(uint8_t rotation_mask)
+{
+  _rotation_mask = rotation_mask & 0b1111;
+}
+
+void Arduino_GFX_Benchmark::setFonts(const gfx_bench_font_t *fonts, uint8_t count)
+{
+  if (count > GFX_BENCH_MAX_FONTS)
+  {
+    count = GFX_BENCH_MAX_FONTS;
+  }
+  for (uint8_t i = 0; i < count; ++i)
+  {
+    _fonts[i] = fonts[i];
+  }
+  _font_count = count;
+}
+
+/**************************************************************************/
+/*!
+   @brief  Report bus bytes per operation using counter, which must return
+           a running total of bytes sent over the bus
+*/
+/**************************************************************************/
+void Arduino_GFX_Benchmark::setBusByteCounter(gfx_bench_bus_bytes_t counter, void *ctx)
+{
+  _bus_bytes = counter;
+  _bus_bytes_ctx = ctx;
+}
+
+void Arduino_GFX_Benchmark::begin()
+{
+  if (_format == GFX_BENCH_CSV)
+  {
+    _out->println("target,primitive,size,rotation,font,iterations,ns_per_op,pixels_per_s,bus_bytes_per_op");
+  }
+}
+
+void Arduino_GFX_Benchmark::end()
+{
+  if (_bitmap)
+  {
+    free(_bitmap);
+    _bitmap = nullptr;
+    _bitmap_size = 0;
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief  Run the full primitive x size x rotation x font matrix on gfx.
+           Text settings and rotation of gfx are changed while running,
+           rotation is restored afterwards.
+*/
+/**************************************************************************/
+void Arduino_GFX_Benchmark::run(const char *target, Arduino_GFX *gfx)
+{
+  uint8_t saved_rotation = gfx->getRotation();
+  for (uint8_t r = 0; r < 4; ++r)
+  {
+    if (!(_rotation_mask & (1 << r)))
+    {
+      continue;
+    }
+    gfx->setRotation(r);
+    for (uint8_t p = 0; p < GFX_BENCH_PRIMITIVE_COUNT; ++p)
+    {
+      gfx_bench_primitive_t primitive = (gfx_bench_primitive_t)p;
+      switch (primitive)
+      {
+      case GFX_BENCH_PIXEL:
+      case GFX_BENCH_FILL_SCREEN:
+        runPrimitive(target, gfx, primitive, 0, nullptr);
+        break;
+      case GFX_BENCH_TEXT:
+      case GFX_BENCH_TEXT_BG:
+        for (uint8_t f = 0; f < _font_count; ++f)
+        {
+          runPrimitive(target, gfx, primitive, 0, &_fonts[f]);
+        }
+        break;
+      default:
+        for (uint8_t s = 0; s < _size_count; ++s)
+        {
+          runPrimitive(target, gfx, primitive, _sizes[s], nullptr);
+        }
+      }
+    }
+  }
+  gfx->setRotation(saved_rotation);
+}
+
+void Arduino_GFX_Benchmark::runPrimitive(const char *target, Arduino_GFX *gfx, gfx_bench_primitive_t primitive, int16_t size, const gfx_bench_font_t *font)
+{
+  if ((size > gfx->width()) || (size > gfx->height()))
+  {
+    return;
+  }
+
+  if (primitive == GFX_BENCH_BITMAP_16BIT)
+  {
+    if (size > _bitmap_size)
+    {
+      if (_bitmap)
+      {
+        free(_bitmap);
+      }
+      _bitmap = (uint16_t *)malloc((int32_t)size * size * 2);
+      if (!_bitmap)
+      {
+        _bitmap_size = 0;
+        return;
+      }
+      _bitmap_size = size;
+      for (int32_t i = 0; i < (int32_t)size * size; ++i)
+      {
+        _bitmap[i] = i * 0x0841;
+      }
+    }
+  }
+
+  if (font)
+  {
+    gfx->setFont(font->font);
+    gfx->setTextSize(font->text_size);
+    gfx->setTextWrap(false);
+  }
+
+  uint32_t pixels = 0;
+  for (uint8_t i = 0; i < _warmup; ++i)
+  {
+    pixels = drawPrimitive(gfx, primitive, size, i);
+  }
+
+  uint32_t iterations = 0;
+  uint32_t batch = _min_iterations;
+  uint64_t bytes = busBytes();
+  uint32_t start = micros();
+  uint32_t elapsed;
+  while (true)
+  {
+    for (uint32_t i = 0; i < batch; ++i)
+    {
+      pixels = drawPrimitive(gfx, primitive, size, iterations + i);
+    }
+    iterations += batch;
+    elapsed = micros() - start;
+    if (elapsed >= _min_time_us)
+    {
+      break;
+    }
+    batch = iterations;
+  }
+
+  gfx_bench_result_t r;
+  r.target = target;
+  r.primitive = primitiveName(primitive);
+  r.size = size;
+  r.rotation = gfx->getRotation();
+  r.font = font ? font->name : "";
+  r.iterations = iterations;
+  r.elapsed_us = elapsed;
+  r.pixels_per_op = pixels;
+  r.bus_bytes = busBytes() - bytes;
+  report(&r);
+}
+
+/**************************************************************************/
+/*!
+   @brief  Time flush() of a canvas, the whole framebuffer is sent every
+           call
+*/
+/**************************************************************************/
+void Arduino_GFX_Benchmark::runFlush(const char *target, Arduino_GFX *canvas)
+{
+  for (uint8_t i = 0; i < _warmup; ++i)
+  {
+    canvas->flush();
+  }
+
+  uint32_t iterations = 0;
+  uint32_t batch = _min_iterations;
+  uint64_t bytes = busBytes();
+  uint32_t start = micros();
+  uint32_t elapsed;
+  while (true)
+  {
+    for (uint32_t i = 0; i < batch; ++i)
+    {
+      canvas->flush();
+    }
+    iterations += batch;
+    elapsed = micros() - start;
+    if (elapsed >= _min_time_us)
+    {
+      break;
+    }
+    batch = iterations;
+  }
+
+  gfx_bench_result_t r;
+  r.target = target;
+  r.primitive = "flush";
+  r.size = 0;
+  r.rotation = canvas->getRotation();
+  r.font = "";
+  r.iterations = iterations;
+  r.elapsed_us = elapsed;
+  r.pixels_per_op = (uint32_t)canvas->width() * canvas->height();
+  r.bus_bytes = busBytes() - bytes;
+  report(&r);
+}
+
+const char *Arduino_GFX_Benchmark::primitiveName(gfx_bench_primitive_t primitive)
+{
+  return (primitive < GFX_BENCH_PRIMITIVE_COUNT) ? gfx_bench_primitive_names[primitive] : "unknown";
+}
+
+// draws one instance of primitive at a position derived from i, returns the
+// number of pixels it covers
+uint32_t Arduino_GFX_Benchmark::drawPrimitive(Arduino_GFX *gfx, gfx_bench_primitive_t primitive, int16_t size, uint32_t i)
+{
+  int16_t w = gfx->width();
+  int16_t h = gfx->height();
+  int16_t span = size ? size : 1;
+  int16_t x = (i * 7) % (w - span + 1);
+  int16_t y = (i * 13) % (h - span + 1);
+  uint16_t color = i * 0x1111;
+  int16_t r = size / 2;
+
+  switch (primitive)
+  {
+  case GFX_BENCH_PIXEL:
+    gfx->drawPixel(x, y, color);
+    return 1;
+  case GFX_BENCH_HLINE:
+    gfx->drawFastHLine(x, y, size, color);
+    return size;
+  case GFX_BENCH_VLINE:
+    gfx->drawFastVLine(x, y, size, color);
+    return size;
+  case GFX_BENCH_LINE:
+    gfx->drawLine(x, y, x + size - 1, y + r, color);
+    return size;
+  case GFX_BENCH_RECT:
+    gfx->drawRect(x, y, size, size, color);
+    return (size > 1) ? ((uint32_t)size * 4 - 4) : size;
+  case GFX_BENCH_FILL_RECT:
+    gfx->fillRect(x, y, size, size, color);
+    return (uint32_t)size * size;
+  case GFX_BENCH_CIRCLE:
+    gfx->drawCircle(x + r, y + r, r, color);
+    return (uint32_t)size * 355 / 113;
+  case GFX_BENCH_FILL_CIRCLE:
+    gfx->fillCircle(x + r, y + r, r, color);
+    return (uint32_t)size * size * 355 / 452;
+  case GFX_BENCH_FILL_TRIANGLE:
+    gfx->fillTriangle(x, y + size - 1, x + r, y, x + size - 1, y + size - 1, color);
+    return (uint32_t)size * size / 2;
+  case GFX_BENCH_FILL_ROUND_RECT:
+    gfx->fillRoundRect(x, y, size, size, size / 4, color);
+    return (uint32_t)size * size;
+  case GFX_BENCH_BITMAP_16BIT:
+    gfx->draw16bitRGBBitmap(x, y, _bitmap, size, size);
+    return (uint32_t)size * size;
+  case GFX_BENCH_TEXT:
+  case GFX_BENCH_TEXT_BG:
+  {
+    int16_t x1, y1;
+    uint16_t tw, th;
+    gfx->getTextBounds(gfx_bench_text, 0, 0, &x1, &y1, &tw, &th);
+    x = (i * 7) % ((w > (int16_t)tw) ? (w - tw) : 1);
+    y = (i * 13) % ((h > (int16_t)th) ? (h - th) : 1);
+    if (primitive == GFX_BENCH_TEXT)
+    {
+      gfx->setTextColor(color);
+    }
+    else
+    {
+      gfx->setTextColor(color, ~color);
+    }
+    gfx->setCursor(x - x1, y - y1);
+    gfx->print(gfx_bench_text);
+    return (uint32_t)tw * th;
+  }
+  case GFX_BENCH_FILL_SCREEN:
+    gfx->fillScreen(color);
+    return (uint32_t)w * h;
+  default:
+    return 0;
+  }
+}
+
+uint64_t Arduino_GFX_Benchmark::busBytes()
+{
+  return _bus_bytes ? _bus_bytes(_bus_bytes_ctx) : 0;
+}
+
+void Arduino_GFX_Benchmark::report(const gfx_bench_result_t *r)
+{
+  double ns_per_op = (double)r->elapsed_us * 1000 / r->iterations;
+  double pixels_per_s = r->elapsed_us ? ((double)r->pixels_per_op * r->iterations * 1000000 / r->elapsed_us) : 0;
+  double bus_bytes_per_op = (double)r->bus_bytes / r->iterations;
+
+  if (_format == GFX_BENCH_JSON)
+  {
+    _out->print("{\"target\":\"");
+    _out->print(r->target);
+    _out->print("\",\"primitive\":\"");
+    _out->print(r->primitive);
+    _out->print("\",\"size\":");
+    _out->print(r->size);
+    _out->print(",\"rotation\":");
+    _out->print(r->rotation);
+    _out->print(",\"font\":\"");
+    _out->print(r->font);
+    _out->print("\",\"iterations\":");
+    _out->print(r->iterations);
+    _out->print(",\"ns_per_op\":");
+    _out->print(ns_per_op, 1);
+    _out->print(",\"pixels_per_s\":");
+    _out->print(pixels_per_s, 0);
+    _out->print(",\"bus_bytes_per_op\":");
+    if (_bus_bytes)
+    {
+      _out->print(bus_bytes_per_op, 1);
+    }
+    else
+    {
+      _out->print("null");
+    }
+    _out->println("}");
+  }
+  else
+  {
+    _out->print(r->target);
+    _out->print(',');
+    _out->print(r->primitive);
+    _out->print(',');
+    _out->print(r->size);
+    _out->print(',');
+    _out->print(r->rotation);
+    _out->print(',');
+    _out->print(r->font);
+    _out->print(',');
+    _out->print(r->iterations);
+    _out->print(',');
+    _out->print(ns_per_op, 1);
+    _out->print(',');
+    _out->print(pixels_per_s, 0);
+    _out->print(',');
+    if (_bus_bytes)
+    {
+      _out->print(bus_bytes_per_op, 1);
+    }
+    _out->println();
+  }
+}
+
+#endif // !defined(LITTLE_FOOT_PRINT)
@@ -0,0 +1,111 @@
+/*
+ * Structured benchmark of drawing primitives and canvas flushes, derived
+ * from the PDQgraphicstest sequence. Results are printed as CSV or JSON
+ * lines so they can be compared between builds; the same harness runs on
+ * target (output to Serial) and in the host build (output to stdout).
+ */
+#include "Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#ifndef _ARDUINO_GFX_BENCHMARK_H_
+#define _ARDUINO_GFX_BENCHMARK_H_
+
+#include "Arduino_GFX.h"
+
+#define GFX_BENCH_CSV 0
+#define GFX_BENCH_JSON 1 // one JSON object per line
+
+#define GFX_BENCH_DEFAULT_WARMUP 3           // untimed calls before every measurement
+#define GFX_BENCH_DEFAULT_MIN_ITERATIONS 16  // never time fewer calls than this
+#define GFX_BENCH_DEFAULT_MIN_TIME_US 100000 // keep calling until this much time has passed
+
+#define GFX_BENCH_MAX_SIZES 4
+#define GFX_BENCH_MAX_FONTS 4
+
+typedef enum
+{
+  GFX_BENCH_PIXEL,
+  GFX_BENCH_HLINE,
+  GFX_BENCH_VLINE,
+  GFX_BENCH_LINE,
+  GFX_BENCH_RECT,
+  GFX_BENCH_FILL_RECT,
+  GFX_BENCH_CIRCLE,
+  GFX_BENCH_FILL_CIRCLE,
+  GFX_BENCH_FILL_TRIANGLE,
+  GFX_BENCH_FILL_ROUND_RECT,
+  GFX_BENCH_BITMAP_16BIT,
+  GFX_BENCH_TEXT,
+  GFX_BENCH_TEXT_BG,
+  GFX_BENCH_FILL_SCREEN,
+  GFX_BENCH_PRIMITIVE_COUNT
+} gfx_bench_primitive_t;
+
+// returns the running total of bytes put on the bus, e.g. from a counting bus
+typedef uint64_t (*gfx_bench_bus_bytes_t)(void *ctx);
+
+typedef struct
+{
+  const char *name;
+  const GFXfont *font; // nullptr for the built-in 5x7 font
+  uint8_t text_size;
+} gfx_bench_font_t;
+
+typedef struct
+{
+  const char *target;
+  const char *primitive;
+  int16_t size;
+  uint8_t rotation;
+  const char *font;
+  uint32_t iterations;
+  uint32_t elapsed_us;
+  uint32_t pixels_per_op;
+  uint64_t bus_bytes; // total over all iterations, 0 if not counted
+} gfx_bench_result_t;
+
+class Arduino_GFX_Benchmark
+{
+public:
+  Arduino_GFX_Benchmark(Print *out, uint8_t format = GFX_BENCH_CSV);
+
+  void setIterationPolicy(uint8_t warmup, uint32_t min_iterations, uint32_t min_time_us);
+  void setSizes(const int16_t *sizes, uint8_t count);
+  void setRotations(uint8_t rotation_mask);
+  void setFonts(const gfx_bench_font_t *fonts, uint8_t count);
+  void setBusByteCounter(gfx_bench_bus_bytes_t counter, void *ctx);
+
+  void begin();
+  void run(const char *target, Arduino_GFX *gfx);
+  void runPrimitive(const char *target, Arduino_GFX *gfx, gfx_bench_primitive_t primitive, int16_t size, const gfx_bench_font_t *font);
+  void runFlush(const char *target, Arduino_GFX *canvas);
+  void end();
+
+  static const char *primitiveName(gfx_bench_primitive_t primitive);
+
+protected:
+  uint32_t drawPrimitive(Arduino_GFX *gfx, gfx_bench_primitive_t primitive, int16_t size, uint32_t i);
+  uint64_t busBytes();
+  void report(const gfx_bench_result_t *r);
+
+  Print *_out;
+  uint8_t _format;
+  uint8_t _warmup;
+  uint32_t _min_iterations;
+  uint32_t _min_time_us;
+  int16_t _sizes[GFX_BENCH_MAX_SIZES];
+  uint8_t _size_count;
+  uint8_t _rotation_mask;
+  gfx_bench_font_t _fonts[GFX_BENCH_MAX_FONTS];
+  uint8_t _font_count;
+  gfx_bench_bus_bytes_t _bus_bytes;
+  void *_bus_bytes_ctx;
+  uint16_t *_bitmap;
+  int16_t _bitmap_size;
+
+private:
+};
+
+#endif // _ARDUINO_GFX_BENCHMARK_H_
+
+#endif // !defined(LITTLE_FOOT_PRINT)
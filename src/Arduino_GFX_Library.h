@@ -34,6 +34,7 @@
 #include "databus/Arduino_STM32PAR8.h"
 #include "databus/Arduino_SWPAR8.h"
 #include "databus/Arduino_SWPAR16.h"
+#include "databus/Arduino_StatsBus.h"
 #include "databus/Arduino_SWSPI.h"
 #include "databus/Arduino_Wire.h"
 #include "databus/Arduino_XL9535SWSPI.h"
@@ -42,10 +43,15 @@
 
 #include "Arduino_GFX.h" // Core graphics library
 #if !defined(LITTLE_FOOT_PRINT)
+#include "Arduino_GFX_Benchmark.h"
+#include "Arduino_GFX_TESync.h"
 #include "canvas/Arduino_Canvas.h"
 #include "canvas/Arduino_Canvas_Indexed.h"
 #include "canvas/Arduino_Canvas_3bit.h"
 #include "canvas/Arduino_Canvas_Mono.h"
+#include "canvas/Arduino_Canvas_RGB332.h"
+#include "canvas/Arduino_Canvas_Packed.h"
+#include "canvas/Arduino_Canvas_24bit.h"
 #include "display/Arduino_ILI9488_3bit.h"
 #endif // !defined(LITTLE_FOOT_PRINT)
 
@@ -93,6 +99,8 @@
 #include "display/Arduino_ST7796.h"
 #include "display/Arduino_WEA2012.h"
 
+#include "Arduino_TFT_Bound.h"
+
 #if defined(ARDUINO_ARCH_SAMD) && defined(SEEED_GROVE_UI_WIRELESS)
 #define DISPLAY_DEV_KIT
 #define WIO_TERMINAL
@@ -0,0 +1,136 @@
+#include "Arduino_DataBus.h"
+#include "Arduino_GFX.h"
+
+#if defined(ARDUINO_GFX_STATS) || defined(ARDUINO_GFX_TRACE)
+
+static const char *gfx_stats_primitive_names[GFX_STATS_PRIMITIVE_COUNT] = {
+    "other",
+    "pixel",
+    "hline",
+    "vline",
+    "line",
+    "rect",
+    "fill_rect",
+    "fill_screen",
+    "circle",
+    "fill_circle",
+    "ellipse",
+    "fill_ellipse",
+    "arc",
+    "fill_arc",
+    "triangle",
+    "fill_triangle",
+    "round_rect",
+    "fill_round_rect",
+    "bitmap",
+    "char",
+    "flush",
+};
+
+const char *gfx_stats_primitive_name(uint8_t primitive)
+{
+  return (primitive < GFX_STATS_PRIMITIVE_COUNT) ? gfx_stats_primitive_names[primitive] : "unknown";
+}
+
+#endif // defined(ARDUINO_GFX_STATS) || defined(ARDUINO_GFX_TRACE)
+
+#if defined(ARDUINO_GFX_STATS)
+
+gfx_stats_t gfx_stats;
+uint8_t gfx_stats_depth = 0;
+uint8_t gfx_stats_current = GFX_STATS_OTHER;
+
+/**************************************************************************/
+/*!
+   @brief  Take a snapshot of the counters of all displays, canvases and
+           Arduino_StatsBus instances
+   @param  reset  Clear the counters after taking the snapshot
+*/
+/**************************************************************************/
+gfx_stats_t Arduino_GFX::getStats(bool reset)
+{
+  gfx_stats_t s = gfx_stats;
+  if (reset)
+  {
+    resetStats();
+  }
+  return s;
+}
+
+void Arduino_GFX::resetStats()
+{
+  memset(&gfx_stats, 0, sizeof(gfx_stats));
+#if defined(GFX_STATS_DWT_CYCCNT)
+  *(volatile uint32_t *)0xE000EDFC |= (1UL << 24); // CoreDebug->DEMCR TRCENA
+  *(volatile uint32_t *)0xE0001000 |= 1UL;         // DWT->CTRL CYCCNTENA
+#endif
+}
+
+// Print has no long long overloads on every core (not on AVR), so 64-bit
+// counters go out in parts of nine decimal digits
+static void gfx_stats_print_u64(Print *out, uint64_t v)
+{
+  if (v >= 1000000000ULL)
+  {
+    gfx_stats_print_u64(out, v / 1000000000ULL);
+    uint32_t low = (uint32_t)(v % 1000000000ULL);
+    for (uint32_t d = 100000000UL; (d > 1) && (low < d); d /= 10)
+    {
+      out->print('0');
+    }
+    out->print((unsigned long)low);
+  }
+  else
+  {
+    out->print((unsigned long)v);
+  }
+}
+
+static void gfx_stats_print_counter(Print *out, const char *name, const gfx_stats_counter_t *c)
+{
+  out->print(name);
+  out->print(F(",calls="));
+  out->print(c->calls);
+  out->print(F(",pixels="));
+  gfx_stats_print_u64(out, c->pixels);
+  out->print(F(",ticks="));
+  gfx_stats_print_u64(out, c->ticks);
+  out->print(F(",max_ticks="));
+  out->println(c->max_ticks);
+}
+
+void Arduino_GFX::printStats(Print *out, const gfx_stats_t *s)
+{
+  out->print(F("ticks_are_cycles="));
+  out->println(GFX_STATS_TICKS_ARE_CYCLES);
+  for (uint8_t i = 0; i < GFX_STATS_PRIMITIVE_COUNT; ++i)
+  {
+    if (s->primitive[i].calls || s->primitive[i].pixels)
+    {
+      gfx_stats_print_counter(out, gfx_stats_primitive_name(i), &s->primitive[i]);
+    }
+  }
+  out->print(F("addr_windows="));
+  out->println(s->addr_windows);
+  out->print(F("addr_cache_hits="));
+  out->println(s->addr_cache_hits);
+  out->print(F("addr_cache_misses="));
+  out->println(s->addr_cache_misses);
+  out->print(F("combined_pixels="));
+  out->println(s->combined_pixels);
+  out->print(F("glyph_lookups="));
+  out->println(s->glyph_lookups);
+  out->print(F("bus_transactions="));
+  out->println(s->bus_transactions);
+  out->print(F("bus_command_bytes="));
+  gfx_stats_print_u64(out, s->bus_command_bytes);
+  out->println();
+  out->print(F("bus_data_bytes="));
+  gfx_stats_print_u64(out, s->bus_data_bytes);
+  out->println();
+  gfx_stats_print_counter(out, "bus_write_pixels", &s->bus_write_pixels);
+  gfx_stats_print_counter(out, "bus_write_repeat", &s->bus_write_repeat);
+  gfx_stats_print_counter(out, "bus_write_bytes", &s->bus_write_bytes);
+}
+
+#endif // defined(ARDUINO_GFX_STATS)
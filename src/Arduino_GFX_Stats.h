@@ -0,0 +1,160 @@
+/*
+ * Opt-in hot path instrumentation. Define ARDUINO_GFX_STATS (e.g. with
+ * -DARDUINO_GFX_STATS in build flags) to count primitive calls, pixels,
+ * address windows, canvas flushes, glyph lookups and bus traffic. Without
+ * it every GFX_STATS_* macro expands to nothing. The primitive hooks are
+ * shared with the tracer of Arduino_GFX_Trace.h (ARDUINO_GFX_TRACE).
+ */
+#ifndef _ARDUINO_GFX_STATS_H_
+#define _ARDUINO_GFX_STATS_H_
+
+#include "Arduino_DataBus.h"
+#include "Arduino_GFX_Trace.h"
+
+#if defined(ARDUINO_GFX_STATS) || defined(ARDUINO_GFX_TRACE)
+
+typedef enum
+{
+  GFX_STATS_OTHER, // pixels written outside any primitive, e.g. direct write*() calls
+  GFX_STATS_PIXEL,
+  GFX_STATS_HLINE,
+  GFX_STATS_VLINE,
+  GFX_STATS_LINE,
+  GFX_STATS_RECT,
+  GFX_STATS_FILL_RECT,
+  GFX_STATS_FILL_SCREEN,
+  GFX_STATS_CIRCLE,
+  GFX_STATS_FILL_CIRCLE,
+  GFX_STATS_ELLIPSE,
+  GFX_STATS_FILL_ELLIPSE,
+  GFX_STATS_ARC,
+  GFX_STATS_FILL_ARC,
+  GFX_STATS_TRIANGLE,
+  GFX_STATS_FILL_TRIANGLE,
+  GFX_STATS_ROUND_RECT,
+  GFX_STATS_FILL_ROUND_RECT,
+  GFX_STATS_BITMAP,
+  GFX_STATS_CHAR,
+  GFX_STATS_FLUSH, // canvas flush()
+  GFX_STATS_PRIMITIVE_COUNT
+} gfx_stats_primitive_t;
+
+const char *gfx_stats_primitive_name(uint8_t primitive);
+
+#endif // defined(ARDUINO_GFX_STATS) || defined(ARDUINO_GFX_TRACE)
+
+#if defined(ARDUINO_GFX_STATS)
+
+// timer ticks are CPU cycles where a cycle counter is available, otherwise microseconds
+#if defined(ESP32) || defined(ESP8266)
+#define GFX_STATS_TICKS() ((uint32_t)ESP.getCycleCount())
+#define GFX_STATS_TICKS_ARE_CYCLES 1
+#elif defined(__x86_64__) || defined(__i386__)
+#define GFX_STATS_TICKS() ((uint32_t)__builtin_ia32_rdtsc())
+#define GFX_STATS_TICKS_ARE_CYCLES 1
+#elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+#define GFX_STATS_DWT_CYCCNT (*(volatile uint32_t *)0xE0001004) // enabled by resetStats()
+#define GFX_STATS_TICKS() GFX_STATS_DWT_CYCCNT
+#define GFX_STATS_TICKS_ARE_CYCLES 1
+#else
+#define GFX_STATS_TICKS() ((uint32_t)micros())
+#define GFX_STATS_TICKS_ARE_CYCLES 0
+#endif
+
+typedef struct
+{
+  uint32_t calls;
+  uint64_t pixels;
+  uint64_t ticks;
+  uint32_t max_ticks;
+} gfx_stats_counter_t;
+
+typedef struct
+{
+  gfx_stats_counter_t primitive[GFX_STATS_PRIMITIVE_COUNT];
+  uint32_t addr_windows;      ///< address windows opened by Arduino_TFT
+  uint32_t addr_cache_hits;   ///< column or row range already set, not resent
+  uint32_t addr_cache_misses; ///< column or row range written to the panel
+  uint32_t combined_pixels;   ///< pixels appended to an Arduino_TFT pixel run
+  uint32_t glyph_lookups;     ///< font glyph table lookups
+
+  // filled by Arduino_StatsBus
+  uint32_t bus_transactions;
+  uint64_t bus_command_bytes;
+  uint64_t bus_data_bytes;
+  gfx_stats_counter_t bus_write_pixels; ///< pixels = pixel count
+  gfx_stats_counter_t bus_write_repeat; ///< pixels = repeat count
+  gfx_stats_counter_t bus_write_bytes;  ///< pixels = byte count
+} gfx_stats_t;
+
+extern gfx_stats_t gfx_stats;
+extern uint8_t gfx_stats_depth;
+extern uint8_t gfx_stats_current;
+
+// Times the outermost instrumented primitive on the call stack, nested
+// primitives (e.g. drawRect() calling drawFastHLine()) are part of it.
+class Arduino_GFX_StatsScope
+{
+public:
+  GFX_INLINE Arduino_GFX_StatsScope(uint8_t primitive)
+  {
+    if (gfx_stats_depth++ == 0)
+    {
+      gfx_stats_current = primitive;
+      ++gfx_stats.primitive[primitive].calls;
+      _start = GFX_STATS_TICKS();
+    }
+  }
+
+  GFX_INLINE ~Arduino_GFX_StatsScope()
+  {
+    if (--gfx_stats_depth == 0)
+    {
+      uint32_t t = GFX_STATS_TICKS() - _start;
+      gfx_stats_counter_t *c = &gfx_stats.primitive[gfx_stats_current];
+      c->ticks += t;
+      if (t > c->max_ticks)
+      {
+        c->max_ticks = t;
+      }
+      gfx_stats_current = GFX_STATS_OTHER;
+    }
+  }
+
+private:
+  uint32_t _start = 0;
+};
+
+#define GFX_STATS_COUNTER_SCOPE(primitive) Arduino_GFX_StatsScope _gfx_stats_scope(primitive)
+#define GFX_STATS_COUNT(field) (++gfx_stats.field)
+#define GFX_STATS_PIXELS(n) (gfx_stats.primitive[gfx_stats_current].pixels += (n))
+#define GFX_STATS_ADDR_WINDOW(w, h)                                       \
+  do                                                                      \
+  {                                                                       \
+    ++gfx_stats.addr_windows;                                             \
+    gfx_stats.primitive[gfx_stats_current].pixels += (uint32_t)(w) * (h); \
+  } while (0)
+
+#else // !defined(ARDUINO_GFX_STATS)
+
+#define GFX_STATS_COUNTER_SCOPE(primitive)
+#define GFX_STATS_COUNT(field)
+#define GFX_STATS_PIXELS(n)
+#define GFX_STATS_ADDR_WINDOW(w, h)
+
+#endif // !defined(ARDUINO_GFX_STATS)
+
+// instrumentation hook of a drawing primitive, feeds both counters and tracer
+#if defined(ARDUINO_GFX_STATS) && defined(ARDUINO_GFX_TRACE)
+#define GFX_STATS_SCOPE(primitive)     \
+  GFX_STATS_COUNTER_SCOPE(primitive); \
+  GFX_TRACE_SCOPE(GFX_TRACE_PRIMITIVE, primitive)
+#elif defined(ARDUINO_GFX_STATS)
+#define GFX_STATS_SCOPE(primitive) GFX_STATS_COUNTER_SCOPE(primitive)
+#elif defined(ARDUINO_GFX_TRACE)
+#define GFX_STATS_SCOPE(primitive) GFX_TRACE_SCOPE(GFX_TRACE_PRIMITIVE, primitive)
+#else
+#define GFX_STATS_SCOPE(primitive)
+#endif
+
+#endif // _ARDUINO_GFX_STATS_H_
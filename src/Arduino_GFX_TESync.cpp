@@ -0,0 +1,150 @@
+#include "Arduino_GFX_TESync.h"
+
+#if !defined(LITTLE_FOOT_PRINT)
+
+Arduino_GFX_TE::Arduino_GFX_TE(int16_t rows, uint32_t frame_us, uint32_t blank_us)
+    : _rows(rows), _frame_us(frame_us), _blank_us(blank_us)
+{
+}
+
+void Arduino_GFX_TE::edge(uint32_t t)
+{
+  if (_edges)
+  {
+    uint32_t d = t - _last_edge;
+    // a missed or bouncing edge is not a frame
+    if ((d > (_frame_us / 2)) && (d < (_frame_us + (_frame_us / 2))))
+    {
+      _frame_us = ((_frame_us * 3) + d) / 4;
+    }
+  }
+  _last_edge = t;
+  ++_edges;
+}
+
+uint32_t Arduino_GFX_TE::now(void)
+{
+  return micros();
+}
+
+void Arduino_GFX_TE::waitUntil(uint32_t t)
+{
+  while ((int32_t)(t - now()) > 0)
+  {
+    poll();
+  }
+}
+
+void Arduino_GFX_TE::poll(void)
+{
+  if (_read)
+  {
+    bool level = _read();
+    if (level && !_level)
+    {
+      edge(now());
+    }
+    _level = level;
+  }
+}
+
+bool Arduino_GFX_TE::waitEdge(uint32_t timeout_us)
+{
+  uint32_t edges = _edges;
+  uint32_t start = now();
+  while (_edges == edges)
+  {
+    if ((now() - start) >= timeout_us)
+    {
+      return false;
+    }
+    waitUntil(now() + 10);
+  }
+  return true;
+}
+
+Arduino_GFX_TESync::Arduino_GFX_TESync(Arduino_GFX_TE *te, uint32_t row_ns)
+    : _te(te), _row_ns(row_ns)
+{
+}
+
+bool Arduino_GFX_TESync::flush(int16_t y, int16_t h, int16_t band_rows, gfx_te_write_cb_t write, void *ctx)
+{
+  uint32_t t = _te->now();
+  uint32_t frame_us = _te->frameTime();
+  _te->poll();
+  // only a polled TE drifts away, an interrupt keeps the last edge recent
+  if ((!_te->synced()) || ((t - _te->lastEdge()) > (GFX_TE_RESYNC_FRAMES * frame_us)))
+  {
+    _te->waitEdge(2 * frame_us);
+  }
+
+  uint32_t edge = _te->lastEdge();
+  int32_t frame = (_te->now() - edge) / frame_us;
+  bool planned = false;
+  if (_te->synced() && _row_ns)
+  {
+    // the frame the flush first shows in, the earliest that works
+    for (int32_t f = frame; f <= (frame + 2); ++f)
+    {
+      if (plan(t, edge, f, y, h, band_rows))
+      {
+        frame = f;
+        planned = true;
+        break;
+      }
+    }
+  }
+
+  uint32_t busy_us = 0;
+  for (int16_t band_y = y; band_y < (y + h); band_y += band_rows)
+  {
+    int16_t band_h = ((y + h - band_y) < band_rows) ? (y + h - band_y) : band_rows;
+    if (planned)
+    {
+      // the scan of the frame before has left the band
+      _te->waitUntil(_te->rowTime(edge, frame - 1, band_y + band_h) + GFX_TE_MARGIN_US);
+    }
+    else if ((band_y == y) && _te->synced())
+    {
+      _te->waitUntil(edge + ((frame + 1) * frame_us));
+    }
+    uint32_t start = _te->now();
+    if (band_y == y)
+    {
+      start_delay_us = start - t;
+    }
+    write(ctx, band_y, band_h);
+    busy_us += _te->now() - start;
+  }
+  if (h > 0)
+  {
+    _row_ns = (uint32_t)(((uint64_t)busy_us * 1000) / h);
+  }
+
+  return planned;
+}
+
+// Whether every band can be written after the scan of frame - 1 left it
+// and before the scan of frame reaches it, starting at t.
+bool Arduino_GFX_TESync::plan(uint32_t t, uint32_t edge, int32_t frame, int16_t y, int16_t h, int16_t band_rows)
+{
+  uint32_t s = t;
+  for (int16_t band_y = y; band_y < (y + h); band_y += band_rows)
+  {
+    int16_t band_h = ((y + h - band_y) < band_rows) ? (y + h - band_y) : band_rows;
+    uint32_t after = _te->rowTime(edge, frame - 1, band_y + band_h) + GFX_TE_MARGIN_US;
+    if ((int32_t)(after - s) > 0)
+    {
+      s = after;
+    }
+    s += (uint32_t)(((uint64_t)_row_ns * band_h) / 1000);
+    if ((int32_t)(_te->rowTime(edge, frame, band_y) - GFX_TE_MARGIN_US - s) < 0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+#endif // !defined(LITTLE_FOOT_PRINT)
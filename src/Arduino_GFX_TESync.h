@@ -0,0 +1,109 @@
+/*
+ * Tearing effect (TE) synchronized flushing for panels with their own frame
+ * memory, such as the ST7789 and ILI9341 on SPI.
+ *
+ * The panel scans its memory out one row at a time, one frame every
+ * frame_us. TE rises as the vertical blanking starts; blank_us later the
+ * scan reaches row 0 and then moves down at an even rate. When the scan
+ * overtakes a flush, the new top of the frame shows above the old bottom.
+ * Arduino_GFX_TESync writes a flush in bands of rows. Each band starts
+ * after the scan has left it in one frame and ends before the scan comes
+ * back to it in the next, so the bus chases the scan line and the whole
+ * flush first shows in a single frame. Waiting for TE and writing from
+ * row 0 loses the rest of the frame; here the first band can start as soon
+ * as the scan has passed it.
+ *
+ * Arduino_GFX_TE is the scan model. It gets TE edges from a GPIO interrupt
+ * (edge()) or by polling the TE pin through a callback, and tells when the
+ * scan reaches a row. Its clock and waits are virtual, so the host build
+ * can run the scheduler against a simulated scan (see gfx_bench --te).
+ */
+#ifndef _ARDUINO_GFX_TESYNC_H_
+#define _ARDUINO_GFX_TESYNC_H_
+
+#include "Arduino_DataBus.h"
+
+#if !defined(LITTLE_FOOT_PRINT)
+
+#ifndef GFX_TE_FRAME_US
+#define GFX_TE_FRAME_US 16667 // 60 Hz, corrected from the TE edges
+#endif
+#ifndef GFX_TE_BLANK_US
+#define GFX_TE_BLANK_US 1000 // TE edge to the scan of row 0
+#endif
+#ifndef GFX_TE_MARGIN_US
+#define GFX_TE_MARGIN_US 100 // kept between a band and the scan
+#endif
+#ifndef GFX_TE_RESYNC_FRAMES
+#define GFX_TE_RESYNC_FRAMES 8 // a polled TE is waited for once the last edge is older
+#endif
+
+typedef bool (*gfx_te_read_cb_t)(void);
+typedef void (*gfx_te_write_cb_t)(void *ctx, int16_t y, int16_t h);
+
+class Arduino_GFX_TE
+{
+public:
+  Arduino_GFX_TE(int16_t rows, uint32_t frame_us = GFX_TE_FRAME_US, uint32_t blank_us = GFX_TE_BLANK_US);
+  virtual ~Arduino_GFX_TE() {}
+
+  // TE edge at t, e.g. edge(micros()) from the TE pin interrupt
+  void edge(uint32_t t);
+  // TE pin level, read while waiting if there is no interrupt
+  void setPoll(gfx_te_read_cb_t read) { _read = read; }
+
+  virtual uint32_t now(void);
+  virtual void waitUntil(uint32_t t);
+  virtual void poll(void);
+  bool waitEdge(uint32_t timeout_us);
+
+  // time the scan reaches row in frame, frames counted from the TE edge at
+  // time edge
+  uint32_t rowTime(uint32_t edge, int32_t frame, int16_t row) const
+  {
+    return edge + (frame * _frame_us) + _blank_us + (uint32_t)(((uint64_t)(_frame_us - _blank_us) * row) / _rows);
+  }
+
+  bool synced(void) const { return _edges != 0; }
+  uint32_t lastEdge(void) const { return _last_edge; }
+  uint32_t frameTime(void) const { return _frame_us; }
+  int16_t rows(void) const { return _rows; }
+
+protected:
+  int16_t _rows;
+  volatile uint32_t _frame_us;
+  uint32_t _blank_us;
+  volatile uint32_t _last_edge = 0;
+  volatile uint32_t _edges = 0;
+  gfx_te_read_cb_t _read = nullptr;
+  bool _level = false;
+};
+
+class Arduino_GFX_TESync
+{
+public:
+  // row_ns: bus time per row if known, otherwise measured by the first flush
+  Arduino_GFX_TESync(Arduino_GFX_TE *te, uint32_t row_ns = 0);
+
+  // Writes panel rows y to y + h - 1 through write(ctx, band_y, band_h), in
+  // bands of band_rows from the top, each once the scan has left it.
+  // Returns false if no frame could be planned without the scan overtaking
+  // a band (bus too slow for the rows, or its speed not known yet); the
+  // bands are then written from the next TE edge on.
+  bool flush(int16_t y, int16_t h, int16_t band_rows, gfx_te_write_cb_t write, void *ctx);
+
+  uint32_t rowTime(void) const { return _row_ns; }
+
+  // last flush: time from the call to the first band
+  uint32_t start_delay_us = 0;
+
+protected:
+  bool plan(uint32_t t, uint32_t edge, int32_t frame, int16_t y, int16_t h, int16_t band_rows);
+
+  Arduino_GFX_TE *_te;
+  uint32_t _row_ns;
+};
+
+#endif // !defined(LITTLE_FOOT_PRINT)
+
+#endif // _ARDUINO_GFX_TESYNC_H_
@@ -0,0 +1,142 @@
+#include "Arduino_DataBus.h"
+#include "Arduino_GFX_Stats.h"
+
+#if defined(ARDUINO_GFX_TRACE)
+
+gfx_trace_event_t *gfx_trace_buf = nullptr;
+uint32_t gfx_trace_mask = 0;
+uint32_t gfx_trace_head = 0;
+volatile bool gfx_trace_enabled = false;
+
+/**************************************************************************/
+/*!
+   @brief  Allocate the ring buffer and start recording
+   @param  capacity  Number of events kept, rounded down to a power of two;
+                     older events are overwritten
+   @return false if the buffer could not be allocated
+*/
+/**************************************************************************/
+bool gfx_trace_init(uint32_t capacity)
+{
+  gfx_trace_enabled = false;
+  uint32_t n = 1;
+  while ((n << 1) && ((n << 1) <= capacity))
+  {
+    n <<= 1;
+  }
+  if (gfx_trace_buf)
+  {
+    free(gfx_trace_buf);
+  }
+  size_t s = n * sizeof(gfx_trace_event_t);
+#if defined(ESP32)
+  if (psramFound())
+  {
+    gfx_trace_buf = (gfx_trace_event_t *)ps_malloc(s);
+  }
+  else
+  {
+    gfx_trace_buf = (gfx_trace_event_t *)malloc(s);
+  }
+#else
+  gfx_trace_buf = (gfx_trace_event_t *)malloc(s);
+#endif
+  if (!gfx_trace_buf)
+  {
+    gfx_trace_mask = 0;
+    return false;
+  }
+  gfx_trace_mask = n - 1;
+  gfx_trace_clear();
+  gfx_trace_enable(true);
+  return true;
+}
+
+void gfx_trace_enable(bool enable)
+{
+  gfx_trace_enabled = enable && gfx_trace_buf;
+}
+
+void gfx_trace_clear()
+{
+  gfx_trace_head = 0;
+}
+
+uint32_t gfx_trace_count()
+{
+  uint32_t head = gfx_trace_head;
+  return (head > gfx_trace_mask) ? (gfx_trace_mask + 1) : head;
+}
+
+static const char *gfx_trace_event_name(const gfx_trace_event_t *e)
+{
+  switch (e->category)
+  {
+  case GFX_TRACE_PRIMITIVE:
+    return gfx_stats_primitive_name(e->id);
+  case GFX_TRACE_TRANSACTION:
+    return "transaction";
+  case GFX_TRACE_DMA:
+    return "dma";
+  default:
+    return "user";
+  }
+}
+
+static const char *gfx_trace_category_name(uint8_t category)
+{
+  switch (category)
+  {
+  case GFX_TRACE_PRIMITIVE:
+    return "primitive";
+  case GFX_TRACE_TRANSACTION:
+    return "transaction";
+  case GFX_TRACE_DMA:
+    return "dma";
+  default:
+    return "user";
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief  Print the recorded events, oldest first, as Chrome trace event
+           JSON. Call gfx_trace_enable(false) first so the buffer is not
+           written while it is printed.
+   @param  out  Serial or any other Print
+*/
+/**************************************************************************/
+void gfx_trace_dump_json(Print *out)
+{
+  out->print(F("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"));
+  out->print(F("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"cpu\"}},\n"));
+  out->print(F("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"bus\"}}"));
+  uint32_t head = gfx_trace_head;
+  uint32_t i = head - gfx_trace_count();
+  for (; i != head; ++i)
+  {
+    const gfx_trace_event_t *e = &gfx_trace_buf[i & gfx_trace_mask];
+    out->print(F(",\n{\"name\":\""));
+    out->print(gfx_trace_event_name(e));
+    if (e->category == GFX_TRACE_USER)
+    {
+      out->print(e->id);
+    }
+    out->print(F("\",\"cat\":\""));
+    out->print(gfx_trace_category_name(e->category));
+    out->print(F("\",\"ph\":\""));
+    out->print((char)e->phase);
+    out->print(F("\",\"ts\":"));
+    out->print(e->ts);
+    if (e->phase == GFX_TRACE_INSTANT_PHASE)
+    {
+      out->print(F(",\"s\":\"t\""));
+    }
+    out->print(F(",\"pid\":1,\"tid\":"));
+    out->print(e->track);
+    out->print('}');
+  }
+  out->print(F("\n]}\n"));
+}
+
+#endif // defined(ARDUINO_GFX_TRACE)
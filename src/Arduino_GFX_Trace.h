@@ -0,0 +1,116 @@
+/*
+ * Opt-in timeline tracer. Define ARDUINO_GFX_TRACE to record begin/end
+ * events of drawing primitives, Arduino_TFT write transactions, canvas
+ * flushes and bus DMA transfers into a lock-free ring buffer, then dump
+ * it as Chrome trace event JSON (open in chrome://tracing or Perfetto).
+ * Without it every GFX_TRACE_* macro expands to nothing.
+ *
+ *   gfx_trace_init(4096);
+ *   ... draw ...
+ *   gfx_trace_enable(false);
+ *   gfx_trace_dump_json(&Serial);
+ */
+#ifndef _ARDUINO_GFX_TRACE_H_
+#define _ARDUINO_GFX_TRACE_H_
+
+#include "Arduino_DataBus.h"
+
+#if defined(ARDUINO_GFX_TRACE)
+
+#if defined(ESP32)
+#include <esp_timer.h>
+#define GFX_TRACE_NOW() ((uint32_t)esp_timer_get_time())
+#else
+#define GFX_TRACE_NOW() ((uint32_t)micros())
+#endif
+
+#define GFX_TRACE_BEGIN_PHASE 'B'
+#define GFX_TRACE_END_PHASE 'E'
+#define GFX_TRACE_INSTANT_PHASE 'i'
+
+// tracks become separate rows (tids) in the trace viewer
+#define GFX_TRACE_TRACK_CPU 0
+#define GFX_TRACE_TRACK_BUS 1
+
+typedef enum
+{
+  GFX_TRACE_PRIMITIVE,   // id is a gfx_stats_primitive_t, flushes included
+  GFX_TRACE_TRANSACTION, // Arduino_TFT startWrite() .. endWrite()
+  GFX_TRACE_DMA,         // id is the bus specific transfer kind
+  GFX_TRACE_USER,        // id is up to the application
+} gfx_trace_category_t;
+
+typedef struct
+{
+  uint32_t ts; ///< microseconds
+  uint8_t phase;
+  uint8_t track;
+  uint8_t category;
+  uint8_t id;
+} gfx_trace_event_t;
+
+extern gfx_trace_event_t *gfx_trace_buf;
+extern uint32_t gfx_trace_mask;
+extern uint32_t gfx_trace_head;
+extern volatile bool gfx_trace_enabled;
+
+bool gfx_trace_init(uint32_t capacity); // capacity is rounded down to a power of two
+void gfx_trace_enable(bool enable);
+void gfx_trace_clear();
+uint32_t gfx_trace_count();
+void gfx_trace_dump_json(Print *out);
+
+// Safe to call from ISRs and other tasks: writers only share the head index.
+GFX_INLINE void gfx_trace_record(uint8_t phase, uint8_t track, uint8_t category, uint8_t id, uint32_t ts)
+{
+  if (!gfx_trace_enabled)
+  {
+    return;
+  }
+#if defined(__ARM_ARCH_6M__)
+  noInterrupts();
+  uint32_t i = gfx_trace_head++;
+  interrupts();
+#else
+  uint32_t i = __atomic_fetch_add(&gfx_trace_head, 1, __ATOMIC_RELAXED);
+#endif
+  gfx_trace_event_t *e = &gfx_trace_buf[i & gfx_trace_mask];
+  e->ts = ts;
+  e->phase = phase;
+  e->track = track;
+  e->category = category;
+  e->id = id;
+}
+
+class Arduino_GFX_TraceScope
+{
+public:
+  GFX_INLINE Arduino_GFX_TraceScope(uint8_t category, uint8_t id)
+      : _category(category), _id(id)
+  {
+    gfx_trace_record(GFX_TRACE_BEGIN_PHASE, GFX_TRACE_TRACK_CPU, category, id, GFX_TRACE_NOW());
+  }
+
+  GFX_INLINE ~Arduino_GFX_TraceScope()
+  {
+    gfx_trace_record(GFX_TRACE_END_PHASE, GFX_TRACE_TRACK_CPU, _category, _id, GFX_TRACE_NOW());
+  }
+
+private:
+  uint8_t _category;
+  uint8_t _id;
+};
+
+#define GFX_TRACE_SCOPE(category, id) Arduino_GFX_TraceScope _gfx_trace_scope(category, id)
+#define GFX_TRACE_BEGIN(track, category, id) gfx_trace_record(GFX_TRACE_BEGIN_PHASE, track, category, id, GFX_TRACE_NOW())
+#define GFX_TRACE_END(track, category, id) gfx_trace_record(GFX_TRACE_END_PHASE, track, category, id, GFX_TRACE_NOW())
+
+#else // !defined(ARDUINO_GFX_TRACE)
+
+#define GFX_TRACE_SCOPE(category, id)
+#define GFX_TRACE_BEGIN(track, category, id)
+#define GFX_TRACE_END(track, category, id)
+
+#endif // !defined(ARDUINO_GFX_TRACE)
+
+#endif // _ARDUINO_GFX_TRACE_H_
@@ -0,0 +1,186 @@
+#include "Arduino_GFX_WriteBack.h"
+
+#if !defined(LITTLE_FOOT_PRINT)
+
+Arduino_GFX_WriteBack::Arduino_GFX_WriteBack(gfx_writeback_cb_t cb, uint32_t pixel_budget, uint16_t interval_ms)
+    : _cb(cb), _pixel_budget(pixel_budget), _interval_ms(interval_ms)
+{
+}
+
+Arduino_GFX_WriteBack::~Arduino_GFX_WriteBack()
+{
+  if (_dirty_x1)
+  {
+    free(_dirty_x1);
+  }
+}
+
+bool Arduino_GFX_WriteBack::begin(void *framebuffer, int16_t width, int16_t height, uint8_t bytes_per_pixel)
+{
+  _framebuffer = (uint8_t *)framebuffer;
+  _width = width;
+  _height = height;
+  _bytes_per_pixel = bytes_per_pixel;
+
+  if (_dirty_x1)
+  {
+    free(_dirty_x1);
+  }
+  _dirty_x1 = (int16_t *)malloc(height * 2 * sizeof(int16_t));
+  if (!_dirty_x1)
+  {
+    return false;
+  }
+  _dirty_x2 = _dirty_x1 + height;
+  for (int16_t y = 0; y < height; ++y)
+  {
+    _dirty_x1[y] = width;
+    _dirty_x2[y] = -1;
+  }
+  _first_row = height;
+  _last_row = -1;
+  _pending_pixels = 0;
+  calls = 0;
+  bytes = 0;
+
+  return true;
+}
+
+void Arduino_GFX_WriteBack::mark(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  if (!_dirty_x1)
+  {
+    return;
+  }
+  if (x < 0)
+  {
+    w += x;
+    x = 0;
+  }
+  if (y < 0)
+  {
+    h += y;
+    y = 0;
+  }
+  if ((x + w) > _width)
+  {
+    w = _width - x;
+  }
+  if ((y + h) > _height)
+  {
+    h = _height - y;
+  }
+  if ((w <= 0) || (h <= 0))
+  {
+    return;
+  }
+
+  int16_t x2 = x + w - 1;
+  int16_t y2 = y + h - 1;
+  int16_t gap = GFX_WRITEBACK_MERGE_GAP / _bytes_per_pixel;
+  for (int16_t j = y; j <= y2; ++j)
+  {
+    if (_dirty_x1[j] <= _dirty_x2[j])
+    {
+      // a change far off the pending range of the row, like the other side
+      // of a circle, writes the pending range back rather than the gap
+      if ((x > (_dirty_x2[j] + gap)) || (x2 < (_dirty_x1[j] - gap)))
+      {
+        uintptr_t row = (uintptr_t)_framebuffer + ((uint32_t)j * _width * _bytes_per_pixel);
+        emit(row + _dirty_x1[j] * _bytes_per_pixel, row + (_dirty_x2[j] + 1) * _bytes_per_pixel);
+        _dirty_x1[j] = _width;
+        _dirty_x2[j] = -1;
+      }
+    }
+    if (x < _dirty_x1[j])
+    {
+      _dirty_x1[j] = x;
+    }
+    if (x2 > _dirty_x2[j])
+    {
+      _dirty_x2[j] = x2;
+    }
+  }
+  if (y < _first_row)
+  {
+    _first_row = y;
+  }
+  if (y2 > _last_row)
+  {
+    _last_row = y2;
+  }
+
+  if (!_pending_pixels)
+  {
+    _pending_since = millis();
+  }
+  _pending_pixels += (uint32_t)w * h;
+
+  if (_pixel_budget && (_pending_pixels >= _pixel_budget))
+  {
+    flush();
+  }
+  // the clock is read every 64 changes only, single pixels are the common case
+  else if (_interval_ms && ((++_marks & 63) == 0) && ((millis() - _pending_since) >= _interval_ms))
+  {
+    flush();
+  }
+}
+
+// Writes back the changed columns of every row, merging the ranges of
+// consecutive rows that touch or nearly touch.
+void Arduino_GFX_WriteBack::flush(void)
+{
+  if (!_pending_pixels)
+  {
+    return;
+  }
+
+  uintptr_t base = (uintptr_t)_framebuffer;
+  uint32_t stride = (uint32_t)_width * _bytes_per_pixel;
+  uintptr_t run_start = 0, run_end = 0;
+  bool run = false;
+  for (int16_t y = _first_row; y <= _last_row; ++y)
+  {
+    if (_dirty_x1[y] > _dirty_x2[y])
+    {
+      continue;
+    }
+    uintptr_t start = base + y * stride + _dirty_x1[y] * _bytes_per_pixel;
+    uintptr_t end = base + y * stride + (_dirty_x2[y] + 1) * _bytes_per_pixel;
+    _dirty_x1[y] = _width;
+    _dirty_x2[y] = -1;
+
+    if (run && (start <= (run_end + GFX_WRITEBACK_MERGE_GAP)))
+    {
+      run_end = end;
+    }
+    else
+    {
+      if (run)
+      {
+        emit(run_start, run_end);
+      }
+      run_start = start;
+      run_end = end;
+      run = true;
+    }
+  }
+  if (run)
+  {
+    emit(run_start, run_end);
+  }
+
+  _first_row = _height;
+  _last_row = -1;
+  _pending_pixels = 0;
+}
+
+void Arduino_GFX_WriteBack::emit(uintptr_t start, uintptr_t end)
+{
+  ++calls;
+  bytes += end - start;
+  _cb(start, end - start);
+}
+
+#endif // !defined(LITTLE_FOOT_PRINT)
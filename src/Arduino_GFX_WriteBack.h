@@ -0,0 +1,95 @@
+/*
+ * Deferred, coalesced cache write-back for framebuffers in cached memory
+ * (ESP32-S3 PSRAM scanned out by the RGB LCD peripheral).
+ *
+ * Writing back every pixel or primitive as it is drawn costs more than the
+ * drawing itself for text and lines. Arduino_GFX_WriteBack collects the
+ * changed column range of every framebuffer row instead and writes it back
+ * as few address ranges as possible, rows that are changed (nearly) up to
+ * their ends being merged into one range:
+ *
+ * - at flush(), which the display calls from endWrite() and at the end of
+ *   the draw calls that are not bracketed by startWrite()/endWrite(),
+ * - once pixel_budget pixels are pending, so long write*() sequences do
+ *   not leave a large area unseen,
+ * - once interval_ms passed since the first pending change, checked as
+ *   changes come in.
+ *
+ * Every range is written back once per flush(), in address order, so no
+ * change of a later draw call becomes visible before the pending changes
+ * of an earlier one.
+ *
+ * The write-back itself is a callback, so the accumulation runs on the
+ * host build with a stub (see gfx_bench --writeback).
+ */
+#ifndef _ARDUINO_GFX_WRITEBACK_H_
+#define _ARDUINO_GFX_WRITEBACK_H_
+
+#include "Arduino_DataBus.h"
+
+#if !defined(LITTLE_FOOT_PRINT)
+
+#ifndef GFX_WRITEBACK_PIXEL_BUDGET
+#define GFX_WRITEBACK_PIXEL_BUDGET 16384
+#endif
+#ifndef GFX_WRITEBACK_INTERVAL_MS
+#define GFX_WRITEBACK_INTERVAL_MS 20
+#endif
+#ifndef GFX_WRITEBACK_MERGE_GAP
+// bytes, ranges closer than this are written back as one. Two cache lines:
+// a larger gap writes back more than the calls it saves, and with gaps near
+// the row stride every pair of changed rows merges.
+#define GFX_WRITEBACK_MERGE_GAP 64
+#endif
+
+typedef void (*gfx_writeback_cb_t)(uintptr_t addr, uint32_t size);
+
+class Arduino_GFX_WriteBack
+{
+public:
+  Arduino_GFX_WriteBack(gfx_writeback_cb_t cb, uint32_t pixel_budget = GFX_WRITEBACK_PIXEL_BUDGET, uint16_t interval_ms = GFX_WRITEBACK_INTERVAL_MS);
+  ~Arduino_GFX_WriteBack();
+
+  bool begin(void *framebuffer, int16_t width, int16_t height, uint8_t bytes_per_pixel);
+
+  // x, y, w, h in framebuffer pixels, clipped to the framebuffer
+  void mark(int16_t x, int16_t y, int16_t w, int16_t h);
+  void flush(void);
+
+  // moves to another framebuffer of the same size, e.g. after a page swap
+  void setFramebuffer(void *framebuffer)
+  {
+    flush();
+    _framebuffer = (uint8_t *)framebuffer;
+  }
+
+  bool pending(void) const { return _pending_pixels > 0; }
+
+  // write-back calls and bytes since begin()
+  uint32_t calls = 0;
+  uint64_t bytes = 0;
+
+protected:
+  void emit(uintptr_t start, uintptr_t end);
+
+  gfx_writeback_cb_t _cb;
+  uint32_t _pixel_budget;
+  uint16_t _interval_ms;
+
+  uint8_t *_framebuffer = nullptr;
+  int16_t _width = 0, _height = 0;
+  uint8_t _bytes_per_pixel = 0;
+
+  // changed column range of every row, x1 > x2 when the row is clean
+  int16_t *_dirty_x1 = nullptr;
+  int16_t *_dirty_x2 = nullptr;
+  int16_t _first_row, _last_row;
+
+  uint32_t _pending_pixels = 0;
+  uint32_t _pending_since = 0;
+  uint8_t _marks = 0;
+};
+
+#endif // !defined(LITTLE_FOOT_PRINT)
+
+#endif // _ARDUINO_GFX_WRITEBACK_H_
@@ -7,6 +7,10 @@
 #include "Arduino_TFT.h"
 #include "font/glcdfont.h"
 
+#define TFT_PIXEL_RUN_SINGLE 0
+#define TFT_PIXEL_RUN_ROW 1
+#define TFT_PIXEL_RUN_COLUMN 2
+
 Arduino_TFT::Arduino_TFT(
     Arduino_DataBus *bus, int8_t rst, uint8_t r,
     bool ips, int16_t w, int16_t h,
@@ -44,14 +48,93 @@ bool Arduino_TFT::begin(int32_t speed)
 
 void Arduino_TFT::startWrite()
 {
+  GFX_TRACE_BEGIN(GFX_TRACE_TRACK_CPU, GFX_TRACE_TRANSACTION, 0);
   _bus->beginWrite();
 }
 
 void Arduino_TFT::writePixelPreclipped(int16_t x, int16_t y, uint16_t color)
 {
+#if defined(TFT_PIXEL_RUN)
+  if (_run_count)
+  {
+    if (_run_dir == TFT_PIXEL_RUN_SINGLE)
+    {
+      if ((y == _run_y) && (x == _run_x + 1))
+      {
+        _run_dir = TFT_PIXEL_RUN_ROW;
+      }
+      else if ((x == _run_x) && (y == _run_y + 1))
+      {
+        _run_dir = TFT_PIXEL_RUN_COLUMN;
+      }
+    }
+    if (((_run_dir == TFT_PIXEL_RUN_ROW) && (y == _run_y) && (x == _run_x + _run_count)) ||
+        ((_run_dir == TFT_PIXEL_RUN_COLUMN) && (x == _run_x) && (y == _run_y + _run_count) &&
+         (scrolledRow(y) == (scrolledRow(y - 1) + 1))))
+    {
+      if (_run_len == TFT_PIXEL_RUN_MAX_PIXELS)
+      {
+        writePixelRun(false);
+      }
+      _run_buf[_run_len++] = color;
+      ++_run_count;
+      GFX_STATS_COUNT(combined_pixels);
+      return;
+    }
+    flushPixelRun();
+  }
+  _run_x = x;
+  _run_y = y;
+  _run_dir = TFT_PIXEL_RUN_SINGLE;
+  _run_open = false;
+  _run_buf[0] = color;
+  _run_len = 1;
+  _run_count = 1;
+#else
   writeAddrWindow(x, y, 1, 1);
   _bus->write16(color);
+#endif
+}
+
+void Arduino_TFT::flushPixelRun()
+{
+#if defined(TFT_PIXEL_RUN)
+  if (_run_count)
+  {
+    if (_run_len)
+    {
+      writePixelRun(true);
+    }
+    _run_count = 0;
+  }
+#endif
+}
+
+#if defined(TFT_PIXEL_RUN)
+// Sends the buffered pixels. The first time, the window is opened exactly
+// around the run if it is complete, otherwise up to the panel edge so that
+// later pixels of the same run only need the data.
+void Arduino_TFT::writePixelRun(bool last)
+{
+  if (!_run_open)
+  {
+    uint16_t count = _run_count;
+    _run_count = 0; // writeAddrWindow() flushes pending runs, not this one
+    if (_run_dir == TFT_PIXEL_RUN_COLUMN)
+    {
+      writeAddrWindow(_run_x, _run_y, 1, last ? count : scrollSplit(_run_y, _max_y - _run_y + 1));
+    }
+    else
+    {
+      writeAddrWindow(_run_x, _run_y, last ? count : (_max_x - _run_x + 1), 1);
+    }
+    _run_count = count;
+    _run_open = true;
+  }
+  writePixels(_run_buf, _run_len);
+  _run_len = 0;
 }
+#endif // defined(TFT_PIXEL_RUN)
 
 void Arduino_TFT::writeRepeat(uint16_t color, uint32_t len)
 {
@@ -82,6 +165,15 @@ void Arduino_TFT::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color
         {
           h = _max_y - y + 1;
         } // Clip bottom
+        if (_isRoundMode)
+        {
+          y2 = y + h - 1;
+          if (!clipRoundSpan(x, &y, &y2))
+          {
+            return;
+          }
+          h = y2 - y + 1;
+        } // Clip to the circle
         writeFillRectPreclipped(x, y, 1, h, color);
       }
     }
@@ -112,6 +204,15 @@ void Arduino_TFT::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color
         {
           w = _max_x - x + 1;
         } // Clip right
+        if (_isRoundMode)
+        {
+          x2 = x + w - 1;
+          if (!clipRoundSpan(y, &x, &x2))
+          {
+            return;
+          }
+          w = x2 - x + 1;
+        } // Clip to the circle
         writeFillRectPreclipped(x, y, w, 1, color);
       }
     }
@@ -125,18 +226,29 @@ void Arduino_TFT::writeFillRectPreclipped(
 #ifdef ESP8266
   yield();
 #endif
+  int16_t rows = scrollSplit(y, h);
+  if (rows < h)
+  {
+    writeFillRectPreclipped(x, y, w, rows, color);
+    writeFillRectPreclipped(x, y + rows, w, h - rows, color);
+    return;
+  }
   writeAddrWindow(x, y, w, h);
   writeRepeat(color, (uint32_t)w * h);
 }
 
 void Arduino_TFT::endWrite()
 {
+  flushPixelRun();
   _bus->endWrite();
+  GFX_TRACE_END(GFX_TRACE_TRACK_CPU, GFX_TRACE_TRANSACTION, 0);
 }
 
 void Arduino_TFT::setAddrWindow(int16_t x0, int16_t y0, uint16_t w,
                                 uint16_t h)
 {
+  invalidateAddrWindow();
+
   startWrite();
 
   writeAddrWindow(x0, y0, w, h);
@@ -144,8 +256,143 @@ void Arduino_TFT::setAddrWindow(int16_t x0, int16_t y0, uint16_t w,
   endWrite();
 }
 
+void Arduino_TFT::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+{
+  flushPixelRun();
+  GFX_STATS_ADDR_WINDOW(w, h);
+  y = scrolledRow(y);
+
+  bool col = (x != _currentX) || (w != _currentW);
+  bool row = (y != _currentY) || (h != _currentH);
+  if (_addr_both_axes)
+  {
+    col = row = (col || row);
+  }
+
+  if (col)
+  {
+    GFX_STATS_COUNT(addr_cache_misses);
+    _currentX = x;
+    _currentW = w;
+    writeColumnAddr(x, w);
+  }
+  else
+  {
+    GFX_STATS_COUNT(addr_cache_hits);
+  }
+
+  if (row)
+  {
+    GFX_STATS_COUNT(addr_cache_misses);
+    _currentY = y;
+    _currentH = h;
+    writeRowAddr(y, h);
+  }
+  else
+  {
+    GFX_STATS_COUNT(addr_cache_hits);
+  }
+
+  writeMemoryStart();
+}
+
+void Arduino_TFT::invalidateAddrWindow()
+{
+  _currentX = 0xFFFF;
+  _currentY = 0xFFFF;
+  _currentW = 0xFFFF;
+  _currentH = 0xFFFF;
+}
+
+void Arduino_TFT::writeColumnAddr(int16_t, uint16_t)
+{
+}
+
+void Arduino_TFT::writeRowAddr(int16_t, uint16_t)
+{
+}
+
+void Arduino_TFT::writeMemoryStart()
+{
+}
+
+bool Arduino_TFT::writeScrollArea(uint16_t, uint16_t)
+{
+  return false;
+}
+
+void Arduino_TFT::writeScrollStart(uint16_t)
+{
+}
+
+bool Arduino_TFT::setScrollArea(uint16_t top_fixed, uint16_t bottom_fixed)
+{
+  if ((_addr_align > 1) || ((top_fixed + bottom_fixed) >= HEIGHT))
+  {
+    return false;
+  }
+  uint16_t rows = HEIGHT - top_fixed - bottom_fixed;
+
+  startWrite();
+  bool supported = writeScrollArea(ROW_OFFSET1 + top_fixed, rows);
+  if (supported)
+  {
+    writeScrollStart(ROW_OFFSET1 + top_fixed);
+    _scroll_top = top_fixed;
+    _scroll_rows = rows;
+    _scroll_offset = 0;
+  }
+  endWrite();
+
+  return supported;
+}
+
+void Arduino_TFT::scrollTo(uint16_t offset)
+{
+  if (!_scroll_rows)
+  {
+    return;
+  }
+
+  startWrite(); // sends the pending pixel run before the rows move
+  _scroll_offset = offset % _scroll_rows;
+  writeScrollStart(ROW_OFFSET1 + _scroll_top + _scroll_offset);
+  endWrite();
+}
+
+int16_t Arduino_TFT::scrollSplit(int16_t y, int16_t h)
+{
+  if ((!_scroll_offset) || _rotation)
+  {
+    return h;
+  }
+
+  int16_t r = y - _scroll_top;
+  int16_t rows;
+  if (r < 0)
+  {
+    rows = -r; // fixed rows above the scroll area
+  }
+  else if (r < (int16_t)_scroll_rows)
+  {
+    int16_t m = r + _scroll_offset;
+    if (m >= (int16_t)_scroll_rows)
+    {
+      m -= _scroll_rows;
+    }
+    // up to the wrap in memory or the end of the scroll area
+    rows = _scroll_rows - ((m > r) ? m : r);
+  }
+  else
+  {
+    rows = h; // fixed rows below
+  }
+  return (rows < h) ? rows : h;
+}
+
 void Arduino_TFT::setRotation(uint8_t r)
 {
+  flushPixelRun();
   Arduino_GFX::setRotation(r);
   switch (_rotation)
   {
@@ -170,10 +417,7 @@ void Arduino_TFT::setRotation(uint8_t r)
     _yStart = ROW_OFFSET1;
     break;
   }
-  _currentX = 0xFFFF;
-  _currentY = 0xFFFF;
-  _currentW = 0xFFFF;
-  _currentH = 0xFFFF;
+  invalidateAddrWindow();
 }
 
 void Arduino_TFT::writeColor(uint16_t color)
@@ -277,6 +521,7 @@ void Arduino_TFT::drawBitmap(
     int16_t x, int16_t y,
     const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -297,22 +542,29 @@ void Arduino_TFT::drawBitmap(
   }
   else
   {
-    int32_t pixels = w * h;
+    int32_t i = 0;
     uint8_t byte = 0;
     uint16_t idx = 0;
     startWrite();
-    writeAddrWindow(x, y, w, h);
-    for (int32_t i = 0; i < pixels; i++)
+    while (h > 0)
     {
-      if (i & 7)
-      {
-        byte <<= 1;
-      }
-      else
+      int16_t rows = scrollSplit(y, h);
+      int32_t end = i + (int32_t)w * rows;
+      writeAddrWindow(x, y, w, rows);
+      for (; i < end; i++)
       {
-        byte = pgm_read_byte(&bitmap[idx++]);
+        if (i & 7)
+        {
+          byte <<= 1;
+        }
+        else
+        {
+          byte = pgm_read_byte(&bitmap[idx++]);
+        }
+        _bus->write16((byte & 0x80) ? color : bg);
       }
-      _bus->write16((byte & 0x80) ? color : bg);
+      y += rows;
+      h -= rows;
     }
     endWrite();
   }
@@ -322,6 +574,7 @@ void Arduino_TFT::drawBitmap(
     int16_t x, int16_t y,
     uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -342,21 +595,28 @@ void Arduino_TFT::drawBitmap(
   }
   else
   {
-    int32_t pixels = w * h;
+    int32_t i = 0;
     uint8_t byte = 0;
     startWrite();
-    writeAddrWindow(x, y, w, h);
-    for (int32_t i = 0; i < pixels; i++)
+    while (h > 0)
     {
-      if (i & 7)
+      int16_t rows = scrollSplit(y, h);
+      int32_t end = i + (int32_t)w * rows;
+      writeAddrWindow(x, y, w, rows);
+      for (; i < end; i++)
       {
-        byte <<= 1;
-      }
-      else
-      {
-        byte = *(bitmap++);
+        if (i & 7)
+        {
+          byte <<= 1;
+        }
+        else
+        {
+          byte = *(bitmap++);
+        }
+        _bus->write16((byte & 0x80) ? color : bg);
       }
-      _bus->write16((byte & 0x80) ? color : bg);
+      y += rows;
+      h -= rows;
     }
     endWrite();
   }
@@ -366,6 +626,7 @@ void Arduino_TFT::drawGrayscaleBitmap(
     int16_t x, int16_t y,
     const uint8_t bitmap[], int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -386,14 +647,21 @@ void Arduino_TFT::drawGrayscaleBitmap(
   }
   else
   {
-    uint32_t len = (uint32_t)w * h;
     uint8_t v;
     startWrite();
-    writeAddrWindow(x, y, w, h);
-    for (uint32_t i = 0; i < len; i++)
+    while (h > 0)
     {
-      v = pgm_read_byte(&bitmap[i]);
-      _bus->write16(color565(v, v, v));
+      int16_t rows = scrollSplit(y, h);
+      uint32_t len = (uint32_t)w * rows;
+      writeAddrWindow(x, y, w, rows);
+      for (uint32_t i = 0; i < len; i++)
+      {
+        v = pgm_read_byte(&bitmap[i]);
+        _bus->write16(color565(v, v, v));
+      }
+      bitmap += len;
+      y += rows;
+      h -= rows;
     }
     endWrite();
   }
@@ -403,6 +671,7 @@ void Arduino_TFT::drawGrayscaleBitmap(
     int16_t x, int16_t y,
     uint8_t *bitmap, int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -423,14 +692,20 @@ void Arduino_TFT::drawGrayscaleBitmap(
   }
   else
   {
-    uint32_t len = (uint32_t)w * h;
     uint8_t v;
     startWrite();
-    writeAddrWindow(x, y, w, h);
-    while (len--)
+    while (h > 0)
     {
-      v = *(bitmap++);
-      _bus->write16(color565(v, v, v));
+      int16_t rows = scrollSplit(y, h);
+      uint32_t len = (uint32_t)w * rows;
+      writeAddrWindow(x, y, w, rows);
+      while (len--)
+      {
+        v = *(bitmap++);
+        _bus->write16(color565(v, v, v));
+      }
+      y += rows;
+      h -= rows;
     }
     endWrite();
   }
@@ -440,6 +715,7 @@ void Arduino_TFT::drawIndexedBitmap(
     int16_t x, int16_t y,
     uint8_t *bitmap, uint16_t *color_index, int16_t w, int16_t h, int16_t x_skip)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -461,18 +737,25 @@ void Arduino_TFT::drawIndexedBitmap(
   else
   {
     startWrite();
-    writeAddrWindow(x, y, w, h);
-    if (x_skip == 0)
-    {
-      _bus->writeIndexedPixels(bitmap, color_index, h * w);
-    }
-    else
+    while (h > 0)
     {
-      while (h--)
+      int16_t rows = scrollSplit(y, h);
+      writeAddrWindow(x, y, w, rows);
+      if (x_skip == 0)
       {
-        _bus->writeIndexedPixels(bitmap, color_index, w);
-        bitmap += w + x_skip;
+        _bus->writeIndexedPixels(bitmap, color_index, (uint32_t)w * rows);
+        bitmap += (int32_t)w * rows;
       }
+      else
+      {
+        for (int16_t j = 0; j < rows; j++)
+        {
+          _bus->writeIndexedPixels(bitmap, color_index, w);
+          bitmap += w + x_skip;
+        }
+      }
+      y += rows;
+      h -= rows;
     }
     endWrite();
   }
@@ -481,6 +764,7 @@ void Arduino_TFT::drawIndexedBitmap(
 void Arduino_TFT::draw16bitRGBBitmapWithMask(int16_t x, int16_t y,
                                              uint16_t *bitmap, uint8_t *mask, int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -533,7 +817,7 @@ void Arduino_TFT::draw16bitRGBBitmapWithMask(int16_t x, int16_t y,
       }
       if (len)
       {
-        writeAddrWindow(x + w - 1 - len, y, len, 1);
+        writeAddrWindow(x + w - len, y, len, 1);
         _bus->writePixels(&bitmap[offset - len], len);
         len = 0;
       }
@@ -546,6 +830,7 @@ void Arduino_TFT::draw16bitRGBBitmap(
     int16_t x, int16_t y,
     const uint16_t bitmap[], int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -566,12 +851,19 @@ void Arduino_TFT::draw16bitRGBBitmap(
   }
   else
   {
-    uint32_t len = (uint32_t)w * h;
     startWrite();
-    writeAddrWindow(x, y, w, h);
-    for (uint32_t i = 0; i < len; i++)
+    while (h > 0)
     {
-      _bus->write16(pgm_read_word(&bitmap[i]));
+      int16_t rows = scrollSplit(y, h);
+      uint32_t len = (uint32_t)w * rows;
+      writeAddrWindow(x, y, w, rows);
+      for (uint32_t i = 0; i < len; i++)
+      {
+        _bus->write16(pgm_read_word(&bitmap[i]));
+      }
+      bitmap += len;
+      y += rows;
+      h -= rows;
     }
     endWrite();
   }
@@ -581,32 +873,16 @@ void Arduino_TFT::draw16bitRGBBitmap(
     int16_t x, int16_t y,
     uint16_t *bitmap, int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
+      ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
+      (x > _max_x) ||      // Outside right
       (y > _max_y)         // Outside bottom
   )
   {
     return;
   }
-  else if (_isRoundMode)
-  {
-    if (
-        (x > _roundMaxX[y + h - 1]) &&        // top left
-        ((x + w - 1) < _roundMinX[y]) &&      // top right
-        (x > _roundMaxX[y + h - 1]) &&        // bottom left
-        ((x + w - 1) < _roundMinX[y + h - 1]) // bottom right
-    )
-    {
-      return;
-    }
-  }
-  else if (
-      ((x + w - 1) < 0) || // Outside left
-      (x > _max_x)         // Outside right
-  )
-  {
-    return;
-  }
   else
   {
     int16_t out_width = w;
@@ -632,27 +908,200 @@ void Arduino_TFT::draw16bitRGBBitmap(
     }
 
     startWrite();
-    writeAddrWindow(x, y, out_width, h);
-    if (out_width < w)
+    if (_isRoundMode)
+    {
+      writeRoundClippedBitmap(x, y, bitmap, w, out_width, h);
+    }
+    else
     {
-      for (int16_t j = 0; j < h; j++)
+      while (h > 0)
       {
-        _bus->writePixels(bitmap, out_width);
-        bitmap += w;
+        int16_t rows = scrollSplit(y, h);
+        writeAddrWindow(x, y, out_width, rows);
+        if (out_width < w)
+        {
+          for (int16_t j = 0; j < rows; j++)
+          {
+            _bus->writePixels(bitmap, out_width);
+            bitmap += w;
+          }
+        }
+        else
+        {
+          _bus->writePixels(bitmap, (uint32_t)w * rows);
+          bitmap += (int32_t)w * rows;
+        }
+        y += rows;
+        h -= rows;
       }
     }
+    endWrite();
+  }
+}
+
+// Round mode: sends the part of every row inside the circle only. Rows
+// visible across the whole bitmap, the middle of the circle, go out as
+// one window.
+void Arduino_TFT::writeRoundClippedBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t stride, int16_t w, int16_t h)
+{
+  int16_t x2 = x + w - 1;
+  int16_t j = 0;
+  while (j < h)
+  {
+    int16_t x1 = x, xe = x2;
+    if (!clipRoundSpan(y + j, &x1, &xe))
+    {
+      ++j;
+    }
+    else if ((x1 == x) && (xe == x2))
+    {
+      int16_t rows = 1;
+      while ((j + rows) < h)
+      {
+        int16_t nx1 = x, nxe = x2;
+        if (!clipRoundSpan(y + j + rows, &nx1, &nxe) || (nx1 != x) || (nxe != x2))
+        {
+          break;
+        }
+        ++rows;
+      }
+      rows = scrollSplit(y + j, rows);
+      writeAddrWindow(x, y + j, w, rows);
+      if (w < stride)
+      {
+        for (int16_t r = 0; r < rows; r++)
+        {
+          writePixels(bitmap + (int32_t)(j + r) * stride, w);
+        }
+      }
+      else
+      {
+        writePixels(bitmap + (int32_t)j * stride, (uint32_t)w * rows);
+      }
+      j += rows;
+    }
     else
     {
-      _bus->writePixels(bitmap, (uint32_t)w * h);
+      writeAddrWindow(x1, y + j, xe - x1 + 1, 1);
+      writePixels(bitmap + (int32_t)j * stride + (x1 - x), xe - x1 + 1);
+      ++j;
     }
-    endWrite();
   }
 }
 
+// Sends the part rx, ry, rw, rh of a w x h bitmap at x, y, clipped to the
+// bitmap and the screen and grown to the address window grid. Where the
+// bitmap or the screen ends off the grid the window stays short there.
+void Arduino_TFT::draw16bitRGBBitmapRect(
+    int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h,
+    int16_t rx, int16_t ry, int16_t rw, int16_t rh)
+{
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
+  if (!alignSpan(x, w, _max_x, _xStart, rx, rw) || !alignSpan(y, h, _max_y, _yStart, ry, rh))
+  {
+    return;
+  }
+  bitmap += ((int32_t)ry * w) + rx;
+  x += rx;
+  y += ry;
+
+  startWrite();
+  // the circle edge is off the grid, so on a grid the whole part goes out,
+  // its corners fall outside the visible circle
+  if (_isRoundMode && (_addr_align == 1))
+  {
+    writeRoundClippedBitmap(x, y, bitmap, w, rw, rh);
+  }
+  else
+  {
+    while (rh > 0)
+    {
+      // setScrollArea() is refused on a grid, rows only split without one
+      int16_t rows = scrollSplit(y, rh);
+      writeAddrWindow(x, y, rw, rows);
+      if (rw < w)
+      {
+        for (int16_t j = 0; j < rows; j++)
+        {
+          writePixels(bitmap, rw);
+          bitmap += w;
+        }
+      }
+      else
+      {
+        writePixels(bitmap, (uint32_t)w * rows);
+        bitmap += (int32_t)w * rows;
+      }
+      y += rows;
+      rh -= rows;
+    }
+  }
+  endWrite();
+}
+
+// The part r, n of a bitmap span of size pixels at screen position origin,
+// clipped to the bitmap and to the screen (0 to max) and grown to
+// _addr_align in panel memory, where screen position 0 is at offset.
+bool Arduino_TFT::alignSpan(int16_t origin, int16_t size, int16_t max, int16_t offset, int16_t &r, int16_t &n)
+{
+  int16_t lo = (origin < 0) ? -origin : 0;
+  int16_t hi = ((origin + size - 1) > max) ? (max - origin + 1) : size;
+  if (r < lo)
+  {
+    n -= lo - r;
+    r = lo;
+  }
+  if ((r + n) > hi)
+  {
+    n = hi - r;
+  }
+  if (n <= 0)
+  {
+    return false;
+  }
+
+  if (_addr_align > 1)
+  {
+    int16_t mask = _addr_align - 1;
+    int16_t m = origin + offset; // panel memory position of bitmap pixel 0
+    int16_t r1 = ((m + r) & ~mask) - m;
+    int16_t r2 = ((m + r + n + mask) & ~mask) - m;
+    r = (r1 < lo) ? lo : r1;
+    n = ((r2 > hi) ? hi : r2) - r;
+  }
+  return true;
+}
+
+void Arduino_TFT::beginBlock(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  _block_x = x;
+  _block_y = y;
+  _block_w = w;
+  _block_end = y + h;
+  _block_rows = 0;
+}
+
+int16_t Arduino_TFT::blockRows(int16_t n)
+{
+  if (!_block_rows)
+  {
+    _block_rows = scrollSplit(_block_y, _block_end - _block_y);
+    writeAddrWindow(_block_x, _block_y, _block_w, _block_rows);
+  }
+  if (n > _block_rows)
+  {
+    n = _block_rows;
+  }
+  _block_rows -= n;
+  _block_y += n;
+  return n;
+}
+
 void Arduino_TFT::draw16bitBeRGBBitmap(
     int16_t x, int16_t y,
     uint16_t *bitmap, int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -687,19 +1136,25 @@ void Arduino_TFT::draw16bitBeRGBBitmap(
     }
 
     startWrite();
-    writeAddrWindow(x, y, out_width, h);
-    if (out_width < w)
+    while (h > 0)
     {
-      out_width <<= 1;
-      for (int16_t j = 0; j < h; j++)
+      int16_t rows = scrollSplit(y, h);
+      writeAddrWindow(x, y, out_width, rows);
+      if (out_width < w)
       {
-        _bus->writeBytes((uint8_t *)bitmap, out_width);
-        bitmap += w;
+        for (int16_t j = 0; j < rows; j++)
+        {
+          _bus->writeBytes((uint8_t *)bitmap, (uint32_t)out_width * 2);
+          bitmap += w;
+        }
       }
-    }
-    else
-    {
-      _bus->writeBytes((uint8_t *)bitmap, (uint32_t)w * h * 2);
+      else
+      {
+        _bus->writeBytes((uint8_t *)bitmap, (uint32_t)w * rows * 2);
+        bitmap += (int32_t)w * rows;
+      }
+      y += rows;
+      h -= rows;
     }
     endWrite();
   }
@@ -709,6 +1164,7 @@ void Arduino_TFT::draw24bitRGBBitmap(
     int16_t x, int16_t y,
     const uint8_t bitmap[], int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -729,14 +1185,20 @@ void Arduino_TFT::draw24bitRGBBitmap(
   }
   else
   {
-    uint32_t len = (uint32_t)w * h;
     uint32_t offset = 0;
     startWrite();
-    writeAddrWindow(x, y, w, h);
-    while (len--)
+    while (h > 0)
     {
-      _bus->write16(color565(pgm_read_byte(&bitmap[offset]), pgm_read_byte(&bitmap[offset + 1]), pgm_read_byte(&bitmap[offset + 2])));
-      offset += 3;
+      int16_t rows = scrollSplit(y, h);
+      uint32_t len = (uint32_t)w * rows;
+      writeAddrWindow(x, y, w, rows);
+      while (len--)
+      {
+        _bus->write16(color565(pgm_read_byte(&bitmap[offset]), pgm_read_byte(&bitmap[offset + 1]), pgm_read_byte(&bitmap[offset + 2])));
+        offset += 3;
+      }
+      y += rows;
+      h -= rows;
     }
     endWrite();
   }
@@ -746,6 +1208,7 @@ void Arduino_TFT::draw24bitRGBBitmap(
     int16_t x, int16_t y,
     uint8_t *bitmap, int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -766,14 +1229,20 @@ void Arduino_TFT::draw24bitRGBBitmap(
   }
   else
   {
-    uint32_t len = (uint32_t)w * h;
     uint32_t offset = 0;
     startWrite();
-    writeAddrWindow(x, y, w, h);
-    while (len--)
+    while (h > 0)
     {
-      _bus->write16(color565(bitmap[offset], bitmap[offset + 1], bitmap[offset + 2]));
-      offset += 3;
+      int16_t rows = scrollSplit(y, h);
+      uint32_t len = (uint32_t)w * rows;
+      writeAddrWindow(x, y, w, rows);
+      while (len--)
+      {
+        _bus->write16(color565(bitmap[offset], bitmap[offset + 1], bitmap[offset + 2]));
+        offset += 3;
+      }
+      y += rows;
+      h -= rows;
     }
     endWrite();
   }
@@ -781,6 +1250,7 @@ void Arduino_TFT::draw24bitRGBBitmap(
 
 void Arduino_TFT::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg)
 {
+  GFX_STATS_SCOPE(GFX_STATS_CHAR);
   uint16_t block_w;
   uint16_t block_h;
 
@@ -843,7 +1313,7 @@ void Arduino_TFT::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color
       startWrite();
       if (bg != color) // have background color
       {
-        writeAddrWindow(x, y - (baseline * textsize_y), block_w, block_h);
+        beginBlock(x, y - (baseline * textsize_y), block_w, block_h);
 
         uint16_t line_buf[block_w];
         int8_t i;
@@ -852,7 +1322,12 @@ void Arduino_TFT::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color
         {
           if ((yy < (baseline + yo)) || (yy > (baseline + yo + h - 1)))
           {
-            writeRepeat(bg, block_w * textsize_y);
+            for (int16_t n = textsize_y; n > 0;)
+            {
+              int16_t rows = blockRows(n);
+              writeRepeat(bg, (uint32_t)block_w * rows);
+              n -= rows;
+            }
           }
           else
           {
@@ -897,6 +1372,7 @@ void Arduino_TFT::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color
             }
             if (textsize_y == 1)
             {
+              blockRows(1);
               writePixels(line_buf, block_w);
             }
             else
@@ -905,10 +1381,12 @@ void Arduino_TFT::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color
               {
                 if (l < (textsize_y - text_pixel_margin))
                 {
+                  blockRows(1);
                   writePixels(line_buf, block_w);
                 }
                 else
                 {
+                  blockRows(1);
                   writeRepeat(bg, block_w);
                 }
               }
@@ -978,7 +1456,7 @@ void Arduino_TFT::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color
       startWrite();
       if (bg != color) // have background color
       {
-        writeAddrWindow(x, y, block_w, block_h);
+        beginBlock(x, y, block_w, block_h);
 
         uint16_t line_buf[block_w];
         if (textsize_x == 1)
@@ -1024,6 +1502,7 @@ void Arduino_TFT::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color
           }
           if (textsize_y == 1)
           {
+            blockRows(1);
             writePixels(line_buf, block_w);
           }
           else
@@ -1032,10 +1511,12 @@ void Arduino_TFT::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color
             {
               if (l < (textsize_y - text_pixel_margin))
               {
+                blockRows(1);
                 writePixels(line_buf, block_w);
               }
               else
               {
+                blockRows(1);
                 writeRepeat(bg, block_w);
               }
             }
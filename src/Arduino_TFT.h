@@ -8,6 +8,18 @@
 #include "Arduino_DataBus.h"
 #include "Arduino_GFX.h"
 
+#if !defined(LITTLE_FOOT_PRINT)
+// Consecutive writePixel() calls along a row or a column are combined into
+// one address window; this many pixels are buffered before they are sent.
+// Define it as 0 to send every pixel with its own window.
+#ifndef TFT_PIXEL_RUN_MAX_PIXELS
+#define TFT_PIXEL_RUN_MAX_PIXELS 32
+#endif
+#if (TFT_PIXEL_RUN_MAX_PIXELS > 1)
+#define TFT_PIXEL_RUN
+#endif
+#endif // !defined(LITTLE_FOOT_PRINT)
+
 class Arduino_TFT : public Arduino_GFX
 {
 public:
@@ -16,9 +28,16 @@ public:
   // This SHOULD be defined by the subclass:
   void setRotation(uint8_t r) override;
 
-  // This MUST be defined by the subclass:
-  // and also protected function: tftInit()
-  virtual void writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h) = 0;
+  // Opens a RAM write window. The column and row ranges last sent are cached
+  // and only the changed ones are rewritten, or both if either changed with
+  // _addr_both_axes set, so subclasses implement the raw
+  // register writes writeColumnAddr(), writeRowAddr() and writeMemoryStart()
+  // instead of overriding this.
+  virtual void writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h);
+  // Forget the cached window so the next one is sent in full. Called on
+  // rotation changes and by setAddrWindow(); call it after anything else
+  // wrote the panel's window registers, e.g. another driver sharing the bus.
+  void invalidateAddrWindow();
 
   bool begin(int32_t speed = GFX_NOT_DEFINED);
   void startWrite(void) override;
@@ -33,6 +52,29 @@ public:
   void setAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h);
   virtual void writeColor(uint16_t color);
 
+  // Hardware vertical scrolling, for drivers that support it (VSCRDEF and
+  // VSCRSADD). setScrollArea() keeps top_fixed panel rows at the top and
+  // bottom_fixed at the bottom in place, scrollTo() moves the rows between
+  // them up by offset, the rows moved out at the top coming back in at the
+  // bottom. In rotation 0 drawing stays in screen coordinates, so a log
+  // scrolls with scrollTo(getScrollOffset() + line height) and then draws
+  // only the new line at the bottom. Fills, pixels, bitmaps and text are
+  // split where the scrolled rows wrap. Other rotations scroll along the
+  // panel rows as well but are not remapped.
+  bool setScrollArea(uint16_t top_fixed, uint16_t bottom_fixed);
+  void scrollTo(uint16_t offset);
+  uint16_t getScrollOffset(void) const { return _scroll_offset; }
+
+  // Address window grid of the controller: windows start at a multiple of
+  // it and span a multiple of it, in columns and rows. 1 for most, 2 for
+  // AMOLED controllers such as the RM67162 whose partial updates are
+  // otherwise shifted or dropped. Only draw16bitRGBBitmapRect() can honour
+  // it, by sending the pixels around the part as well, so on these panels
+  // partial updates go through a canvas and Arduino_Canvas::flushRect().
+  // It sends the whole grown part in round mode too, and such controllers
+  // refuse setScrollArea(), whose wrap row would break the grid.
+  uint8_t getAddrAlign(void) const { return _addr_align; }
+
 // TFT optimization code, too big for ATMEL family
 #if !defined(LITTLE_FOOT_PRINT)
   virtual void writePixels(uint16_t *data, uint32_t size);
@@ -53,6 +95,7 @@ public:
   void draw16bitRGBBitmapWithMask(int16_t x, int16_t y, uint16_t *bitmap, uint8_t *mask, int16_t w, int16_t h) override;
   void draw16bitRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h) override;
   void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) override;
+  void draw16bitRGBBitmapRect(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h, int16_t rx, int16_t ry, int16_t rw, int16_t rh) override;
   void draw16bitBeRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) override;
   void draw24bitRGBBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h) override;
   void draw24bitRGBBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h) override;
@@ -60,8 +103,54 @@ public:
 #endif // !defined(LITTLE_FOOT_PRINT)
 
 protected:
+  // This MUST be defined by the subclass:
   virtual void tftInit() = 0;
 
+  // Raw window register writes used by writeAddrWindow(), in rotated panel
+  // coordinates before the _xStart/_yStart offsets are applied
+  virtual void writeColumnAddr(int16_t x, uint16_t w);
+  virtual void writeRowAddr(int16_t y, uint16_t h);
+  virtual void writeMemoryStart();
+
+  // Vertical scroll registers in panel rows, ROW_OFFSET1 included. The base
+  // writeScrollArea() returns false: the controller cannot scroll.
+  virtual bool writeScrollArea(uint16_t top_fixed, uint16_t rows);
+  virtual void writeScrollStart(uint16_t row);
+
+  // Memory row shown at screen row y while scrolled
+  GFX_INLINE int16_t scrolledRow(int16_t y)
+  {
+    int16_t r = y - (int16_t)_scroll_top;
+    if ((!_scroll_offset) || _rotation || (r < 0) || (r >= (int16_t)_scroll_rows))
+    {
+      return y;
+    }
+    r += _scroll_offset;
+    return _scroll_top + ((r >= (int16_t)_scroll_rows) ? (r - _scroll_rows) : r);
+  }
+  // Number of rows from y on, at most h, that lie in consecutive memory rows
+  int16_t scrollSplit(int16_t y, int16_t h);
+
+  // Sends the pending pixel run. Overrides of writeAddrWindow() must call it
+  // first, and so must anything else that writes to the panel inside a
+  // startWrite()/endWrite() bracket without going through writeAddrWindow().
+  void flushPixelRun();
+
+  // draw16bitRGBBitmap() in round mode, bitmap rows stride pixels apart
+  void writeRoundClippedBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t stride, int16_t w, int16_t h);
+
+#if !defined(LITTLE_FOOT_PRINT)
+  // draw16bitRGBBitmapRect() along one axis, see there
+  bool alignSpan(int16_t origin, int16_t size, int16_t max, int16_t offset, int16_t &r, int16_t &n);
+
+  // Opaque text is streamed row by row into a w x h block at x, y.
+  // beginBlock() starts it; blockRows() opens the next window, up to where
+  // the scrolled rows wrap, once the previous one is full and returns how
+  // many of the next n rows go into it.
+  void beginBlock(int16_t x, int16_t y, int16_t w, int16_t h);
+  int16_t blockRows(int16_t n);
+#endif // !defined(LITTLE_FOOT_PRINT)
+
   Arduino_DataBus *_bus;
   int8_t _rst;
   bool _ips;
@@ -71,6 +160,26 @@ protected:
   int16_t _currentX, _currentY;
   uint16_t _currentW, _currentH;
   int8_t _override_datamode = GFX_NOT_DEFINED;
+  uint16_t _scroll_top = 0, _scroll_rows = 0, _scroll_offset = 0;
+  uint8_t _addr_align = 1; // a power of two, set by the subclass constructor
+  // Set by drivers of controllers that take a new window only from CASET
+  // and RASET sent together (GC9A01, GC9106, GC9107, NV3023)
+  bool _addr_both_axes = false;
+#if !defined(LITTLE_FOOT_PRINT)
+  int16_t _block_x, _block_y, _block_w, _block_end; ///< text block, see blockRows()
+  int16_t _block_rows = 0;                          ///< rows left in its window
+#endif // !defined(LITTLE_FOOT_PRINT)
+
+#if defined(TFT_PIXEL_RUN)
+  void writePixelRun(bool last);
+
+  uint16_t _run_buf[TFT_PIXEL_RUN_MAX_PIXELS];
+  int16_t _run_x, _run_y;   ///< first pixel of the run
+  uint16_t _run_count = 0;  ///< pixels in the run, 0 if there is none
+  uint16_t _run_len = 0;    ///< pixels in _run_buf, not sent yet
+  uint8_t _run_dir;         ///< TFT_PIXEL_RUN_* direction
+  bool _run_open = false;   ///< address window already sent up to the edge
+#endif // defined(TFT_PIXEL_RUN)
 
 private:
 };
@@ -21,6 +21,7 @@ void Arduino_TFT_18bit::writeColor(uint16_t color)
   _bus->write(color << 3);
 }
 
+#if !defined(TFT_PIXEL_RUN)
 void Arduino_TFT_18bit::writePixelPreclipped(int16_t x, int16_t y, uint16_t color)
 {
   writeAddrWindow(x, y, 1, 1);
@@ -28,12 +29,28 @@ void Arduino_TFT_18bit::writePixelPreclipped(int16_t x, int16_t y, uint16_t colo
   _bus->write((color & 0x07E0) >> 3);
   _bus->write(color << 3);
 }
+#endif // !defined(TFT_PIXEL_RUN)
 
 void Arduino_TFT_18bit::writeRepeat(uint16_t color, uint32_t len)
 {
 #if defined(ESP8266) || defined(ESP32)
   uint8_t c[3] = {(uint8_t)((color & 0xF800) >> 8), (uint8_t)((color & 0x07E0) >> 3), (uint8_t)((color & 0x001F) << 3)};
   _bus->writePattern(c, 3, len);
+#elif !defined(LITTLE_FOOT_PRINT)
+  uint32_t n = (len < TFT_18BIT_STAGE_PIXELS) ? len : TFT_18BIT_STAGE_PIXELS;
+  uint8_t *p = _stage;
+  for (uint32_t i = 0; i < n; ++i)
+  {
+    *p++ = (uint8_t)((color & 0xF800) >> 8);
+    *p++ = (uint8_t)((color & 0x07E0) >> 3);
+    *p++ = (uint8_t)((color & 0x001F) << 3);
+  }
+  while (len)
+  {
+    n = (len < TFT_18BIT_STAGE_PIXELS) ? len : TFT_18BIT_STAGE_PIXELS;
+    _bus->writeBytes(_stage, n * 3);
+    len -= n;
+  }
 #else
   uint8_t c1 = (uint8_t)((color & 0xF800) >> 8);
   uint8_t c2 = (uint8_t)((color & 0x07E0) >> 3);
@@ -50,55 +67,74 @@ void Arduino_TFT_18bit::writeRepeat(uint16_t color, uint32_t len)
 // TFT optimization code, too big for ATMEL family
 #if !defined(LITTLE_FOOT_PRINT)
 
+// Pixels are converted into _stage and sent TFT_18BIT_STAGE_PIXELS at a time
+// with one writeBytes() call, instead of one virtual _bus->write() per byte.
+// Every user calls flushStage() before returning.
+GFX_INLINE void Arduino_TFT_18bit::stageBytes(uint8_t r, uint8_t g, uint8_t b)
+{
+  uint8_t *p = _stage + _stage_len;
+  p[0] = r;
+  p[1] = g;
+  p[2] = b;
+  _stage_len += 3;
+  if (_stage_len == sizeof(_stage))
+  {
+    _bus->writeBytes(_stage, sizeof(_stage));
+    _stage_len = 0;
+  }
+}
+
+GFX_INLINE void Arduino_TFT_18bit::stageRGB666(uint16_t color)
+{
+  stageBytes((color & 0xF800) >> 8, (color & 0x07E0) >> 3, color << 3);
+}
+
+void Arduino_TFT_18bit::flushStage()
+{
+  if (_stage_len)
+  {
+    _bus->writeBytes(_stage, _stage_len);
+    _stage_len = 0;
+  }
+}
+
 void Arduino_TFT_18bit::writePixels(uint16_t *data, uint32_t len)
 {
-  uint16_t d;
   while (len--)
   {
-    d = *data++;
-    _bus->write((d & 0xF800) >> 8);
-    _bus->write((d & 0x07E0) >> 3);
-    _bus->write(d << 3);
+    stageRGB666(*data++);
   }
+  flushStage();
 }
 
 // TFT tuned BITMAP / XBITMAP / GRAYSCALE / RGB BITMAP FUNCTIONS ---------------------
 
 void Arduino_TFT_18bit::writeIndexedPixels(uint8_t *bitmap, uint16_t *color_index, uint32_t len)
 {
-  uint16_t d;
   while (len--)
   {
-    d = color_index[*(bitmap++)];
-    _bus->write((d & 0xF800) >> 8);
-    _bus->write((d & 0x07E0) >> 3);
-    _bus->write(d << 3);
+    stageRGB666(color_index[*(bitmap++)]);
   }
+  flushStage();
 }
 
 void Arduino_TFT_18bit::writeIndexedPixelsDouble(uint8_t *bitmap, uint16_t *color_index, uint32_t len)
 {
-  uint8_t r, g, b;
   uint16_t d;
   while (len--)
   {
     d = color_index[*(bitmap++)];
-    r = (d & 0xF800) >> 8;
-    g = (d & 0x07E0) >> 3;
-    b = d << 3;
-    _bus->write(r);
-    _bus->write(g);
-    _bus->write(b);
-    _bus->write(r);
-    _bus->write(g);
-    _bus->write(b);
+    stageRGB666(d);
+    stageRGB666(d);
   }
+  flushStage();
 }
 
 void Arduino_TFT_18bit::drawBitmap(
     int16_t x, int16_t y,
     const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -120,25 +156,31 @@ void Arduino_TFT_18bit::drawBitmap(
   else
   {
     uint16_t c;
-    int32_t pixels = w * h;
+    int32_t i = 0;
     uint8_t byte = 0;
     uint16_t idx = 0;
     startWrite();
-    writeAddrWindow(x, y, w, h);
-    for (int32_t i = 0; i < pixels; i++)
+    while (h > 0)
     {
-      if (i & 7)
+      int16_t rows = scrollSplit(y, h);
+      int32_t end = i + (int32_t)w * rows;
+      writeAddrWindow(x, y, w, rows);
+      for (; i < end; i++)
       {
-        byte <<= 1;
-      }
-      else
-      {
-        byte = pgm_read_byte(&bitmap[idx++]);
+        if (i & 7)
+        {
+          byte <<= 1;
+        }
+        else
+        {
+          byte = pgm_read_byte(&bitmap[idx++]);
+        }
+        c = (byte & 0x80) ? color : bg;
+        stageRGB666(c);
       }
-      c = (byte & 0x80) ? color : bg;
-      _bus->write((c & 0xF800) >> 8);
-      _bus->write((c & 0x07E0) >> 3);
-      _bus->write((c & 0x001F) << 3);
+      flushStage();
+      y += rows;
+      h -= rows;
     }
     endWrite();
   }
@@ -148,6 +190,7 @@ void Arduino_TFT_18bit::drawBitmap(
     int16_t x, int16_t y,
     uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -169,24 +212,30 @@ void Arduino_TFT_18bit::drawBitmap(
   else
   {
     uint16_t c;
-    int32_t pixels = w * h;
+    int32_t i = 0;
     uint8_t byte = 0;
     startWrite();
-    writeAddrWindow(x, y, w, h);
-    for (int32_t i = 0; i < pixels; i++)
+    while (h > 0)
     {
-      if (i & 7)
-      {
-        byte <<= 1;
-      }
-      else
+      int16_t rows = scrollSplit(y, h);
+      int32_t end = i + (int32_t)w * rows;
+      writeAddrWindow(x, y, w, rows);
+      for (; i < end; i++)
       {
-        byte = *(bitmap++);
+        if (i & 7)
+        {
+          byte <<= 1;
+        }
+        else
+        {
+          byte = *(bitmap++);
+        }
+        c = (byte & 0x80) ? color : bg;
+        stageRGB666(c);
       }
-      c = (byte & 0x80) ? color : bg;
-      _bus->write((c & 0xF800) >> 8);
-      _bus->write((c & 0x07E0) >> 3);
-      _bus->write((c & 0x001F) << 3);
+      flushStage();
+      y += rows;
+      h -= rows;
     }
     endWrite();
   }
@@ -196,6 +245,7 @@ void Arduino_TFT_18bit::drawGrayscaleBitmap(
     int16_t x, int16_t y,
     const uint8_t bitmap[], int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -218,16 +268,20 @@ void Arduino_TFT_18bit::drawGrayscaleBitmap(
   {
     uint8_t v;
     startWrite();
-    writeAddrWindow(x, y, w, h);
-    for (int16_t j = 0; j < h; j++, y++)
+    while (h > 0)
     {
-      for (int16_t i = 0; i < w; i++)
+      int16_t rows = scrollSplit(y, h);
+      uint32_t len = (uint32_t)w * rows;
+      writeAddrWindow(x, y, w, rows);
+      for (uint32_t i = 0; i < len; i++)
       {
-        v = pgm_read_byte(&bitmap[j * w + i]);
-        _bus->write(v);
-        _bus->write(v);
-        _bus->write(v);
+        v = pgm_read_byte(&bitmap[i]);
+        stageBytes(v, v, v);
       }
+      flushStage();
+      bitmap += len;
+      y += rows;
+      h -= rows;
     }
     endWrite();
   }
@@ -237,6 +291,7 @@ void Arduino_TFT_18bit::drawGrayscaleBitmap(
     int16_t x, int16_t y,
     uint8_t *bitmap, int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -259,16 +314,20 @@ void Arduino_TFT_18bit::drawGrayscaleBitmap(
   {
     uint8_t v;
     startWrite();
-    writeAddrWindow(x, y, w, h);
-    for (int16_t j = 0; j < h; j++, y++)
+    while (h > 0)
     {
-      for (int16_t i = 0; i < w; i++)
+      int16_t rows = scrollSplit(y, h);
+      uint32_t len = (uint32_t)w * rows;
+      writeAddrWindow(x, y, w, rows);
+      for (uint32_t i = 0; i < len; i++)
       {
-        v = bitmap[j * w + i];
-        _bus->write(v);
-        _bus->write(v);
-        _bus->write(v);
+        v = bitmap[i];
+        stageBytes(v, v, v);
       }
+      flushStage();
+      bitmap += len;
+      y += rows;
+      h -= rows;
     }
     endWrite();
   }
@@ -278,6 +337,7 @@ void Arduino_TFT_18bit::drawIndexedBitmap(
     int16_t x, int16_t y,
     uint8_t *bitmap, uint16_t *color_index, int16_t w, int16_t h, int16_t x_skip)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -299,11 +359,17 @@ void Arduino_TFT_18bit::drawIndexedBitmap(
   else
   {
     startWrite();
-    writeAddrWindow(x, y, w, h);
-    while (h--)
+    while (h > 0)
     {
-      writeIndexedPixels(bitmap, color_index, w);
-      bitmap += w + x_skip;
+      int16_t rows = scrollSplit(y, h);
+      writeAddrWindow(x, y, w, rows);
+      for (int16_t j = 0; j < rows; j++)
+      {
+        writeIndexedPixels(bitmap, color_index, w);
+        bitmap += w + x_skip;
+      }
+      y += rows;
+      h -= rows;
     }
     endWrite();
   }
@@ -313,6 +379,7 @@ void Arduino_TFT_18bit::draw16bitRGBBitmap(
     int16_t x, int16_t y,
     const uint16_t bitmap[], int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -333,18 +400,20 @@ void Arduino_TFT_18bit::draw16bitRGBBitmap(
   }
   else
   {
-    uint16_t d;
     startWrite();
-    writeAddrWindow(x, y, w, h);
-    for (int16_t j = 0; j < h; j++, y++)
+    while (h > 0)
     {
-      for (int16_t i = 0; i < w; i++)
+      int16_t rows = scrollSplit(y, h);
+      uint32_t len = (uint32_t)w * rows;
+      writeAddrWindow(x, y, w, rows);
+      for (uint32_t i = 0; i < len; i++)
       {
-        d = pgm_read_word(&bitmap[j * w + i]);
-        _bus->write((d & 0xF800) >> 8);
-        _bus->write((d & 0x07E0) >> 3);
-        _bus->write(d << 3);
+        stageRGB666(pgm_read_word(&bitmap[i]));
       }
+      flushStage();
+      bitmap += len;
+      y += rows;
+      h -= rows;
     }
     endWrite();
   }
@@ -354,6 +423,7 @@ void Arduino_TFT_18bit::draw16bitRGBBitmapWithMask(
     int16_t x, int16_t y,
     uint16_t *bitmap, uint8_t *mask, int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -374,7 +444,6 @@ void Arduino_TFT_18bit::draw16bitRGBBitmapWithMask(
   }
   else
   {
-    uint16_t d;
     int32_t offset = 0, maskIdx = 0, len = 0;
     uint8_t byte = 0;
     startWrite();
@@ -399,13 +468,7 @@ void Arduino_TFT_18bit::draw16bitRGBBitmapWithMask(
           if (len)
           {
             writeAddrWindow(x + i - len, y, len, 1);
-            for (int16_t i = len; i > 0; i--)
-            {
-              d = bitmap[offset - i];
-              _bus->write((d & 0xF800) >> 8);
-              _bus->write((d & 0x07E0) >> 3);
-              _bus->write(d << 3);
-            }
+            writePixels(bitmap + offset - len, len);
             len = 0;
           }
         }
@@ -413,14 +476,8 @@ void Arduino_TFT_18bit::draw16bitRGBBitmapWithMask(
       }
       if (len)
       {
-        writeAddrWindow(x + w - 1 - len, y, len, 1);
-        for (int16_t i = len; i > 0; i--)
-        {
-          d = bitmap[offset - i];
-          _bus->write((d & 0xF800) >> 8);
-          _bus->write((d & 0x07E0) >> 3);
-          _bus->write(d << 3);
-        }
+        writeAddrWindow(x + w - len, y, len, 1);
+        writePixels(bitmap + offset - len, len);
         len = 0;
       }
     }
@@ -432,6 +489,7 @@ void Arduino_TFT_18bit::draw16bitRGBBitmap(
     int16_t x, int16_t y,
     uint16_t *bitmap, int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -452,18 +510,15 @@ void Arduino_TFT_18bit::draw16bitRGBBitmap(
   }
   else
   {
-    uint16_t d;
     startWrite();
-    writeAddrWindow(x, y, w, h);
-    for (int16_t j = 0; j < h; j++, y++)
+    while (h > 0)
     {
-      for (int16_t i = 0; i < w; i++)
-      {
-        d = bitmap[j * w + i];
-        _bus->write((d & 0xF800) >> 8);
-        _bus->write((d & 0x07E0) >> 3);
-        _bus->write(d << 3);
-      }
+      int16_t rows = scrollSplit(y, h);
+      writeAddrWindow(x, y, w, rows);
+      writePixels(bitmap, (uint32_t)w * rows);
+      bitmap += (int32_t)w * rows;
+      y += rows;
+      h -= rows;
     }
     endWrite();
   }
@@ -473,6 +528,7 @@ void Arduino_TFT_18bit::draw16bitBeRGBBitmap(
     int16_t x, int16_t y,
     uint16_t *bitmap, int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -495,16 +551,20 @@ void Arduino_TFT_18bit::draw16bitBeRGBBitmap(
   {
     uint16_t d;
     startWrite();
-    writeAddrWindow(x, y, w, h);
-    for (int16_t j = 0; j < h; j++, y++)
+    while (h > 0)
     {
-      for (int16_t i = 0; i < w; i++)
+      int16_t rows = scrollSplit(y, h);
+      uint32_t len = (uint32_t)w * rows;
+      writeAddrWindow(x, y, w, rows);
+      for (uint32_t i = 0; i < len; i++)
       {
-        d = bitmap[j * w + i];
-        _bus->write((d & 0x00F8));
-        _bus->write(((d & 0xE000) >> 11) | (d & 0x0007) << 5);
-        _bus->write((d & 0x1F00) >> 5);
+        d = bitmap[i];
+        stageBytes(d & 0x00F8, ((d & 0xE000) >> 11) | (d & 0x0007) << 5, (d & 0x1F00) >> 5);
       }
+      flushStage();
+      bitmap += len;
+      y += rows;
+      h -= rows;
     }
     endWrite();
   }
@@ -514,6 +574,7 @@ void Arduino_TFT_18bit::draw24bitRGBBitmap(
     int16_t x, int16_t y,
     const uint8_t bitmap[], int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -534,17 +595,21 @@ void Arduino_TFT_18bit::draw24bitRGBBitmap(
   }
   else
   {
-    int16_t offset = 0;
+    uint32_t offset = 0;
     startWrite();
-    writeAddrWindow(x, y, w, h);
-    for (int16_t j = 0; j < h; j++, y++)
+    while (h > 0)
     {
-      for (int16_t i = 0; i < w; i++)
+      int16_t rows = scrollSplit(y, h);
+      uint32_t len = (uint32_t)w * rows;
+      writeAddrWindow(x, y, w, rows);
+      while (len--)
       {
-        _bus->write(pgm_read_byte(&bitmap[offset++]));
-        _bus->write(pgm_read_byte(&bitmap[offset++]));
-        _bus->write(pgm_read_byte(&bitmap[offset++]));
+        stageBytes(pgm_read_byte(&bitmap[offset]), pgm_read_byte(&bitmap[offset + 1]), pgm_read_byte(&bitmap[offset + 2]));
+        offset += 3;
       }
+      flushStage();
+      y += rows;
+      h -= rows;
     }
     endWrite();
   }
@@ -554,6 +619,7 @@ void Arduino_TFT_18bit::draw24bitRGBBitmap(
     int16_t x, int16_t y,
     uint8_t *bitmap, int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -575,8 +641,16 @@ void Arduino_TFT_18bit::draw24bitRGBBitmap(
   else
   {
     startWrite();
-    writeAddrWindow(x, y, w, h);
-    _bus->writeBytes(bitmap, w * h * 3);
+    while (h > 0)
+    {
+      int16_t rows = scrollSplit(y, h);
+      uint32_t len = (uint32_t)w * rows * 3;
+      writeAddrWindow(x, y, w, rows);
+      _bus->writeBytes(bitmap, len);
+      bitmap += len;
+      y += rows;
+      h -= rows;
+    }
     endWrite();
   }
 }
@@ -9,13 +9,20 @@
 #include "Arduino_GFX.h"
 #include "Arduino_TFT.h"
 
+// pixels converted to RGB666 per writeBytes() call, 3 bytes each
+#ifndef TFT_18BIT_STAGE_PIXELS
+#define TFT_18BIT_STAGE_PIXELS 64
+#endif
+
 class Arduino_TFT_18bit : public Arduino_TFT
 {
 public:
   Arduino_TFT_18bit(Arduino_DataBus *bus, int8_t rst, uint8_t r, bool ips, int16_t w, int16_t h, uint8_t col_offset1, uint8_t row_offset1, uint8_t col_offset2, uint8_t row_offset2);
 
   void writeColor(uint16_t color) override;
+#if !defined(TFT_PIXEL_RUN)
   void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override;
+#endif // !defined(TFT_PIXEL_RUN)
   void writeRepeat(uint16_t color, uint32_t len) override;
 
 // TFT optimization code, too big for ATMEL family
@@ -39,6 +46,14 @@ public:
 
 protected:
 private:
+#if !defined(LITTLE_FOOT_PRINT)
+  void stageRGB666(uint16_t color);
+  void stageBytes(uint8_t r, uint8_t g, uint8_t b);
+  void flushStage();
+
+  uint8_t _stage[TFT_18BIT_STAGE_PIXELS * 3];
+  uint16_t _stage_len = 0;
+#endif // !defined(LITTLE_FOOT_PRINT)
 };
 
 #endif
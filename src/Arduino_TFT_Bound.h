@@ -0,0 +1,171 @@
+/*
+ * Compile time binding of an Arduino_TFT driver to a concrete data bus.
+ *
+ * Arduino_TFT talks to its bus through Arduino_DataBus pointers, so every
+ * pixel write costs virtual calls from Arduino_GFX into the driver and from
+ * the driver into the bus. On bit-banged buses (Arduino_SWSPI, Arduino_SWPAR8,
+ * Arduino_SWPAR16, Arduino_AVRPAR8, ...) that overhead is comparable to the
+ * bus time itself. Arduino_TFT_Bound<Driver, Bus> derives from the driver and
+ * reimplements the hot path with the bus type known: the address window
+ * cache calls the driver's register writes and the pixel writes call the
+ * bus directly, without virtual dispatch. With link time optimization the
+ * calls can be inlined as well.
+ *
+ *   Arduino_SWSPI *bus = new Arduino_SWSPI(DC, CS, SCK, MOSI);
+ *   Arduino_TFT_Bound<Arduino_ILI9341, Arduino_SWSPI> *gfx =
+ *       new Arduino_TFT_Bound<Arduino_ILI9341, Arduino_SWSPI>(bus, RST, 0, false);
+ *
+ * The constructor takes the same arguments as the driver's. Everything
+ * else, including the runtime polymorphic API, is unchanged, so the bound
+ * display can still be passed around as Arduino_GFX *. Register writes
+ * inside the driver (window addresses, MADCTL) still go through _bus.
+ *
+ * Drivers that override the hot path themselves (the *_18bit drivers,
+ * SSD1283A, LT7680) are rejected at compile time.
+ */
+#ifndef _ARDUINO_TFT_BOUND_H_
+#define _ARDUINO_TFT_BOUND_H_
+
+#include "Arduino_DataBus.h"
+#include "Arduino_GFX.h"
+#include "Arduino_TFT.h"
+
+template <typename A, typename B>
+struct gfx_is_same
+{
+  static const bool value = false;
+};
+
+template <typename A>
+struct gfx_is_same<A, A>
+{
+  static const bool value = true;
+};
+
+// true if Driver does not redeclare the Arduino_TFT member: &Driver::m then
+// still has the type of a pointer to an Arduino_TFT member
+#define TFT_BOUND_INHERITS(m, signature) \
+  (gfx_is_same<decltype(&Driver::m), void(Arduino_TFT::*) signature>::value)
+
+template <class Driver, class Bus>
+class Arduino_TFT_Bound : public Driver
+{
+  static_assert(__is_base_of(Arduino_TFT, Driver), "Driver must be an Arduino_TFT");
+  static_assert(__is_base_of(Arduino_DataBus, Bus), "Bus must be an Arduino_DataBus");
+  static_assert(TFT_BOUND_INHERITS(writeAddrWindow, (int16_t, int16_t, uint16_t, uint16_t)),
+                "Driver overrides writeAddrWindow()");
+  static_assert(TFT_BOUND_INHERITS(writePixelPreclipped, (int16_t, int16_t, uint16_t)),
+                "Driver overrides writePixelPreclipped()");
+  static_assert(TFT_BOUND_INHERITS(writeFillRectPreclipped, (int16_t, int16_t, int16_t, int16_t, uint16_t)),
+                "Driver overrides writeFillRectPreclipped()");
+  static_assert(TFT_BOUND_INHERITS(writeRepeat, (uint16_t, uint32_t)),
+                "Driver overrides writeRepeat()");
+  static_assert(TFT_BOUND_INHERITS(writeColor, (uint16_t)),
+                "Driver overrides writeColor()");
+#if !defined(LITTLE_FOOT_PRINT)
+  static_assert(TFT_BOUND_INHERITS(writePixels, (uint16_t *, uint32_t)),
+                "Driver overrides writePixels()");
+#endif // !defined(LITTLE_FOOT_PRINT)
+
+public:
+  template <typename... Args>
+  Arduino_TFT_Bound(Bus *bus, Args... args)
+      : Driver(bus, args...), _typed_bus(bus)
+  {
+  }
+
+  // same window cache as Arduino_TFT::writeAddrWindow()
+  void writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h) override
+  {
+    this->flushPixelRun();
+    boundAddrWindow(x, y, w, h);
+  }
+
+#if !defined(TFT_PIXEL_RUN)
+  void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override
+  {
+    boundAddrWindow(x, y, 1, 1);
+    _typed_bus->Bus::write16(color);
+  }
+#endif // !defined(TFT_PIXEL_RUN)
+
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override
+  {
+#ifdef ESP8266
+    yield();
+#endif
+    int16_t rows = this->scrollSplit(y, h);
+    if (rows < h)
+    {
+      writeFillRectPreclipped(x, y, w, rows, color);
+      writeFillRectPreclipped(x, y + rows, w, h - rows, color);
+      return;
+    }
+    this->flushPixelRun();
+    boundAddrWindow(x, y, w, h);
+    _typed_bus->Bus::writeRepeat(color, (uint32_t)w * h);
+  }
+
+  void writeRepeat(uint16_t color, uint32_t len) override
+  {
+    _typed_bus->Bus::writeRepeat(color, len);
+  }
+
+  void writeColor(uint16_t color) override
+  {
+    _typed_bus->Bus::write16(color);
+  }
+
+#if !defined(LITTLE_FOOT_PRINT)
+  void writePixels(uint16_t *data, uint32_t len) override
+  {
+    _typed_bus->Bus::writePixels(data, len);
+  }
+#endif // !defined(LITTLE_FOOT_PRINT)
+
+protected:
+  GFX_INLINE void boundAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+  {
+    GFX_STATS_ADDR_WINDOW(w, h);
+    y = this->scrolledRow(y);
+
+    bool col = (x != this->_currentX) || (w != this->_currentW);
+    bool row = (y != this->_currentY) || (h != this->_currentH);
+    if (this->_addr_both_axes)
+    {
+      col = row = (col || row);
+    }
+
+    if (col)
+    {
+      GFX_STATS_COUNT(addr_cache_misses);
+      this->_currentX = x;
+      this->_currentW = w;
+      this->Driver::writeColumnAddr(x, w);
+    }
+    else
+    {
+      GFX_STATS_COUNT(addr_cache_hits);
+    }
+
+    if (row)
+    {
+      GFX_STATS_COUNT(addr_cache_misses);
+      this->_currentY = y;
+      this->_currentH = h;
+      this->Driver::writeRowAddr(y, h);
+    }
+    else
+    {
+      GFX_STATS_COUNT(addr_cache_hits);
+    }
+
+    this->Driver::writeMemoryStart();
+  }
+
+  Bus *_typed_bus;
+};
+
+#undef TFT_BOUND_INHERITS
+
+#endif // _ARDUINO_TFT_BOUND_H_
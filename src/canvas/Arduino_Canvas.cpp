@@ -13,6 +13,29 @@ Arduino_Canvas::Arduino_Canvas(
   setRotation(r);
 }
 
+void Arduino_Canvas::setRotation(uint8_t r)
+{
+  Arduino_GFX::setRotation(r);
+  if (_hw_output)
+  {
+    _fb_width = _width;
+    _fb_height = _height;
+    _fb_rotation = 0;
+  }
+  else
+  {
+    _fb_width = WIDTH;
+    _fb_height = HEIGHT;
+    _fb_rotation = _rotation;
+  }
+}
+
+void Arduino_Canvas::setHardwareRotation(Arduino_GFX *output)
+{
+  _hw_output = output;
+  setRotation(_rotation);
+}
+
 Arduino_Canvas::~Arduino_Canvas()
 {
   if (_framebuffer)
@@ -58,193 +81,74 @@ bool Arduino_Canvas::begin(int32_t speed)
 
 void Arduino_Canvas::writePixelPreclipped(int16_t x, int16_t y, uint16_t color)
 {
-
-  uint16_t *fb = _framebuffer;
-  switch (_rotation)
-  {
-  case 1:
-    fb += (int32_t)x * _height;
-    fb += _max_y - y;
-    *fb = color;
-    break;
-  case 2:
-    fb += (int32_t)(_max_y - y) * _width;
-    fb += _max_x - x;
-    *fb = color;
-    break;
-  case 3:
-    fb += (int32_t)(_max_x - x) * _height;
-    fb += y;
-    *fb = color;
-    break;
-  default: // case 0:
-    fb += (int32_t)y * _width;
-    fb += x;
-    *fb = color;
-  }
+  raster().pixel(_fb_rotation, x, y, color);
 }
 
 void Arduino_Canvas::writeFastVLine(int16_t x, int16_t y,
                                     int16_t h, uint16_t color)
 {
-  switch (_rotation)
+  if (_isRoundMode)
   {
-  case 1:
-    writeFastHLineCore(_height - y - h, x, h, color);
-    break;
-  case 2:
-    writeFastVLineCore(_max_x - x, _height - y - h, h, color);
-    break;
-  case 3:
-    writeFastHLineCore(y, _max_x - x, h, color);
-    break;
-  default: // case 0:
-    writeFastVLineCore(x, y, h, color);
+    if (!_ordered_in_range(x, 0, _max_x) || !Raster::clipSpan(y, h, _max_y))
+    {
+      return;
+    }
+    int16_t y2 = y + h - 1;
+    if (!clipRoundSpan(x, &y, &y2))
+    {
+      return;
+    }
+    h = y2 - y + 1;
   }
+  raster().vline(_fb_rotation, x, y, h, color);
 }
 
 void Arduino_Canvas::writeFastVLineCore(int16_t x, int16_t y,
                                         int16_t h, uint16_t color)
 {
   // log_i("writeFastVLineCore(x: %d, y: %d, h: %d)", x, y, h);
-  if (_ordered_in_range(x, 0, MAX_X) && h)
-  { // X on screen, nonzero height
-    if (h < 0)
-    {             // If negative height...
-      y += h + 1; //   Move Y to top edge
-      h = -h;     //   Use positive height
-    }
-    if (y <= MAX_Y)
-    { // Not off bottom
-      int16_t y2 = y + h - 1;
-      if (y2 >= 0)
-      { // Not off top
-        // Line partly or fully overlaps screen
-        if (y < 0)
-        {
-          y = 0;
-          h = y2 + 1;
-        } // Clip top
-        if (y2 > MAX_Y)
-        {
-          h = MAX_Y - y + 1;
-        } // Clip bottom
-
-        uint16_t *fb = _framebuffer + ((int32_t)y * WIDTH) + x;
-        while (h--)
-        {
-          *fb = color;
-          fb += WIDTH;
-        }
-      }
-    }
-  }
+  raster().vline(0, x, y, h, color);
 }
 
 void Arduino_Canvas::writeFastHLine(int16_t x, int16_t y,
                                     int16_t w, uint16_t color)
 {
   // log_i("writeFastHLine(x: %d, y: %d, w: %d)", x, y, w);
-  switch (_rotation)
+  if (_isRoundMode)
   {
-  case 1:
-    writeFastVLineCore(_max_y - y, x, w, color);
-    break;
-  case 2:
-    writeFastHLineCore(_width - x - w, _max_y - y, w, color);
-    break;
-  case 3:
-    writeFastVLineCore(y, _width - x - w, w, color);
-    break;
-  default: // case 0:
-    writeFastHLineCore(x, y, w, color);
+    if (!_ordered_in_range(y, 0, _max_y) || !Raster::clipSpan(x, w, _max_x))
+    {
+      return;
+    }
+    int16_t x2 = x + w - 1;
+    if (!clipRoundSpan(y, &x, &x2))
+    {
+      return;
+    }
+    w = x2 - x + 1;
   }
+  raster().hline(_fb_rotation, x, y, w, color);
 }
 
 void Arduino_Canvas::writeFastHLineCore(int16_t x, int16_t y,
                                         int16_t w, uint16_t color)
 {
   // log_i("writeFastHLineCore(x: %d, y: %d, w: %d)", x, y, w);
-  if (_ordered_in_range(y, 0, MAX_Y) && w)
-  { // Y on screen, nonzero width
-    if (w < 0)
-    {             // If negative width...
-      x += w + 1; //   Move X to left edge
-      w = -w;     //   Use positive width
-    }
-    if (x <= MAX_X)
-    { // Not off right
-      int16_t x2 = x + w - 1;
-      if (x2 >= 0)
-      { // Not off left
-        // Line partly or fully overlaps screen
-        if (x < 0)
-        {
-          x = 0;
-          w = x2 + 1;
-        } // Clip left
-        if (x2 > MAX_X)
-        {
-          w = MAX_X - x + 1;
-        } // Clip right
-
-        uint16_t *fb = _framebuffer + ((int32_t)y * WIDTH) + x;
-        while (w--)
-        {
-          *(fb++) = color;
-        }
-      }
-    }
-  }
+  raster().hline(0, x, y, w, color);
 }
 
 void Arduino_Canvas::writeFillRectPreclipped(int16_t x, int16_t y,
                                              int16_t w, int16_t h, uint16_t color)
 {
   // log_i("writeFillRectPreclipped(x: %d, y: %d, w: %d, h: %d)", x, y, w, h);
-  if (_rotation > 0)
-  {
-    int16_t t = x;
-    switch (_rotation)
-    {
-    case 1:
-      x = WIDTH - y - h;
-      y = t;
-      t = w;
-      w = h;
-      h = t;
-      break;
-    case 2:
-      x = WIDTH - x - w;
-      y = HEIGHT - y - h;
-      break;
-    case 3:
-      x = y;
-      y = HEIGHT - t - w;
-      t = w;
-      w = h;
-      h = t;
-      break;
-    }
-  }
-  // log_i("adjusted writeFillRectPreclipped(x: %d, y: %d, w: %d, h: %d)", x, y, w, h);
-  uint16_t *row = _framebuffer;
-  row += y * WIDTH;
-  row += x;
-  for (int j = 0; j < h; j++)
-  {
-    for (int i = 0; i < w; i++)
-    {
-      row[i] = color;
-    }
-    row += WIDTH;
-  }
+  raster().fillRect(_fb_rotation, x, y, w, h, color);
 }
 
 void Arduino_Canvas::drawIndexedBitmap(
     int16_t x, int16_t y,
     uint8_t *bitmap, uint16_t *color_index, int16_t w, int16_t h, int16_t x_skip)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -311,6 +215,7 @@ void Arduino_Canvas::drawIndexedBitmap(
     int16_t x, int16_t y,
     uint8_t *bitmap, uint16_t *color_index, uint8_t chroma_key, int16_t w, int16_t h, int16_t x_skip)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -402,7 +307,8 @@ void Arduino_Canvas::drawIndexedBitmap(
 void Arduino_Canvas::draw16bitRGBBitmap(int16_t x, int16_t y,
                                         uint16_t *bitmap, int16_t w, int16_t h)
 {
-  switch (_rotation)
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
+  switch (_fb_rotation)
   {
   case 1:
     gfx_draw_bitmap_to_framebuffer_rotate_1(bitmap, w, h, _framebuffer, x, y, _width, _height);
@@ -422,6 +328,7 @@ void Arduino_Canvas::draw16bitRGBBitmapWithTranColor(
     int16_t x, int16_t y,
     uint16_t *bitmap, uint16_t transparent_color, int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -502,6 +409,7 @@ void Arduino_Canvas::draw16bitRGBBitmapWithTranColor(
 void Arduino_Canvas::draw16bitBeRGBBitmap(int16_t x, int16_t y,
                                           uint16_t *bitmap, int16_t w, int16_t h)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (
       ((x + w - 1) < 0) || // Outside left
       ((y + h - 1) < 0) || // Outside top
@@ -555,18 +463,127 @@ void Arduino_Canvas::draw16bitBeRGBBitmap(int16_t x, int16_t y,
 
 void Arduino_Canvas::flush()
 {
+  GFX_STATS_SCOPE(GFX_STATS_FLUSH);
   if (_output)
   {
-    _output->draw16bitRGBBitmap(_output_x, _output_y, _framebuffer, WIDTH, HEIGHT);
+    if (_hw_output)
+    {
+      flushRotated(0, 0, _fb_width, _fb_height);
+    }
+    else if (_isRoundMode)
+    {
+      flushRound(_output_x, _output_y);
+    }
+    else
+    {
+      _output->draw16bitRGBBitmap(_output_x, _output_y, _framebuffer, WIDTH, HEIGHT);
+    }
+  }
+}
+
+void Arduino_Canvas::flushRect(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  GFX_STATS_SCOPE(GFX_STATS_FLUSH);
+  if ((!_output) || !Raster::clipSpan(x, w, _max_x) || !Raster::clipSpan(y, h, _max_y))
+  {
+    return;
+  }
+  // to framebuffer order
+  raster().mapRect(_fb_rotation, x, y, w, h);
+  if (_hw_output)
+  {
+    flushRotated(x, y, w, h);
+  }
+  else
+  {
+    _output->draw16bitRGBBitmapRect(_output_x, _output_y, _framebuffer, WIDTH, HEIGHT, x, y, w, h);
+  }
+}
+
+// Hardware rotation: turns the output by the canvas rotation on top of its
+// own and sends the framebuffer as it is, at where the canvas area lies in
+// that rotation.
+void Arduino_Canvas::flushRotated(int16_t rx, int16_t ry, int16_t rw, int16_t rh)
+{
+  uint8_t output_r = _hw_output->getRotation() & 3;
+  uint8_t r = (output_r + _rotation) & 3;
+  int16_t native_w = (output_r & 1) ? _hw_output->height() : _hw_output->width();
+  int16_t native_h = (output_r & 1) ? _hw_output->width() : _hw_output->height();
+
+  // canvas area in output rotation, to the panel native orientation and on
+  // to rotation r, mapRect() of the opposite rotation undoing that of r
+  int16_t x = _output_x, y = _output_y, w = WIDTH, h = HEIGHT;
+  Raster native = {nullptr, native_w, native_h};
+  native.mapRect(output_r, x, y, w, h);
+  Raster rotated = {nullptr, (r & 1) ? native_h : native_w, (r & 1) ? native_w : native_h};
+  rotated.mapRect((4 - r) & 3, x, y, w, h);
+
+  if (r != output_r)
+  {
+    _hw_output->setRotation(r);
+  }
+  if ((rw < _fb_width) || (rh < _fb_height))
+  {
+    _output->draw16bitRGBBitmapRect(x, y, _framebuffer, _fb_width, _fb_height, rx, ry, rw, rh);
+  }
+  else if (_isRoundMode)
+  {
+    flushRound(x, y);
+  }
+  else
+  {
+    _output->draw16bitRGBBitmap(x, y, _framebuffer, _fb_width, _fb_height);
+  }
+  if (r != output_r)
+  {
+    _hw_output->setRotation(output_r);
+  }
+}
+
+// Round mode: only the part of every row inside the circle goes out, the
+// rows visible across the whole width as one bitmap.
+void Arduino_Canvas::flushRound(int16_t output_x, int16_t output_y)
+{
+  int16_t max_x = _fb_width - 1;
+  int16_t y = 0;
+  while (y < _fb_height)
+  {
+    int16_t x1 = 0, x2 = max_x;
+    if (!clipRoundSpan(y, &x1, &x2))
+    {
+      ++y;
+    }
+    else if ((x1 == 0) && (x2 == max_x))
+    {
+      int16_t y2 = y + 1;
+      while (y2 < _fb_height)
+      {
+        int16_t n1 = 0, n2 = max_x;
+        if (!clipRoundSpan(y2, &n1, &n2) || (n1 != 0) || (n2 != max_x))
+        {
+          break;
+        }
+        ++y2;
+      }
+      _output->draw16bitRGBBitmap(output_x, output_y + y, _framebuffer + ((int32_t)y * _fb_width), _fb_width, y2 - y);
+      y = y2;
+    }
+    else
+    {
+      _output->draw16bitRGBBitmap(output_x + x1, output_y + y, _framebuffer + ((int32_t)y * _fb_width) + x1, x2 - x1 + 1, 1);
+      ++y;
+    }
   }
 }
 
 void Arduino_Canvas::flushQuad(void)
 {
+  GFX_STATS_SCOPE(GFX_STATS_FLUSH);
   int16_t y = _output_y;
   uint16_t *row1 = _framebuffer;
   uint16_t *row2 = _framebuffer + WIDTH;
-  if (_output)
+  // the framebuffer is not in WIDTH x HEIGHT panel order then
+  if (_output && !_hw_output)
   {
     int16_t hQuad = HEIGHT / 2;
     int16_t wQuad = WIDTH / 2;
@@ -5,6 +5,7 @@
 #define _ARDUINO_CANVAS_H_
 
 #include "../Arduino_GFX.h"
+#include "Arduino_Canvas_Raster.h"
 
 class Arduino_Canvas : public Arduino_GFX
 {
@@ -13,6 +14,7 @@ public:
   ~Arduino_Canvas();
 
   bool begin(int32_t speed = GFX_NOT_DEFINED) override;
+  void setRotation(uint8_t r) override;
   void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override;
   void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
   void writeFastVLineCore(int16_t x, int16_t y, int16_t h, uint16_t color);
@@ -26,15 +28,46 @@ public:
   void draw16bitBeRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) override;
   void flush(void) override;
   void flushQuad(void);
+  // Sends the canvas area x, y, w, h only. On outputs with an address window
+  // grid (Arduino_TFT::getAddrAlign()) it grows to the grid, the extra
+  // pixels coming from the framebuffer. Round mode is not applied.
+  void flushRect(int16_t x, int16_t y, int16_t w, int16_t h);
 
   uint16_t *getFramebuffer();
 
+  // Hardware rotation: the framebuffer is kept in rotated (screen) order, so
+  // every rotation draws as fast as rotation 0, and flush() has output, the
+  // display given to the constructor, rotate instead by setting its own
+  // rotation for the time of the flush. nullptr goes back to rotating in
+  // software. The framebuffer layout changes with either call and with
+  // setRotation(), so redraw after them. flushQuad() does not rotate the
+  // output and sends nothing while hardware rotation is on.
+  void setHardwareRotation(Arduino_GFX *output);
+
 protected:
+  typedef Arduino_Canvas_Raster<gfx_format_rgb565> Raster;
+  GFX_INLINE Raster raster() const
+  {
+    Raster r = {_framebuffer, _fb_width, _fb_height};
+    return r;
+  }
+
   uint16_t *_framebuffer = nullptr;
   Arduino_G *_output = nullptr;
   int16_t _output_x, _output_y;
   int16_t MAX_X, MAX_Y;
 
+  // framebuffer orientation, and the rotation the writers resolve into it:
+  // WIDTH x HEIGHT and _rotation, or the rotated size and 0 with hardware
+  // rotation
+  int16_t _fb_width, _fb_height;
+  uint8_t _fb_rotation = 0;
+  Arduino_GFX *_hw_output = nullptr;
+
+  // framebuffer area rx, ry, rw, rh
+  void flushRotated(int16_t rx, int16_t ry, int16_t rw, int16_t rh);
+  void flushRound(int16_t output_x, int16_t output_y);
+
   // for flushQuad() only
   uint16_t *_rowBuf = nullptr;
 
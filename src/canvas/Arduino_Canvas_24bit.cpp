@@ -0,0 +1,103 @@
+#include "../Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#include "../Arduino_GFX.h"
+#include "Arduino_Canvas_24bit.h"
+
+Arduino_Canvas_24bit::Arduino_Canvas_24bit(int16_t w, int16_t h, Arduino_G *output, int16_t output_x, int16_t output_y, uint8_t r)
+    : Arduino_GFX(w, h), _output(output), _output_x(output_x), _output_y(output_y)
+{
+  MAX_X = WIDTH - 1;
+  MAX_Y = HEIGHT - 1;
+  setRotation(r);
+}
+
+Arduino_Canvas_24bit::~Arduino_Canvas_24bit()
+{
+  if (_framebuffer)
+  {
+    free(_framebuffer);
+  }
+}
+
+bool Arduino_Canvas_24bit::begin(int32_t speed)
+{
+  if (speed != GFX_SKIP_OUTPUT_BEGIN)
+  {
+    if (!_output->begin(speed))
+    {
+      return false;
+    }
+  }
+
+  if (!_framebuffer)
+  {
+    size_t s = (size_t)_width * _height * 3;
+#if defined(ESP32)
+    if (psramFound())
+    {
+      _framebuffer = (uint8_t *)ps_malloc(s);
+    }
+    else
+    {
+      _framebuffer = (uint8_t *)malloc(s);
+    }
+#else
+    _framebuffer = (uint8_t *)malloc(s);
+#endif
+    if (!_framebuffer)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void Arduino_Canvas_24bit::writePixelPreclipped(int16_t x, int16_t y, uint16_t color)
+{
+  raster().pixel(_rotation, x, y, Raster::format_t::encode(color));
+}
+
+void Arduino_Canvas_24bit::writeFastVLine(int16_t x, int16_t y,
+                                          int16_t h, uint16_t color)
+{
+  raster().vline(_rotation, x, y, h, Raster::format_t::encode(color));
+}
+
+void Arduino_Canvas_24bit::writeFastVLineCore(int16_t x, int16_t y,
+                                              int16_t h, uint16_t color)
+{
+  raster().vline(0, x, y, h, Raster::format_t::encode(color));
+}
+
+void Arduino_Canvas_24bit::writeFastHLine(int16_t x, int16_t y,
+                                          int16_t w, uint16_t color)
+{
+  raster().hline(_rotation, x, y, w, Raster::format_t::encode(color));
+}
+
+void Arduino_Canvas_24bit::writeFastHLineCore(int16_t x, int16_t y,
+                                              int16_t w, uint16_t color)
+{
+  raster().hline(0, x, y, w, Raster::format_t::encode(color));
+}
+
+void Arduino_Canvas_24bit::writeFillRectPreclipped(int16_t x, int16_t y,
+                                                   int16_t w, int16_t h, uint16_t color)
+{
+  raster().fillRect(_rotation, x, y, w, h, Raster::format_t::encode(color));
+}
+
+void Arduino_Canvas_24bit::flush()
+{
+  GFX_STATS_SCOPE(GFX_STATS_FLUSH);
+  _output->draw24bitRGBBitmap(_output_x, _output_y, _framebuffer, WIDTH, HEIGHT);
+}
+
+uint8_t *Arduino_Canvas_24bit::getFramebuffer()
+{
+  return _framebuffer;
+}
+
+#endif // !defined(LITTLE_FOOT_PRINT)
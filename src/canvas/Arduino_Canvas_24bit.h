@@ -0,0 +1,48 @@
+#include "../Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#ifndef _ARDUINO_CANVAS_24BIT_H_
+#define _ARDUINO_CANVAS_24BIT_H_
+
+#include "../Arduino_GFX.h"
+#include "Arduino_Canvas_Raster.h"
+
+// 3 bytes R, G, B per pixel, the byte order 18-bit panels take, so flush()
+// hands the framebuffer to draw24bitRGBBitmap() without any conversion.
+// Costs 1.5 times the memory of Arduino_Canvas.
+class Arduino_Canvas_24bit : public Arduino_GFX
+{
+public:
+  Arduino_Canvas_24bit(int16_t w, int16_t h, Arduino_G *output, int16_t output_x = 0, int16_t output_y = 0, uint8_t rotation = 0);
+  ~Arduino_Canvas_24bit();
+
+  bool begin(int32_t speed = GFX_NOT_DEFINED) override;
+  void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override;
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void writeFastVLineCore(int16_t x, int16_t y, int16_t h, uint16_t color);
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void writeFastHLineCore(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void flush(void) override;
+
+  uint8_t *getFramebuffer();
+
+protected:
+  typedef Arduino_Canvas_Raster<gfx_format_rgb888> Raster;
+  GFX_INLINE Raster raster() const
+  {
+    Raster r = {_framebuffer, WIDTH, HEIGHT};
+    return r;
+  }
+
+  uint8_t *_framebuffer = nullptr;
+  Arduino_G *_output = nullptr;
+  int16_t _output_x, _output_y;
+  int16_t MAX_X, MAX_Y;
+
+private:
+};
+
+#endif // _ARDUINO_CANVAS_24BIT_H_
+
+#endif // !defined(LITTLE_FOOT_PRINT)
@@ -4,9 +4,10 @@
 #include "../Arduino_GFX.h"
 #include "Arduino_Canvas_3bit.h"
 
-Arduino_Canvas_3bit::Arduino_Canvas_3bit(int16_t w, int16_t h, Arduino_G *output, int16_t output_x, int16_t output_y)
+Arduino_Canvas_3bit::Arduino_Canvas_3bit(int16_t w, int16_t h, Arduino_G *output, int16_t output_x, int16_t output_y, uint8_t r)
     : Arduino_GFX(w, h), _output(output), _output_x(output_x), _output_y(output_y)
 {
+  setRotation(r);
 }
 
 Arduino_Canvas_3bit::~Arduino_Canvas_3bit()
@@ -53,24 +54,31 @@ bool Arduino_Canvas_3bit::begin(int32_t speed)
 
 void Arduino_Canvas_3bit::writePixelPreclipped(int16_t x, int16_t y, uint16_t color)
 {
-  int32_t pos = x + (y * _width);
-  int32_t idx = pos >> 1;
-  uint8_t c = (((color & 0b1000000000000000) ? 0b100 : 0) |
-               ((color & 0b0000010000000000) ? 0b010 : 0) |
-               ((color & 0b0000000000010000) ? 0b001 : 0));
-  if (pos & 1)
-  {
-    _framebuffer[idx] = (_framebuffer[idx] & 0b00111000) | c;
-  }
-  else
-  {
-    _framebuffer[idx] = (_framebuffer[idx] & 0b00000111) | (c << 3);
-  }
+  raster().pixel(_rotation, x, y, Raster::format_t::encode(color));
+}
+
+void Arduino_Canvas_3bit::writeFastVLine(int16_t x, int16_t y,
+                                         int16_t h, uint16_t color)
+{
+  raster().vline(_rotation, x, y, h, Raster::format_t::encode(color));
+}
+
+void Arduino_Canvas_3bit::writeFastHLine(int16_t x, int16_t y,
+                                         int16_t w, uint16_t color)
+{
+  raster().hline(_rotation, x, y, w, Raster::format_t::encode(color));
+}
+
+void Arduino_Canvas_3bit::writeFillRectPreclipped(int16_t x, int16_t y,
+                                                  int16_t w, int16_t h, uint16_t color)
+{
+  raster().fillRect(_rotation, x, y, w, h, Raster::format_t::encode(color));
 }
 
 void Arduino_Canvas_3bit::flush()
 {
-  _output->draw3bitRGBBitmap(_output_x, _output_y, _framebuffer, _width, _height);
+  GFX_STATS_SCOPE(GFX_STATS_FLUSH);
+  _output->draw3bitRGBBitmap(_output_x, _output_y, _framebuffer, WIDTH, HEIGHT);
 }
 
 uint8_t *Arduino_Canvas_3bit::getFramebuffer()
@@ -5,20 +5,31 @@
 #define _ARDUINO_CANVAS_3BIT_H_
 
 #include "../Arduino_GFX.h"
+#include "Arduino_Canvas_Raster.h"
 
 class Arduino_Canvas_3bit : public Arduino_GFX
 {
 public:
-  Arduino_Canvas_3bit(int16_t w, int16_t h, Arduino_G *output, int16_t output_x = 0, int16_t output_y = 0);
+  Arduino_Canvas_3bit(int16_t w, int16_t h, Arduino_G *output, int16_t output_x = 0, int16_t output_y = 0, uint8_t rotation = 0);
   ~Arduino_Canvas_3bit();
 
   bool begin(int32_t speed = GFX_NOT_DEFINED) override;
   void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override;
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
   void flush(void) override;
 
   uint8_t *getFramebuffer();
 
 protected:
+  typedef Arduino_Canvas_Raster<gfx_format_rgb3> Raster;
+  GFX_INLINE Raster raster() const
+  {
+    Raster r = {_framebuffer, WIDTH, HEIGHT};
+    return r;
+  }
+
   uint8_t *_framebuffer = nullptr;
   Arduino_G *_output = nullptr;
   int16_t _output_x, _output_y;
@@ -63,228 +63,58 @@ bool Arduino_Canvas_Indexed::begin(int32_t speed)
 
 void Arduino_Canvas_Indexed::writePixelPreclipped(int16_t x, int16_t y, uint16_t color)
 {
-  uint8_t idx;
-  if (_isDirectUseColorIndex)
-  {
-    idx = (uint8_t)color;
-  }
-  else
-  {
-    idx = get_color_index(color);
-  }
-
-  uint8_t *fb = _framebuffer;
-  switch (_rotation)
-  {
-  case 1:
-    fb += (int32_t)x * _height;
-    fb += _max_y - y;
-    *fb = idx;
-    break;
-  case 2:
-    fb += (int32_t)(_max_y - y) * _width;
-    fb += _max_x - x;
-    *fb = idx;
-    break;
-  case 3:
-    fb += (int32_t)(_max_x - x) * _height;
-    fb += y;
-    *fb = idx;
-    break;
-  default: // case 0:
-    fb += (int32_t)y * _width;
-    fb += x;
-    *fb = idx;
-  }
+  raster().pixel(_rotation, x, y, resolve_color_index(color));
+  _frame_dirty = true;
 }
 
 void Arduino_Canvas_Indexed::writeFastVLine(int16_t x, int16_t y,
                                             int16_t h, uint16_t color)
 {
-  uint8_t idx;
-  if (_isDirectUseColorIndex)
-  {
-    idx = (uint8_t)color;
-  }
-  else
+  if (raster().vline(_rotation, x, y, h, resolve_color_index(color)))
   {
-    idx = get_color_index(color);
-  }
-
-  switch (_rotation)
-  {
-  case 1:
-    writeFastHLineCore(_height - y - h, x, h, idx);
-    break;
-  case 2:
-    writeFastVLineCore(_max_x - x, _height - y - h, h, idx);
-    break;
-  case 3:
-    writeFastHLineCore(y, _max_x - x, h, idx);
-    break;
-  default: // case 0:
-    writeFastVLineCore(x, y, h, idx);
+    _frame_dirty = true;
   }
 }
 
 void Arduino_Canvas_Indexed::writeFastVLineCore(int16_t x, int16_t y,
                                                 int16_t h, uint8_t idx)
 {
-  if (_ordered_in_range(x, 0, MAX_X) && h)
-  { // X on screen, nonzero height
-    if (h < 0)
-    {             // If negative height...
-      y += h + 1; //   Move Y to top edge
-      h = -h;     //   Use positive height
-    }
-    if (y <= MAX_Y)
-    { // Not off bottom
-      int16_t y2 = y + h - 1;
-      if (y2 >= 0)
-      { // Not off top
-        // Line partly or fully overlaps screen
-        if (y < 0)
-        {
-          y = 0;
-          h = y2 + 1;
-        } // Clip top
-        if (y2 > MAX_Y)
-        {
-          h = MAX_Y - y + 1;
-        } // Clip bottom
-
-        uint8_t *fb = _framebuffer + ((int32_t)y * WIDTH) + x;
-        while (h--)
-        {
-          *fb = idx;
-          fb += WIDTH;
-        }
-      }
-    }
+  if (raster().vline(0, x, y, h, idx))
+  {
+    _frame_dirty = true;
   }
 }
 
 void Arduino_Canvas_Indexed::writeFastHLine(int16_t x, int16_t y,
                                             int16_t w, uint16_t color)
 {
-  uint8_t idx;
-  if (_isDirectUseColorIndex)
+  if (raster().hline(_rotation, x, y, w, resolve_color_index(color)))
   {
-    idx = (uint8_t)color;
-  }
-  else
-  {
-    idx = get_color_index(color);
-  }
-
-  switch (_rotation)
-  {
-  case 1:
-    writeFastVLineCore(_max_y - y, x, w, idx);
-    break;
-  case 2:
-    writeFastHLineCore(_width - x - w, _max_y - y, w, idx);
-    break;
-  case 3:
-    writeFastVLineCore(y, _width - x - w, w, idx);
-    break;
-  default: // case 0:
-    writeFastHLineCore(x, y, w, idx);
+    _frame_dirty = true;
   }
 }
 
 void Arduino_Canvas_Indexed::writeFastHLineCore(int16_t x, int16_t y,
                                                 int16_t w, uint8_t idx)
 {
-  if (_ordered_in_range(y, 0, MAX_Y) && w)
-  { // Y on screen, nonzero width
-    if (w < 0)
-    {             // If negative width...
-      x += w + 1; //   Move X to left edge
-      w = -w;     //   Use positive width
-    }
-    if (x <= MAX_X)
-    { // Not off right
-      int16_t x2 = x + w - 1;
-      if (x2 >= 0)
-      { // Not off left
-        // Line partly or fully overlaps screen
-        if (x < 0)
-        {
-          x = 0;
-          w = x2 + 1;
-        } // Clip left
-        if (x2 > MAX_X)
-        {
-          w = MAX_X - x + 1;
-        } // Clip right
-
-        uint8_t *fb = _framebuffer + ((int32_t)y * WIDTH) + x;
-        while (w--)
-        {
-          *(fb++) = idx;
-        }
-      }
-    }
+  if (raster().hline(0, x, y, w, idx))
+  {
+    _frame_dirty = true;
   }
 }
 
 void Arduino_Canvas_Indexed::writeFillRectPreclipped(int16_t x, int16_t y,
                                                      int16_t w, int16_t h, uint16_t color)
 {
-  uint8_t idx;
-  if (_isDirectUseColorIndex)
-  {
-    idx = (uint8_t)color;
-  }
-  else
-  {
-    idx = get_color_index(color);
-  }
-
-  if (_rotation > 0)
-  {
-    int16_t t = x;
-    switch (_rotation)
-    {
-    case 1:
-      x = WIDTH - y - h;
-      y = t;
-      t = w;
-      w = h;
-      h = t;
-      break;
-    case 2:
-      x = WIDTH - x - w;
-      y = HEIGHT - y - h;
-      break;
-    case 3:
-      x = y;
-      y = HEIGHT - t - w;
-      t = w;
-      w = h;
-      h = t;
-      break;
-    }
-  }
-  // log_i("adjusted writeFillRectPreclipped(x: %d, y: %d, w: %d, h: %d)", x, y, w, h);
-  uint8_t *row = _framebuffer;
-  row += y * WIDTH;
-  row += x;
-  for (int j = 0; j < h; j++)
-  {
-    for (int i = 0; i < w; i++)
-    {
-      row[i] = idx;
-    }
-    row += WIDTH;
-  }
+  raster().fillRect(_rotation, x, y, w, h, resolve_color_index(color));
+  _frame_dirty = true;
 }
 
 void Arduino_Canvas_Indexed::drawIndexedBitmap(
     int16_t x, int16_t y,
     uint8_t *bitmap, uint16_t *color_index, int16_t w, int16_t h, int16_t x_skip)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (_rotation > 0)
   {
     if (!_isDirectUseColorIndex)
@@ -339,6 +169,7 @@ void Arduino_Canvas_Indexed::drawIndexedBitmap(
         w += x;
         x = 0;
       }
+      _frame_dirty = true;
       uint8_t *row = _framebuffer;
       row += y * _width;
       row += x;
@@ -385,6 +216,7 @@ void Arduino_Canvas_Indexed::drawIndexedBitmap(
     int16_t x, int16_t y,
     uint8_t *bitmap, uint16_t *color_index, uint8_t chroma_key, int16_t w, int16_t h, int16_t x_skip)
 {
+  GFX_STATS_SCOPE(GFX_STATS_BITMAP);
   if (_rotation > 0)
   {
     if (!_isDirectUseColorIndex)
@@ -444,6 +276,7 @@ void Arduino_Canvas_Indexed::drawIndexedBitmap(
         w += x;
         x = 0;
       }
+      _frame_dirty = true;
       uint8_t *row = _framebuffer;
       row += y * _width;
       row += x;
@@ -486,11 +319,122 @@ void Arduino_Canvas_Indexed::drawIndexedBitmap(
 
 void Arduino_Canvas_Indexed::flush()
 {
-  _output->drawIndexedBitmap(_output_x, _output_y, _framebuffer, _color_index, WIDTH, HEIGHT);
+  GFX_STATS_SCOPE(GFX_STATS_FLUSH);
+  if (!_frame_dirty)
+  {
+    for (uint8_t i = 0; i < (COLOR_IDX_SIZE / 32); i++)
+    {
+      if (_palette_dirty[i])
+      {
+        flush_palette_change();
+        return;
+      }
+    }
+  }
+  if (_isRoundMode)
+  {
+    flush_round();
+  }
+  else
+  {
+    _output->drawIndexedBitmap(_output_x, _output_y, _framebuffer, _color_index, WIDTH, HEIGHT);
+  }
+  _frame_dirty = false;
+  memset(_palette_dirty, 0, sizeof(_palette_dirty));
+}
+
+// Round mode: only the part of every row inside the circle goes out, the
+// rows visible across the whole width as one bitmap.
+void Arduino_Canvas_Indexed::flush_round()
+{
+  int16_t y = 0;
+  while (y < HEIGHT)
+  {
+    int16_t x1 = 0, x2 = MAX_X;
+    if (!clipRoundSpan(y, &x1, &x2))
+    {
+      y++;
+    }
+    else if ((x1 == 0) && (x2 == MAX_X))
+    {
+      int16_t y2 = y + 1;
+      while (y2 < HEIGHT)
+      {
+        int16_t n1 = 0, n2 = MAX_X;
+        if (!clipRoundSpan(y2, &n1, &n2) || (n1 != 0) || (n2 != MAX_X))
+        {
+          break;
+        }
+        y2++;
+      }
+      _output->drawIndexedBitmap(_output_x, _output_y + y, _framebuffer + ((int32_t)y * WIDTH), _color_index, WIDTH, y2 - y);
+      y = y2;
+    }
+    else
+    {
+      int16_t w = x2 - x1 + 1;
+      _output->drawIndexedBitmap(_output_x + x1, _output_y + y, _framebuffer + ((int32_t)y * WIDTH) + x1, _color_index, w, 1, WIDTH - w);
+      y++;
+    }
+  }
+}
+
+// Only the palette changed since the last flush(): the output already shows
+// every other pixel, so send the bounding box of the pixels whose palette
+// entry changed, still as indexed pixels straight from the framebuffer.
+void Arduino_Canvas_Indexed::flush_palette_change()
+{
+  bool changed[COLOR_IDX_SIZE];
+  for (uint16_t i = 0; i < COLOR_IDX_SIZE; i++)
+  {
+    changed[i] = _palette_dirty[i >> 5] & (1UL << (i & 31));
+  }
+  memset(_palette_dirty, 0, sizeof(_palette_dirty));
+
+  int16_t x1 = WIDTH, y1 = HEIGHT, x2 = -1, y2 = -1;
+  uint8_t *row = _framebuffer;
+  for (int16_t y = 0; y < HEIGHT; y++)
+  {
+    int16_t x = 0;
+    while ((x < WIDTH) && !changed[row[x]])
+    {
+      x++;
+    }
+    if (x < WIDTH)
+    {
+      int16_t xe = MAX_X;
+      while (!changed[row[xe]])
+      {
+        xe--;
+      }
+      if (y1 > y)
+      {
+        y1 = y;
+      }
+      y2 = y;
+      if (x1 > x)
+      {
+        x1 = x;
+      }
+      if (x2 < xe)
+      {
+        x2 = xe;
+      }
+    }
+    row += WIDTH;
+  }
+
+  if (y2 >= 0)
+  {
+    int16_t w = x2 - x1 + 1;
+    _output->drawIndexedBitmap(_output_x + x1, _output_y + y1, _framebuffer + ((int32_t)y1 * WIDTH) + x1,
+                               _color_index, w, y2 - y1 + 1, WIDTH - w);
+  }
 }
 
 uint8_t *Arduino_Canvas_Indexed::getFramebuffer()
 {
+  _frame_dirty = true; // the caller may draw directly
   return _framebuffer;
 }
 
@@ -504,21 +448,148 @@ void Arduino_Canvas_Indexed::setDirectUseColorIndex(bool isEnable)
   _isDirectUseColorIndex = isEnable;
 }
 
+void Arduino_Canvas_Indexed::setPaletteColor(uint8_t idx, uint16_t color)
+{
+  setPalette(&color, idx, 1);
+}
+
+void Arduino_Canvas_Indexed::setPalette(const uint16_t *colors, uint8_t first, uint16_t count)
+{
+  if (count > (COLOR_IDX_SIZE - first))
+  {
+    count = COLOR_IDX_SIZE - first;
+  }
+  for (uint16_t i = 0; i < count; i++)
+  {
+    _color_index[first + i] = colors[i] & _color_mask;
+  }
+  palette_changed(first, count);
+}
+
+void Arduino_Canvas_Indexed::rotatePalette(uint8_t first, uint8_t last, int16_t steps)
+{
+  if (last <= first)
+  {
+    return;
+  }
+  uint16_t count = last - first + 1;
+  steps %= (int16_t)count;
+  if (steps < 0)
+  {
+    steps += count;
+  }
+  if (steps == 0)
+  {
+    return;
+  }
+  uint16_t tmp[COLOR_IDX_SIZE];
+  for (uint16_t i = 0; i < count; i++)
+  {
+    tmp[(i + steps) % count] = _color_index[first + i];
+  }
+  setPalette(tmp, first, count);
+}
+
+// per channel linear interpolation, amount 0 gives c1 and 255 gives c2
+static uint16_t blend_rgb565(uint16_t c1, uint16_t c2, uint8_t amount)
+{
+  int16_t r1 = c1 >> 11, g1 = (c1 >> 5) & 0x3F, b1 = c1 & 0x1F;
+  int16_t r2 = c2 >> 11, g2 = (c2 >> 5) & 0x3F, b2 = c2 & 0x1F;
+  int16_t r = r1 + (((r2 - r1) * amount) / 255);
+  int16_t g = g1 + (((g2 - g1) * amount) / 255);
+  int16_t b = b1 + (((b2 - b1) * amount) / 255);
+  return (r << 11) | (g << 5) | b;
+}
+
+void Arduino_Canvas_Indexed::fillPaletteGradient(uint8_t first, uint8_t last, uint16_t color1, uint16_t color2)
+{
+  if (last < first)
+  {
+    return;
+  }
+  uint16_t count = last - first + 1;
+  uint16_t span = (count > 1) ? (count - 1) : 1;
+  for (uint16_t i = 0; i < count; i++)
+  {
+    _color_index[first + i] = blend_rgb565(color1, color2, (i * 255) / span) & _color_mask;
+  }
+  palette_changed(first, count);
+}
+
+void Arduino_Canvas_Indexed::blendPalette(const uint16_t *from, const uint16_t *to, uint8_t first, uint16_t count, uint8_t amount)
+{
+  if (count > (COLOR_IDX_SIZE - first))
+  {
+    count = COLOR_IDX_SIZE - first;
+  }
+  for (uint16_t i = 0; i < count; i++)
+  {
+    _color_index[first + i] = blend_rgb565(from[i], to[i], amount) & _color_mask;
+  }
+  palette_changed(first, count);
+}
+
+void Arduino_Canvas_Indexed::palette_changed(uint8_t first, uint16_t count)
+{
+  for (uint16_t i = first; i < (first + count); i++)
+  {
+    _palette_dirty[i >> 5] |= (1UL << (i & 31));
+  }
+  // entries set by hand become part of the palette get_color_index() matches
+  // and keep their index from now on
+  uint8_t end = ((first + count) < (COLOR_IDX_SIZE - 1)) ? (first + count) : (COLOR_IDX_SIZE - 1);
+  if (end > _palette_pinned)
+  {
+    _palette_pinned = end;
+  }
+  if (end > _indexed_size)
+  {
+    _indexed_size = end;
+  }
+  rebuild_color_hash();
+}
+
+// open addressing with linear probing, a slot only counts as a hit if the
+// palette entry it points to still holds that color
+#define COLOR_HASH(c) (((uint16_t)((c) * 40503U)) >> 7) // Fibonacci hash to 9 bits
+#define COLOR_HASH_NEXT(h) (((h) + 1) & (COLOR_HASH_SIZE - 1))
+
 uint8_t Arduino_Canvas_Indexed::get_color_index(uint16_t color)
 {
   color &= _color_mask;
-  for (uint8_t i = 0; i < _indexed_size; i++)
+  uint16_t h = COLOR_HASH(color);
+  uint16_t e;
+  while ((e = _color_hash[h]))
   {
-    if (_color_index[i] == color)
+    if (_color_index[e - 1] == color)
     {
-      return i;
+      return e - 1;
     }
+    h = COLOR_HASH_NEXT(h);
   }
   if (_indexed_size == (COLOR_IDX_SIZE - 1)) // overflowed
   {
+    uint8_t mask_level = _current_mask_level;
     raise_mask_level();
+    if (_current_mask_level != mask_level) // palette rebuilt, look up with the new mask
+    {
+      return get_color_index(color);
+    }
+  }
+  else if (_indexed_size == 0) // palette wrapped at the last mask level
+  {
+    if (_palette_pinned)
+    {
+      // the automatic entries are reused, the ones set by hand stay
+      _indexed_size = _palette_pinned;
+      rebuild_color_hash();
+      return get_color_index(color);
+    }
+    clear_color_hash(); // old slots are reused
+    h = COLOR_HASH(color);
   }
   _color_index[_indexed_size] = color;
+  _color_hash[h] = _indexed_size + 1;
   // print("color_index[");
   // print(_indexed_size);
   // print("] = ");
@@ -531,30 +602,103 @@ GFX_INLINE uint16_t Arduino_Canvas_Indexed::get_index_color(uint8_t idx)
   return _color_index[idx];
 }
 
+void Arduino_Canvas_Indexed::clear_color_hash()
+{
+  memset(_color_hash, 0, sizeof(_color_hash));
+}
+
+void Arduino_Canvas_Indexed::rebuild_color_hash()
+{
+  clear_color_hash();
+  for (uint16_t i = 0; i < _indexed_size; i++)
+  {
+    uint16_t h = COLOR_HASH(_color_index[i]);
+    uint16_t e;
+    while ((e = _color_hash[h]))
+    {
+      if (_color_index[e - 1] == _color_index[i])
+      {
+        break; // duplicate, the lower index wins
+      }
+      h = COLOR_HASH_NEXT(h);
+    }
+    if (!e)
+    {
+      _color_hash[h] = i + 1;
+    }
+  }
+}
+
 void Arduino_Canvas_Indexed::raise_mask_level()
 {
   if ((_current_mask_level + 1) < MAXMASKLEVEL)
   {
-    int32_t buffer_size = _width * _height;
     uint8_t old_indexed_size = _indexed_size;
-    uint8_t new_color;
-    _indexed_size = 0;
+    uint8_t remap[COLOR_IDX_SIZE];
+    bool changed = false;
     _color_mask = mask_level_list[++_current_mask_level];
     // print("Raised mask level: ");
     // println(_current_mask_level);
 
-    // update _framebuffer color index, it is a time consuming job
-    for (uint8_t old_color = 0; old_color < old_indexed_size; old_color++)
+    // entries set by hand keep their index, so palette animations still
+    // address them, and only take the new mask
+    for (uint16_t i = 0; i < _palette_pinned; i++)
     {
-      new_color = get_color_index(_color_index[old_color]);
-      for (int32_t i = 0; i < buffer_size; i++)
+      remap[i] = i;
+      uint16_t masked = _color_index[i] & _color_mask;
+      if (masked != _color_index[i])
       {
-        if (_framebuffer[i] == old_color)
-        {
-          _framebuffer[i] = new_color;
-        }
+        _color_index[i] = masked;
+        _palette_dirty[i >> 5] |= (1UL << (i & 31));
       }
     }
+    _indexed_size = _palette_pinned;
+    rebuild_color_hash();
+
+    // rebuild the rest of the palette in place, a merged entry never moves
+    // past the old one being read, and at most old_indexed_size entries
+    // come back
+    for (uint16_t old_color = _palette_pinned; old_color < old_indexed_size; old_color++)
+    {
+      remap[old_color] = get_color_index(_color_index[old_color]);
+      changed |= (remap[old_color] != old_color);
+    }
+    for (uint16_t i = old_indexed_size; i < COLOR_IDX_SIZE; i++)
+    {
+      remap[i] = i; // unused entries, only reachable from direct index writes
+    }
+
+    if (changed && _framebuffer)
+    {
+      remap_framebuffer(remap);
+    }
+  }
+}
+
+// one pass over the framebuffer, 4 pixels per load and store. The words go
+// through memcpy(), which compilers turn into single accesses, as the
+// byte framebuffer must not be accessed through a uint32_t pointer.
+void Arduino_Canvas_Indexed::remap_framebuffer(const uint8_t *remap)
+{
+  _frame_dirty = true;
+  int32_t buffer_size = (int32_t)_width * _height;
+  uint8_t *fb = _framebuffer;
+  int32_t words = buffer_size >> 2;
+  uint32_t p;
+  while (words--)
+  {
+    memcpy(&p, fb, 4);
+    p = (uint32_t)remap[p & 0xFF] |
+        ((uint32_t)remap[(p >> 8) & 0xFF] << 8) |
+        ((uint32_t)remap[(p >> 16) & 0xFF] << 16) |
+        ((uint32_t)remap[p >> 24] << 24);
+    memcpy(fb, &p, 4);
+    fb += 4;
+  }
+  for (int32_t i = buffer_size & 3; i > 0; i--)
+  {
+    *fb = remap[*fb];
+    ++fb;
   }
 }
 
@@ -5,8 +5,10 @@
 #define _ARDUINO_CANVAS_INDEXED_H_
 
 #include "../Arduino_GFX.h"
+#include "Arduino_Canvas_Raster.h"
 
 #define COLOR_IDX_SIZE 256
+#define COLOR_HASH_SIZE 512 // power of 2, keeps the reverse lookup at most half full
 
 class Arduino_Canvas_Indexed : public Arduino_GFX
 {
@@ -29,19 +31,56 @@ public:
   uint16_t *getColorIndex();
   void setDirectUseColorIndex(bool isEnable);
 
+  // Palette changes recolor the frame without redrawing it. The next
+  // flush() only sends the area using changed entries if nothing else
+  // was drawn since the last flush. Colors set here are masked like drawn
+  // ones, and the entries up to the highest one set keep their index when
+  // a full palette raises the mask level; only the colors added by drawing
+  // after them are merged and renumbered.
+  void setPaletteColor(uint8_t idx, uint16_t color);
+  void setPalette(const uint16_t *colors, uint8_t first, uint16_t count);
+  void rotatePalette(uint8_t first, uint8_t last, int16_t steps = 1);
+  void fillPaletteGradient(uint8_t first, uint8_t last, uint16_t color1, uint16_t color2);
+  void blendPalette(const uint16_t *from, const uint16_t *to, uint8_t first, uint16_t count, uint8_t amount);
+
   uint8_t get_color_index(uint16_t color);
   uint16_t get_index_color(uint8_t idx);
   void raise_mask_level();
 
+protected:
+  void clear_color_hash();
+  void rebuild_color_hash();
+  void remap_framebuffer(const uint8_t *remap);
+  void palette_changed(uint8_t first, uint16_t count);
+  void flush_palette_change();
+  void flush_round();
+
+  // palette index of a color passed to the writers
+  GFX_INLINE uint8_t resolve_color_index(uint16_t color)
+  {
+    return _isDirectUseColorIndex ? (uint8_t)color : get_color_index(color);
+  }
+
+  typedef Arduino_Canvas_Raster<gfx_format_index8> Raster;
+  GFX_INLINE Raster raster() const
+  {
+    Raster r = {_framebuffer, WIDTH, HEIGHT};
+    return r;
+  }
+
 protected:
   uint8_t *_framebuffer = nullptr;
   Arduino_G *_output = nullptr;
   int16_t _output_x, _output_y;
   int16_t MAX_X, MAX_Y;
 
-  uint16_t _color_index[COLOR_IDX_SIZE];
+  uint16_t _color_index[COLOR_IDX_SIZE] = {0};
+  uint16_t _color_hash[COLOR_HASH_SIZE] = {0}; // masked color -> palette index + 1, 0 is an empty slot
   uint8_t _indexed_size = 0;
+  uint8_t _palette_pinned = 0; // entries below it were set by hand
   bool _isDirectUseColorIndex = false;
+  bool _frame_dirty = true;                              // drawn to since the last flush()
+  uint32_t _palette_dirty[COLOR_IDX_SIZE / 32] = {0}; // entries changed since the last flush()
 
   uint8_t _current_mask_level;
   uint16_t _color_mask;
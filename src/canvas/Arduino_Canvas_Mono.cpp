@@ -2,6 +2,7 @@
 #if !defined(LITTLE_FOOT_PRINT)
 
 #include "../Arduino_GFX.h"
+#include "../font/glcdfont.h"
 #include "Arduino_Canvas_Mono.h"
 
 Arduino_Canvas_Mono::Arduino_Canvas_Mono(int16_t w, int16_t h, Arduino_G *output, int16_t output_x, int16_t output_y, bool verticalByte)
@@ -16,6 +17,10 @@ Arduino_Canvas_Mono::~Arduino_Canvas_Mono()
   {
     free(_framebuffer);
   }
+  if (_dirty_x1)
+  {
+    free(_dirty_x1);
+  }
 }
 
 bool Arduino_Canvas_Mono::begin(int32_t speed)
@@ -63,51 +68,422 @@ bool Arduino_Canvas_Mono::begin(int32_t speed)
     }
   }
 
+  if (!_dirty_x1)
+  {
+    _bands = (_canvas_height + 7) / 8;
+    _dirty_x1 = (int16_t *)malloc(_bands * 2 * sizeof(int16_t));
+    if (!_dirty_x1)
+    {
+      return false;
+    }
+    _dirty_x2 = _dirty_x1 + _bands;
+  }
+  markDirty();
+
   return true;
 }
 
+// Marks the whole buffer as changed, e.g. after writing to getFramebuffer()
+// directly; the next flush() then sends all of it.
+void Arduino_Canvas_Mono::markDirty()
+{
+  if (_dirty_x1)
+  {
+    for (int16_t b = 0; b < _bands; ++b)
+    {
+      _dirty_x1[b] = 0;
+      _dirty_x2[b] = _canvas_width - 1;
+    }
+  }
+}
+
+// Widens the changed column range of the bands touched by a rect given in
+// buffer orientation.
+void Arduino_Canvas_Mono::markDirty(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+{
+  for (int16_t b = y1 >> 3; b <= (y2 >> 3); ++b)
+  {
+    if (x1 < _dirty_x1[b])
+    {
+      _dirty_x1[b] = x1;
+    }
+    if (x2 > _dirty_x2[b])
+    {
+      _dirty_x2[b] = x2;
+    }
+  }
+}
+
 void Arduino_Canvas_Mono::writePixelPreclipped(int16_t x, int16_t y, uint16_t color)
 {
+  GFX_STATS_PIXELS(1);
   // change the pixel in the original orientation of the bitmap buffer
+  raster().mapPixel(_rotation, x, y);
+  markDirty(x, y, x, y);
+
   if (_verticalByte)
   {
-    // vertical buffer layout: 1 byte in the buffer contains 8 vertical pixels
-    int32_t pos = x + (y / 8) * _canvas_width;
+    gfx_format_mono_v::put(_framebuffer, _canvas_width, x, y, RGB565_TO_MONO(color));
+  }
+  else
+  {
+    gfx_format_mono_h::put(_framebuffer, _canvas_width, x, y, RGB565_TO_MONO(color));
+  }
+}
 
-    if (color & 0b1000010000010000)
+void Arduino_Canvas_Mono::writeFastVLine(int16_t x, int16_t y,
+                                         int16_t h, uint16_t color)
+{
+  if (_ordered_in_range(x, 0, _max_x) && Raster::clipSpan(y, h, _max_y))
+  {
+    writeFillRectPreclipped(x, y, 1, h, color);
+  }
+}
+
+void Arduino_Canvas_Mono::writeFastHLine(int16_t x, int16_t y,
+                                         int16_t w, uint16_t color)
+{
+  if (_ordered_in_range(y, 0, _max_y) && Raster::clipSpan(x, w, _max_x))
+  {
+    writeFillRectPreclipped(x, y, w, 1, color);
+  }
+}
+
+void Arduino_Canvas_Mono::writeFillRectPreclipped(int16_t x, int16_t y,
+                                                  int16_t w, int16_t h, uint16_t color)
+{
+  GFX_STATS_PIXELS((uint32_t)w * h);
+  raster().mapRect(_rotation, x, y, w, h);
+  fillRectCore(x, y, w, h, RGB565_TO_MONO(color));
+}
+
+// Fills a rect in buffer orientation.
+void Arduino_Canvas_Mono::fillRectCore(int16_t x, int16_t y, int16_t w, int16_t h, bool on)
+{
+  markDirty(x, y, x + w - 1, y + h - 1);
+  if (_verticalByte)
+  {
+    gfx_format_mono_v::rect(_framebuffer, _canvas_width, x, y, w, h, on);
+  }
+  else
+  {
+    gfx_format_mono_h::rect(_framebuffer, _canvas_width, x, y, w, h, on);
+  }
+}
+
+// 8 bitmap pixels from bit index bit of a row, MSB first, 0 outside the row
+static GFX_INLINE uint8_t mono_bitmap_bits(const uint8_t *row, int16_t byteWidth, int16_t bit, bool progmem)
+{
+  int16_t i = bit >> 3;
+  uint8_t s = bit & 7;
+  uint8_t b1 = ((i >= 0) && (i < byteWidth)) ? (progmem ? pgm_read_byte(&row[i]) : row[i]) : 0;
+  if (!s)
+  {
+    return b1;
+  }
+  ++i;
+  uint8_t b2 = ((i >= 0) && (i < byteWidth)) ? (progmem ? pgm_read_byte(&row[i]) : row[i]) : 0;
+  return (b1 << s) | (b2 >> (8 - s));
+}
+
+// Draws a 1-bit row major bitmap at rotation 0. With the horizontal byte
+// layout every destination byte takes 8 bitmap pixels in one masked
+// OR/AND-NOT; with the vertical byte layout pixels are set per column bit.
+void Arduino_Canvas_Mono::blitBitmap(int16_t x, int16_t y, const uint8_t *bitmap, bool progmem, int16_t w, int16_t h, uint16_t color, uint16_t bg, bool opaque)
+{
+  int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
+  int16_t x1 = (x < 0) ? 0 : x;
+  int16_t y1 = (y < 0) ? 0 : y;
+  int16_t x2 = ((x + w - 1) > _max_x) ? _max_x : (x + w - 1);
+  int16_t y2 = ((y + h - 1) > _max_y) ? _max_y : (y + h - 1);
+  if ((x1 > x2) || (y1 > y2))
+  {
+    return;
+  }
+  GFX_STATS_PIXELS((uint32_t)(x2 - x1 + 1) * (y2 - y1 + 1));
+  markDirty(x1, y1, x2, y2);
+  bool fg_on = RGB565_TO_MONO(color);
+  bool bg_on = RGB565_TO_MONO(bg);
+
+  if (_verticalByte)
+  {
+    for (int16_t j = y1; j <= y2; ++j)
     {
-      _framebuffer[pos] |= (1 << (y & 7));
+      const uint8_t *src = bitmap + ((int32_t)(j - y) * byteWidth);
+      uint8_t bit = 1 << (j & 7);
+      uint8_t *fb = _framebuffer + ((int32_t)(j >> 3) * _canvas_width);
+      uint8_t bits = 0;
+      for (int16_t i = x1; i <= x2; ++i)
+      {
+        int16_t sb = i - x;
+        if ((i == x1) || !(sb & 7))
+        {
+          bits = mono_bitmap_bits(src, byteWidth, sb, progmem);
+        }
+        else
+        {
+          bits <<= 1;
+        }
+        bool on;
+        if (bits & 0x80)
+        {
+          on = fg_on;
+        }
+        else if (opaque)
+        {
+          on = bg_on;
+        }
+        else
+        {
+          continue;
+        }
+        if (on)
+        {
+          fb[i] |= bit;
+        }
+        else
+        {
+          fb[i] &= ~bit;
+        }
+      }
     }
-    else
+  }
+  else
+  {
+    int16_t stride = (_canvas_width + 7) / 8;
+    int16_t b1 = x1 >> 3;
+    int16_t b2 = x2 >> 3;
+    for (int16_t j = y1; j <= y2; ++j)
     {
-      _framebuffer[pos] &= ~(1 << (y & 7));
+      const uint8_t *src = bitmap + ((int32_t)(j - y) * byteWidth);
+      uint8_t *fb = _framebuffer + ((int32_t)j * stride);
+      for (int16_t b = b1; b <= b2; ++b)
+      {
+        uint8_t m = 0xFF;
+        if (b == b1)
+        {
+          m &= 0xFF >> (x1 & 7);
+        }
+        if (b == b2)
+        {
+          m &= 0xFF << (7 - (x2 & 7));
+        }
+        uint8_t v = mono_bitmap_bits(src, byteWidth, (b << 3) - x, progmem);
+        if (opaque)
+        {
+          uint8_t d = (fg_on ? v : 0) | (bg_on ? ~v : 0);
+          fb[b] = (fb[b] & ~m) | (d & m);
+        }
+        else if (fg_on)
+        {
+          fb[b] |= v & m;
+        }
+        else
+        {
+          fb[b] &= ~(v & m);
+        }
+      }
     }
   }
+}
+
+void Arduino_Canvas_Mono::drawBitmap(int16_t x, int16_t y,
+                                     const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color)
+{
+  if (_rotation > 0)
+  {
+    Arduino_GFX::drawBitmap(x, y, bitmap, w, h, color);
+  }
+  else
+  {
+    GFX_STATS_SCOPE(GFX_STATS_BITMAP);
+    blitBitmap(x, y, bitmap, true, w, h, color, color, false);
+  }
+}
+
+void Arduino_Canvas_Mono::drawBitmap(int16_t x, int16_t y,
+                                     uint8_t *bitmap, int16_t w, int16_t h, uint16_t color)
+{
+  if (_rotation > 0)
+  {
+    Arduino_GFX::drawBitmap(x, y, bitmap, w, h, color);
+  }
   else
   {
-    // horizontal buffer layout: 1 byte in the buffer contains 8 horizontal pixels
-    int16_t w = (_canvas_width + 7) / 8;
-    int32_t pos = (y * w) + (x / 8);
+    GFX_STATS_SCOPE(GFX_STATS_BITMAP);
+    blitBitmap(x, y, bitmap, false, w, h, color, color, false);
+  }
+}
+
+void Arduino_Canvas_Mono::drawBitmap(int16_t x, int16_t y,
+                                     const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg)
+{
+  if (_rotation > 0)
+  {
+    Arduino_GFX::drawBitmap(x, y, bitmap, w, h, color, bg);
+  }
+  else
+  {
+    GFX_STATS_SCOPE(GFX_STATS_BITMAP);
+    blitBitmap(x, y, bitmap, true, w, h, color, bg, true);
+  }
+}
+
+void Arduino_Canvas_Mono::drawBitmap(int16_t x, int16_t y,
+                                     uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg)
+{
+  if (_rotation > 0)
+  {
+    Arduino_GFX::drawBitmap(x, y, bitmap, w, h, color, bg);
+  }
+  else
+  {
+    GFX_STATS_SCOPE(GFX_STATS_BITMAP);
+    blitBitmap(x, y, bitmap, false, w, h, color, bg, true);
+  }
+}
+
+// Unscaled built-in font glyphs that fit the canvas and text bound at
+// rotation 0 are written a column byte or a row byte at a time, anything
+// else takes the generic path.
+void Arduino_Canvas_Mono::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg)
+{
+  bool opaque = (bg != color);
+  int16_t cw = opaque ? 6 : 5;
+  if ((_rotation > 0) || gfxFont ||
+#if defined(U8G2_FONT_SUPPORT)
+      u8g2Font ||
+#endif
+      (textsize_x != 1) || (textsize_y != 1) ||
+      (x < 0) || (y < 0) || (x < _min_text_x) || (y < _min_text_y) ||
+      ((x + cw - 1) > _max_x) || ((y + 7) > _max_y) ||
+      ((x + cw - 1) > _max_text_x) || ((y + 7) > _max_text_y))
+  {
+    Arduino_GFX::drawChar(x, y, c, color, bg);
+    return;
+  }
 
-    if (color & 0b1000010000010000)
+  GFX_STATS_SCOPE(GFX_STATS_CHAR);
+  GFX_STATS_PIXELS(cw * 8);
+  markDirty(x, y, x + cw - 1, y + 7);
+  uint8_t cols[6];
+  for (uint8_t i = 0; i < 5; ++i)
+  {
+    cols[i] = pgm_read_byte(&font[c * 5 + i]); // bit 0 is the top row
+  }
+  cols[5] = 0;
+  bool fg_on = RGB565_TO_MONO(color);
+  bool bg_on = RGB565_TO_MONO(bg);
+
+  if (_verticalByte)
+  {
+    // a glyph column spans at most 2 pages
+    uint8_t s = y & 7;
+    uint8_t *fb1 = _framebuffer + ((int32_t)(y >> 3) * _canvas_width) + x;
+    uint8_t *fb2 = fb1 + _canvas_width;
+    for (int16_t i = 0; i < cw; ++i)
     {
-      _framebuffer[pos] |= 0x80 >> (x & 7);
+      uint8_t v = cols[i];
+      uint8_t d = (fg_on ? v : 0) | (bg_on ? ~v : 0);
+      uint8_t m = opaque ? 0xFF : v;
+      fb1[i] = (fb1[i] & ~(m << s)) | ((d & m) << s);
+      if (s)
+      {
+        fb2[i] = (fb2[i] & ~(m >> (8 - s))) | ((d & m) >> (8 - s));
+      }
     }
-    else
+  }
+  else
+  {
+    // transpose to row bytes, each lands in one or two framebuffer bytes
+    int16_t stride = (_canvas_width + 7) / 8;
+    uint8_t s = x & 7;
+    uint8_t *fb = _framebuffer + ((int32_t)y * stride) + (x >> 3);
+    for (uint8_t j = 0; j < 8; ++j, fb += stride)
     {
-      _framebuffer[pos] &= ~(0x80 >> (x & 7));
+      uint8_t v = 0;
+      for (uint8_t i = 0; i < 5; ++i)
+      {
+        v |= ((cols[i] >> j) & 1) << (7 - i);
+      }
+      uint8_t d = (fg_on ? v : 0) | (bg_on ? ~v : 0);
+      uint8_t m = opaque ? 0xFC : v;
+      fb[0] = (fb[0] & ~(m >> s)) | ((d & m) >> s);
+      if (s > (8 - cw))
+      {
+        fb[1] = (fb[1] & ~(m << (8 - s))) | ((d & m) << (8 - s));
+      }
     }
   }
 }
 
+// Sends only the bands changed since the last flush. With the vertical byte
+// layout a page is a contiguous row of column bytes, so each dirty page goes
+// out as its changed column range, and runs of fully changed pages are merged
+// into one multi page bitmap. With the horizontal byte layout the changed
+// rows go out at full width.
 void Arduino_Canvas_Mono::flush()
 {
+  GFX_STATS_SCOPE(GFX_STATS_FLUSH);
   if (_output)
-    _output->drawBitmap(_output_x, _output_y, _framebuffer, _canvas_width, _canvas_height, WHITE, BLACK);
+  {
+    if (_verticalByte)
+    {
+      int16_t b = 0;
+      while (b < _bands)
+      {
+        int16_t x1 = _dirty_x1[b];
+        int16_t x2 = _dirty_x2[b];
+        if (x1 > x2)
+        {
+          ++b;
+          continue;
+        }
+        int16_t b2 = b;
+        if ((x1 == 0) && (x2 == _canvas_width - 1))
+        {
+          while ((b2 + 1 < _bands) && (_dirty_x1[b2 + 1] == 0) && (_dirty_x2[b2 + 1] == _canvas_width - 1))
+          {
+            ++b2;
+          }
+        }
+        int16_t y = b * 8;
+        int16_t h = ((b2 + 1) * 8 > _canvas_height) ? (_canvas_height - y) : ((b2 - b + 1) * 8);
+        _output->drawBitmap(_output_x + x1, _output_y + y, _framebuffer + ((int32_t)b * _canvas_width) + x1, x2 - x1 + 1, h, WHITE, BLACK);
+        b = b2 + 1;
+      }
+    }
+    else
+    {
+      int16_t b1 = 0;
+      while ((b1 < _bands) && (_dirty_x1[b1] > _dirty_x2[b1]))
+      {
+        ++b1;
+      }
+      int16_t b2 = _bands - 1;
+      while ((b2 >= b1) && (_dirty_x1[b2] > _dirty_x2[b2]))
+      {
+        --b2;
+      }
+      if (b1 <= b2)
+      {
+        int16_t y = b1 * 8;
+        int16_t h = (((b2 + 1) * 8 > _canvas_height) ? _canvas_height : ((b2 + 1) * 8)) - y;
+        _output->drawBitmap(_output_x, _output_y + y, _framebuffer + ((int32_t)y * ((_canvas_width + 7) / 8)), _canvas_width, h, WHITE, BLACK);
+      }
+    }
+  }
+
+  for (int16_t b = 0; b < _bands; ++b)
+  {
+    _dirty_x1[b] = _canvas_width;
+    _dirty_x2[b] = -1;
+  }
 }
 
 uint8_t *Arduino_Canvas_Mono::getFramebuffer()
 {
+  markDirty();
   return _framebuffer;
 }
 
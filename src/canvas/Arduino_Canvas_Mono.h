@@ -5,6 +5,7 @@
 #define _ARDUINO_CANVAS_MONO_H_
 
 #include "../Arduino_GFX.h"
+#include "Arduino_Canvas_Raster.h"
 
 class Arduino_Canvas_Mono : public Arduino_GFX
 {
@@ -14,17 +15,45 @@ public:
 
   bool begin(int32_t speed = GFX_NOT_DEFINED) override;
   void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override;
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color) override;
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) override;
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg) override;
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) override;
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg) override;
   void flush(void) override;
 
   uint8_t *getFramebuffer();
+  void markDirty(void);
 
 protected:
+  // the byte layout is chosen at runtime, so only the rotation mapping is
+  // shared; fillRectCore() picks gfx_format_mono_v or gfx_format_mono_h
+  typedef Arduino_Canvas_Raster<gfx_format_mono_h> Raster;
+  GFX_INLINE Raster raster() const
+  {
+    Raster r = {_framebuffer, _canvas_width, _canvas_height};
+    return r;
+  }
+
+  void markDirty(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+  void fillRectCore(int16_t x, int16_t y, int16_t w, int16_t h, bool on);
+  void blitBitmap(int16_t x, int16_t y, const uint8_t *bitmap, bool progmem, int16_t w, int16_t h, uint16_t color, uint16_t bg, bool opaque);
+
   uint8_t *_framebuffer = nullptr;
   Arduino_G *_output = nullptr;
   int16_t _output_x, _output_y;
   bool _verticalByte;
   int16_t _canvas_width, _canvas_height;  // width and height of canvas buffer
 
+  // changed column range of every 8 row band (a page with the vertical byte
+  // layout) in buffer orientation, x1 > x2 when the band is clean
+  int16_t *_dirty_x1 = nullptr;
+  int16_t *_dirty_x2 = nullptr;
+  int16_t _bands;
+
 private:
 };
 
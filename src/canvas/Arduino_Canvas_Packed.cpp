@@ -0,0 +1,551 @@
+#include "../Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#include "../Arduino_GFX.h"
+#include "../font/glcdfont.h"
+#include "Arduino_Canvas_Packed.h"
+
+Arduino_Canvas_Packed::Arduino_Canvas_Packed(int16_t w, int16_t h, Arduino_G *output, int16_t output_x, int16_t output_y, uint8_t r, uint8_t bits_per_pixel)
+    : Arduino_GFX(w, h), _output(output), _output_x(output_x), _output_y(output_y)
+{
+  MAX_X = WIDTH - 1;
+  MAX_Y = HEIGHT - 1;
+  setRotation(r);
+
+  if (bits_per_pixel == 2)
+  {
+    _bpp = 2;
+    _ppb_shift = 2;
+    _fill = 0x55;
+  }
+  else
+  {
+    _bpp = 4;
+    _ppb_shift = 1;
+    _fill = 0x11;
+  }
+  _idx_mask = (1 << _bpp) - 1;
+  _stride = ((int32_t)WIDTH * _bpp + 7) / 8;
+}
+
+Arduino_Canvas_Packed::~Arduino_Canvas_Packed()
+{
+  if (_framebuffer)
+  {
+    free(_framebuffer);
+  }
+  if (_flush_buf)
+  {
+    free(_flush_buf);
+  }
+}
+
+bool Arduino_Canvas_Packed::begin(int32_t speed)
+{
+  if (speed != GFX_SKIP_OUTPUT_BEGIN)
+  {
+    if (!_output->begin(speed))
+    {
+      return false;
+    }
+  }
+
+  if (!_framebuffer)
+  {
+    size_t s = (size_t)_stride * HEIGHT;
+#if defined(ESP32)
+    if (psramFound())
+    {
+      _framebuffer = (uint8_t *)ps_malloc(s);
+    }
+    else
+    {
+      _framebuffer = (uint8_t *)malloc(s);
+    }
+#else
+    _framebuffer = (uint8_t *)malloc(s);
+#endif
+    if (!_framebuffer)
+    {
+      return false;
+    }
+    memset(_framebuffer, 0, s);
+  }
+
+  if (!_flush_buf)
+  {
+    int16_t rows = CANVAS_PACKED_FLUSH_PIXELS / WIDTH;
+    if (rows < 1)
+    {
+      rows = 1;
+    }
+    _flush_buf = (uint16_t *)malloc((size_t)rows * WIDTH * 2);
+    if (!_flush_buf)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// index of the pixel at native x, y in its byte, as a left shift
+#define PACKED_SHIFT(x) ((((1 << _ppb_shift) - 1) - ((x) & ((1 << _ppb_shift) - 1))) * _bpp)
+
+void Arduino_Canvas_Packed::writePixelPreclipped(int16_t x, int16_t y, uint16_t color)
+{
+  GFX_STATS_PIXELS(1);
+  uint8_t idx;
+  if (_isDirectUseColorIndex)
+  {
+    idx = color & _idx_mask;
+  }
+  else
+  {
+    idx = get_color_index(color);
+  }
+
+  int16_t t;
+  switch (_rotation)
+  {
+  case 1:
+    t = x;
+    x = _max_y - y;
+    y = t;
+    break;
+  case 2:
+    x = _max_x - x;
+    y = _max_y - y;
+    break;
+  case 3:
+    t = x;
+    x = y;
+    y = _max_x - t;
+    break;
+  }
+
+  uint8_t *fb = _framebuffer + ((int32_t)y * _stride) + (x >> _ppb_shift);
+  uint8_t shift = PACKED_SHIFT(x);
+  *fb = (*fb & ~(_idx_mask << shift)) | (idx << shift);
+}
+
+void Arduino_Canvas_Packed::writeFastVLine(int16_t x, int16_t y,
+                                           int16_t h, uint16_t color)
+{
+  uint8_t idx;
+  if (_isDirectUseColorIndex)
+  {
+    idx = color & _idx_mask;
+  }
+  else
+  {
+    idx = get_color_index(color);
+  }
+
+  if (h < 0)
+  { // the rotations below map the top end, so normalize first
+    y += h + 1;
+    h = -h;
+  }
+
+  switch (_rotation)
+  {
+  case 1:
+    writeFastHLineCore(_height - y - h, x, h, idx);
+    break;
+  case 2:
+    writeFastVLineCore(_max_x - x, _height - y - h, h, idx);
+    break;
+  case 3:
+    writeFastHLineCore(y, _max_x - x, h, idx);
+    break;
+  default: // case 0:
+    writeFastVLineCore(x, y, h, idx);
+  }
+}
+
+void Arduino_Canvas_Packed::writeFastVLineCore(int16_t x, int16_t y,
+                                               int16_t h, uint8_t idx)
+{
+  if (_ordered_in_range(x, 0, MAX_X) && h)
+  { // X on screen, nonzero height
+    if (h < 0)
+    {             // If negative height...
+      y += h + 1; //   Move Y to top edge
+      h = -h;     //   Use positive height
+    }
+    if (y <= MAX_Y)
+    { // Not off bottom
+      int16_t y2 = y + h - 1;
+      if (y2 >= 0)
+      { // Not off top
+        // Line partly or fully overlaps screen
+        if (y < 0)
+        {
+          y = 0;
+          h = y2 + 1;
+        } // Clip top
+        if (y2 > MAX_Y)
+        {
+          h = MAX_Y - y + 1;
+        } // Clip bottom
+        GFX_STATS_PIXELS(h);
+
+        uint8_t shift = PACKED_SHIFT(x);
+        uint8_t keep = ~(_idx_mask << shift);
+        uint8_t bits = idx << shift;
+        uint8_t *fb = _framebuffer + ((int32_t)y * _stride) + (x >> _ppb_shift);
+        while (h--)
+        {
+          *fb = (*fb & keep) | bits;
+          fb += _stride;
+        }
+      }
+    }
+  }
+}
+
+void Arduino_Canvas_Packed::writeFastHLine(int16_t x, int16_t y,
+                                           int16_t w, uint16_t color)
+{
+  uint8_t idx;
+  if (_isDirectUseColorIndex)
+  {
+    idx = color & _idx_mask;
+  }
+  else
+  {
+    idx = get_color_index(color);
+  }
+
+  if (w < 0)
+  { // the rotations below map the left end, so normalize first
+    x += w + 1;
+    w = -w;
+  }
+
+  switch (_rotation)
+  {
+  case 1:
+    writeFastVLineCore(_max_y - y, x, w, idx);
+    break;
+  case 2:
+    writeFastHLineCore(_width - x - w, _max_y - y, w, idx);
+    break;
+  case 3:
+    writeFastVLineCore(y, _width - x - w, w, idx);
+    break;
+  default: // case 0:
+    writeFastHLineCore(x, y, w, idx);
+  }
+}
+
+void Arduino_Canvas_Packed::writeFastHLineCore(int16_t x, int16_t y,
+                                               int16_t w, uint8_t idx)
+{
+  if (_ordered_in_range(y, 0, MAX_Y) && w)
+  { // Y on screen, nonzero width
+    if (w < 0)
+    {             // If negative width...
+      x += w + 1; //   Move X to left edge
+      w = -w;     //   Use positive width
+    }
+    if (x <= MAX_X)
+    { // Not off right
+      int16_t x2 = x + w - 1;
+      if (x2 >= 0)
+      { // Not off left
+        // Line partly or fully overlaps screen
+        if (x < 0)
+        {
+          x = 0;
+          w = x2 + 1;
+        } // Clip left
+        if (x2 > MAX_X)
+        {
+          w = MAX_X - x + 1;
+        } // Clip right
+        GFX_STATS_PIXELS(w);
+
+        fill_span(x, y, w, idx);
+      }
+    }
+  }
+}
+
+// Unscaled built-in font glyphs that fit the canvas and text bound at
+// rotation 0 are written a glyph row at a time: the row's indices are packed
+// into one word with a mask and merged into its 2 to 4 framebuffer bytes.
+// Anything else takes the generic path.
+void Arduino_Canvas_Packed::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg)
+{
+  bool opaque = (bg != color);
+  int16_t cw = opaque ? 6 : 5;
+  if ((_rotation > 0) || gfxFont ||
+#if defined(U8G2_FONT_SUPPORT)
+      u8g2Font ||
+#endif
+      (textsize_x != 1) || (textsize_y != 1) ||
+      (x < 0) || (y < 0) || (x < _min_text_x) || (y < _min_text_y) ||
+      ((x + cw - 1) > _max_x) || ((y + 7) > _max_y) ||
+      ((x + cw - 1) > _max_text_x) || ((y + 7) > _max_text_y))
+  {
+    Arduino_GFX::drawChar(x, y, c, color, bg);
+    return;
+  }
+
+  uint8_t cols[6];
+  uint8_t any = 0;
+  for (uint8_t i = 0; i < 5; ++i)
+  {
+    cols[i] = pgm_read_byte(&font[c * 5 + i]); // bit 0 is the top row
+    any |= cols[i];
+  }
+  cols[5] = 0;
+  if (!opaque && !any)
+  {
+    return;
+  }
+
+  GFX_STATS_SCOPE(GFX_STATS_CHAR);
+  GFX_STATS_PIXELS(cw * 8);
+  // resolve the colors in the order the generic path first draws them, so
+  // the palette fills the same way
+  uint8_t fg_idx = 0, bg_idx = 0;
+  if (_isDirectUseColorIndex)
+  {
+    fg_idx = color & _idx_mask;
+    bg_idx = bg & _idx_mask;
+  }
+  else if (!opaque)
+  {
+    fg_idx = get_color_index(color);
+  }
+  else if (cols[0] & 1)
+  {
+    fg_idx = get_color_index(color);
+    bg_idx = get_color_index(bg);
+  }
+  else
+  {
+    bg_idx = get_color_index(bg);
+    if (any)
+    {
+      fg_idx = get_color_index(color);
+    }
+  }
+
+  // at most (3 + 6) * 2 or (1 + 6) * 4 bits from the first byte's MSB
+  uint8_t off = x & ((1 << _ppb_shift) - 1);
+  uint8_t bytes = (((off + cw) * _bpp) + 7) / 8;
+  uint8_t *fb = _framebuffer + ((int32_t)y * _stride) + (x >> _ppb_shift);
+  for (uint8_t j = 0; j < 8; ++j, fb += _stride)
+  {
+    uint32_t v = 0;
+    uint32_t m = 0;
+    for (uint8_t i = 0; i < cw; ++i)
+    {
+      uint8_t shift = 32 - ((off + i + 1) * _bpp);
+      if ((cols[i] >> j) & 1)
+      {
+        v |= (uint32_t)fg_idx << shift;
+      }
+      else if (opaque)
+      {
+        v |= (uint32_t)bg_idx << shift;
+      }
+      else
+      {
+        continue;
+      }
+      m |= (uint32_t)_idx_mask << shift;
+    }
+    for (uint8_t b = 0; b < bytes; ++b)
+    {
+      uint8_t bm = m >> (24 - (b * 8));
+      fb[b] = (fb[b] & ~bm) | ((v >> (24 - (b * 8))) & bm);
+    }
+  }
+}
+
+// Fills w pixels of native row y from x: partial bytes at both ends are
+// masked, whole bytes in between are set with one memset().
+void Arduino_Canvas_Packed::fill_span(int16_t x, int16_t y, int16_t w, uint8_t idx)
+{
+  uint8_t ppb_mask = (1 << _ppb_shift) - 1;
+  uint8_t pattern = idx * _fill;
+  uint8_t *fb = _framebuffer + ((int32_t)y * _stride) + (x >> _ppb_shift);
+
+  if (x & ppb_mask)
+  {
+    while ((x & ppb_mask) && w)
+    {
+      uint8_t shift = PACKED_SHIFT(x);
+      *fb = (*fb & ~(_idx_mask << shift)) | (idx << shift);
+      ++x;
+      --w;
+    }
+    ++fb;
+  }
+
+  int16_t bytes = w >> _ppb_shift;
+  if (bytes)
+  {
+    memset(fb, pattern, bytes);
+    fb += bytes;
+    w &= ppb_mask;
+  }
+
+  if (w)
+  {
+    // leading pixels of the last byte
+    uint8_t mask = 0xFF << ((8 - (w * _bpp)));
+    *fb = (*fb & ~mask) | (pattern & mask);
+  }
+}
+
+void Arduino_Canvas_Packed::writeFillRectPreclipped(int16_t x, int16_t y,
+                                                    int16_t w, int16_t h, uint16_t color)
+{
+  uint8_t idx;
+  if (_isDirectUseColorIndex)
+  {
+    idx = color & _idx_mask;
+  }
+  else
+  {
+    idx = get_color_index(color);
+  }
+
+  if (_rotation > 0)
+  {
+    int16_t t = x;
+    switch (_rotation)
+    {
+    case 1:
+      x = WIDTH - y - h;
+      y = t;
+      t = w;
+      w = h;
+      h = t;
+      break;
+    case 2:
+      x = WIDTH - x - w;
+      y = HEIGHT - y - h;
+      break;
+    case 3:
+      x = y;
+      y = HEIGHT - t - w;
+      t = w;
+      w = h;
+      h = t;
+      break;
+    }
+  }
+  GFX_STATS_PIXELS((uint32_t)w * h);
+  while (h--)
+  {
+    fill_span(x, y++, w, idx);
+  }
+}
+
+// Expands the framebuffer to RGB565 a few rows at a time, pixels are
+// rotated out of each packed byte MSB first.
+void Arduino_Canvas_Packed::flush()
+{
+  GFX_STATS_SCOPE(GFX_STATS_FLUSH);
+  int16_t rows = CANVAS_PACKED_FLUSH_PIXELS / WIDTH;
+  if (rows < 1)
+  {
+    rows = 1;
+  }
+  uint8_t ppb = 1 << _ppb_shift;
+  uint8_t *src = _framebuffer;
+  for (int16_t y = 0; y < HEIGHT; y += rows)
+  {
+    int16_t h = ((y + rows) > HEIGHT) ? (HEIGHT - y) : rows;
+    uint16_t *dst = _flush_buf;
+    for (int16_t j = 0; j < h; j++)
+    {
+      uint8_t *s = src;
+      int16_t x = 0;
+      while (x < WIDTH)
+      {
+        uint8_t b = *s++;
+        for (uint8_t k = 0; (k < ppb) && (x < WIDTH); k++, x++)
+        {
+          b = (b << _bpp) | (b >> (8 - _bpp)); // rotate the next pixel to the bottom
+          *dst++ = _color_index[b & _idx_mask];
+        }
+      }
+      src += _stride;
+    }
+    _output->draw16bitRGBBitmap(_output_x, _output_y + y, _flush_buf, WIDTH, h);
+  }
+}
+
+uint8_t *Arduino_Canvas_Packed::getFramebuffer()
+{
+  return _framebuffer;
+}
+
+uint16_t *Arduino_Canvas_Packed::getColorIndex()
+{
+  return _color_index;
+}
+
+void Arduino_Canvas_Packed::setDirectUseColorIndex(bool isEnable)
+{
+  _isDirectUseColorIndex = isEnable;
+}
+
+void Arduino_Canvas_Packed::setPaletteColor(uint8_t idx, uint16_t color)
+{
+  idx &= _idx_mask;
+  _color_index[idx] = color;
+  if (idx >= _indexed_size)
+  {
+    _indexed_size = idx + 1;
+  }
+  _last_idx = 0xFF;
+}
+
+uint8_t Arduino_Canvas_Packed::get_color_index(uint16_t color)
+{
+  if ((_last_idx <= _idx_mask) && (_last_color == color))
+  {
+    return _last_idx;
+  }
+  _last_color = color;
+  for (uint8_t i = 0; i < _indexed_size; i++)
+  {
+    if (_color_index[i] == color)
+    {
+      return _last_idx = i;
+    }
+  }
+  if (_indexed_size <= _idx_mask)
+  {
+    _color_index[_indexed_size] = color;
+    return _last_idx = _indexed_size++;
+  }
+
+  // palette full, nearest by squared distance in RGB565 units
+  int16_t r = color >> 11, g = (color >> 5) & 0x3F, b = color & 0x1F;
+  uint32_t best_d = 0xFFFFFFFF;
+  uint8_t best = 0;
+  for (uint8_t i = 0; i < _indexed_size; i++)
+  {
+    uint16_t c = _color_index[i];
+    int32_t dr = (c >> 11) - r, dg = ((c >> 5) & 0x3F) - g, db = (c & 0x1F) - b;
+    uint32_t d = (dr * dr * 4) + (dg * dg) + (db * db * 4);
+    if (d < best_d)
+    {
+      best_d = d;
+      best = i;
+    }
+  }
+  return _last_idx = best;
+}
+
+#endif // !defined(LITTLE_FOOT_PRINT)
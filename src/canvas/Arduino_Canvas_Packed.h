@@ -0,0 +1,66 @@
+#include "../Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#ifndef _ARDUINO_CANVAS_PACKED_H_
+#define _ARDUINO_CANVAS_PACKED_H_
+
+#include "../Arduino_GFX.h"
+
+// pixels expanded to RGB565 per flush() chunk, whole rows, at least one
+#ifndef CANVAS_PACKED_FLUSH_PIXELS
+#define CANVAS_PACKED_FLUSH_PIXELS 512
+#endif
+
+// Indexed canvas packing 2 (4 colors) or 4 (16 colors) bits per pixel, MSB
+// first, every row starting on a byte boundary. New colors fill the palette
+// in drawing order; once it is full a color maps to the nearest entry.
+class Arduino_Canvas_Packed : public Arduino_GFX
+{
+public:
+  Arduino_Canvas_Packed(int16_t w, int16_t h, Arduino_G *output, int16_t output_x = 0, int16_t output_y = 0, uint8_t rotation = 0, uint8_t bits_per_pixel = 4);
+  ~Arduino_Canvas_Packed();
+
+  bool begin(int32_t speed = GFX_NOT_DEFINED) override;
+  void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override;
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void writeFastVLineCore(int16_t x, int16_t y, int16_t h, uint8_t idx);
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void writeFastHLineCore(int16_t x, int16_t y, int16_t w, uint8_t idx);
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg) override;
+  void flush(void) override;
+
+  uint8_t *getFramebuffer();
+  uint16_t *getColorIndex();
+  void setDirectUseColorIndex(bool isEnable);
+  void setPaletteColor(uint8_t idx, uint16_t color);
+
+  uint8_t get_color_index(uint16_t color);
+
+protected:
+  void fill_span(int16_t x, int16_t y, int16_t w, uint8_t idx);
+
+  uint8_t *_framebuffer = nullptr;
+  uint16_t *_flush_buf = nullptr;
+  Arduino_G *_output = nullptr;
+  int16_t _output_x, _output_y;
+  int16_t MAX_X, MAX_Y;
+
+  uint8_t _bpp;       // bits per pixel, 2 or 4
+  uint8_t _ppb_shift; // log2 of pixels per byte
+  uint8_t _idx_mask;  // (1 << _bpp) - 1
+  uint8_t _fill;      // bit pattern repeating idx across a byte, per idx unit
+  int16_t _stride;    // bytes per row
+
+  uint16_t _color_index[16] = {0};
+  uint8_t _indexed_size = 0;
+  bool _isDirectUseColorIndex = false;
+  uint16_t _last_color; // last get_color_index() result, valid if _last_idx <= _idx_mask
+  uint8_t _last_idx = 0xFF;
+
+private:
+};
+
+#endif // _ARDUINO_CANVAS_PACKED_H_
+
+#endif // !defined(LITTLE_FOOT_PRINT)
@@ -0,0 +1,118 @@
+#include "../Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#include "../Arduino_GFX.h"
+#include "Arduino_Canvas_RGB332.h"
+
+// RGB332 to RGB565 with the top bits replicated into the low bits, so flush()
+// can send the framebuffer as indexed pixels
+static uint16_t rgb332_color_index[256];
+
+Arduino_Canvas_RGB332::Arduino_Canvas_RGB332(int16_t w, int16_t h, Arduino_G *output, int16_t output_x, int16_t output_y, uint8_t r)
+    : Arduino_GFX(w, h), _output(output), _output_x(output_x), _output_y(output_y)
+{
+  MAX_X = WIDTH - 1;
+  MAX_Y = HEIGHT - 1;
+  setRotation(r);
+
+  if (!rgb332_color_index[0xFF])
+  {
+    for (uint16_t i = 0; i < 256; i++)
+    {
+      uint8_t r3 = i >> 5, g3 = (i >> 2) & 0x07, b2 = i & 0x03;
+      rgb332_color_index[i] = (((r3 << 2) | (r3 >> 1)) << 11) |
+                              (((g3 << 3) | g3) << 5) |
+                              ((b2 << 3) | (b2 << 1) | (b2 >> 1));
+    }
+  }
+}
+
+Arduino_Canvas_RGB332::~Arduino_Canvas_RGB332()
+{
+  if (_framebuffer)
+  {
+    free(_framebuffer);
+  }
+}
+
+bool Arduino_Canvas_RGB332::begin(int32_t speed)
+{
+  if (speed != GFX_SKIP_OUTPUT_BEGIN)
+  {
+    if (!_output->begin(speed))
+    {
+      return false;
+    }
+  }
+
+  if (!_framebuffer)
+  {
+    size_t s = _width * _height;
+#if defined(ESP32)
+    if (psramFound())
+    {
+      _framebuffer = (uint8_t *)ps_malloc(s);
+    }
+    else
+    {
+      _framebuffer = (uint8_t *)malloc(s);
+    }
+#else
+    _framebuffer = (uint8_t *)malloc(s);
+#endif
+    if (!_framebuffer)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void Arduino_Canvas_RGB332::writePixelPreclipped(int16_t x, int16_t y, uint16_t color)
+{
+  raster().pixel(_rotation, x, y, Raster::format_t::encode(color));
+}
+
+void Arduino_Canvas_RGB332::writeFastVLine(int16_t x, int16_t y,
+                                           int16_t h, uint16_t color)
+{
+  raster().vline(_rotation, x, y, h, Raster::format_t::encode(color));
+}
+
+void Arduino_Canvas_RGB332::writeFastVLineCore(int16_t x, int16_t y,
+                                               int16_t h, uint8_t c)
+{
+  raster().vline(0, x, y, h, c);
+}
+
+void Arduino_Canvas_RGB332::writeFastHLine(int16_t x, int16_t y,
+                                           int16_t w, uint16_t color)
+{
+  raster().hline(_rotation, x, y, w, Raster::format_t::encode(color));
+}
+
+void Arduino_Canvas_RGB332::writeFastHLineCore(int16_t x, int16_t y,
+                                               int16_t w, uint8_t c)
+{
+  raster().hline(0, x, y, w, c);
+}
+
+void Arduino_Canvas_RGB332::writeFillRectPreclipped(int16_t x, int16_t y,
+                                                    int16_t w, int16_t h, uint16_t color)
+{
+  raster().fillRect(_rotation, x, y, w, h, Raster::format_t::encode(color));
+}
+
+void Arduino_Canvas_RGB332::flush()
+{
+  GFX_STATS_SCOPE(GFX_STATS_FLUSH);
+  _output->drawIndexedBitmap(_output_x, _output_y, _framebuffer, rgb332_color_index, WIDTH, HEIGHT);
+}
+
+uint8_t *Arduino_Canvas_RGB332::getFramebuffer()
+{
+  return _framebuffer;
+}
+
+#endif // !defined(LITTLE_FOOT_PRINT)
@@ -0,0 +1,47 @@
+#include "../Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#ifndef _ARDUINO_CANVAS_RGB332_H_
+#define _ARDUINO_CANVAS_RGB332_H_
+
+#include "../Arduino_GFX.h"
+#include "Arduino_Canvas_Raster.h"
+
+// 8-bit fixed color canvas, half the memory of Arduino_Canvas and no
+// palette to search like Arduino_Canvas_Indexed
+class Arduino_Canvas_RGB332 : public Arduino_GFX
+{
+public:
+  Arduino_Canvas_RGB332(int16_t w, int16_t h, Arduino_G *output, int16_t output_x = 0, int16_t output_y = 0, uint8_t rotation = 0);
+  ~Arduino_Canvas_RGB332();
+
+  bool begin(int32_t speed = GFX_NOT_DEFINED) override;
+  void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override;
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void writeFastVLineCore(int16_t x, int16_t y, int16_t h, uint8_t c);
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void writeFastHLineCore(int16_t x, int16_t y, int16_t w, uint8_t c);
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void flush(void) override;
+
+  uint8_t *getFramebuffer();
+
+protected:
+  typedef Arduino_Canvas_Raster<gfx_format_rgb332> Raster;
+  GFX_INLINE Raster raster() const
+  {
+    Raster r = {_framebuffer, WIDTH, HEIGHT};
+    return r;
+  }
+
+  uint8_t *_framebuffer = nullptr;
+  Arduino_G *_output = nullptr;
+  int16_t _output_x, _output_y;
+  int16_t MAX_X, MAX_Y;
+
+private:
+};
+
+#endif // _ARDUINO_CANVAS_RGB332_H_
+
+#endif // !defined(LITTLE_FOOT_PRINT)
@@ -0,0 +1,518 @@
+#include "../Arduino_DataBus.h"
+#if !defined(LITTLE_FOOT_PRINT)
+
+#ifndef _ARDUINO_CANVAS_RASTER_H_
+#define _ARDUINO_CANVAS_RASTER_H_
+
+#include "../Arduino_GFX.h"
+
+// Pixel format traits of canvas framebuffers. A format knows how a color is
+// encoded (value_t) and stored (cell_t), and writes single pixels and spans
+// in framebuffer orientation; stride is the framebuffer width in pixels.
+//
+//   encode(color)                     RGB565 color to the stored value
+//   put(fb, stride, x, y, v)          one pixel
+//   hspan(fb, stride, x, y, n, v)     n pixels to the right
+//   vspan(fb, stride, x, y, n, v)     n pixels down
+//   rect(fb, stride, x, y, w, h, v)   w x h pixels
+//
+// Formats storing whole pixels per cell get vspan() and rect() from
+// gfx_format_rows<>.
+
+#define RGB565_TO_RGB332(c) ((uint8_t)((((c) >> 8) & 0xE0) | (((c) >> 6) & 0x1C) | (((c) >> 3) & 0x03)))
+#define RGB565_TO_RGB3(c) ((((c) & 0x8000) ? 0b100 : 0) | (((c) & 0x0400) ? 0b010 : 0) | (((c) & 0x0010) ? 0b001 : 0))
+#define RGB565_TO_MONO(c) (((c) & 0b1000010000010000) != 0)
+
+// RGB565 to 8 bits per channel with the top bits replicated into the low bits
+#define RGB565_R8(c) ((uint8_t)((((c) >> 8) & 0xF8) | ((c) >> 13)))
+#define RGB565_G8(c) ((uint8_t)((((c) >> 3) & 0xFC) | (((c) >> 9) & 0x03)))
+#define RGB565_B8(c) ((uint8_t)(((c) << 3) | (((c) >> 2) & 0x07)))
+
+template <class F>
+struct gfx_format_rows
+{
+  template <typename cell_t, typename value_t>
+  static void vspan(cell_t *fb, int16_t stride, int16_t x, int16_t y, int16_t n, value_t v)
+  {
+    while (n--)
+    {
+      F::put(fb, stride, x, y++, v);
+    }
+  }
+
+  template <typename cell_t, typename value_t>
+  static void rect(cell_t *fb, int16_t stride, int16_t x, int16_t y, int16_t w, int16_t h, value_t v)
+  {
+    if (w == 1)
+    {
+      F::vspan(fb, stride, x, y, h, v);
+    }
+    else
+    {
+      while (h--)
+      {
+        F::hspan(fb, stride, x, y++, w, v);
+      }
+    }
+  }
+};
+
+struct gfx_format_rgb565 : gfx_format_rows<gfx_format_rgb565>
+{
+  typedef uint16_t cell_t;
+  typedef uint16_t value_t;
+
+  static GFX_INLINE value_t encode(uint16_t color) { return color; }
+
+  static GFX_INLINE void put(cell_t *fb, int16_t stride, int16_t x, int16_t y, value_t v)
+  {
+    fb[(int32_t)y * stride + x] = v;
+  }
+
+  static GFX_INLINE void vspan(cell_t *fb, int16_t stride, int16_t x, int16_t y, int16_t n, value_t v)
+  {
+    fb += (int32_t)y * stride + x;
+    while (n--)
+    {
+      *fb = v;
+      fb += stride;
+    }
+  }
+
+  static GFX_INLINE void hspan(cell_t *fb, int16_t stride, int16_t x, int16_t y, int16_t n, value_t v)
+  {
+    fb += (int32_t)y * stride + x;
+    while (n--)
+    {
+      *fb++ = v;
+    }
+  }
+};
+
+// RGB565 stored big endian, as RGB panels and some DMA buses take it
+struct gfx_format_rgb565_be : gfx_format_rgb565
+{
+  static GFX_INLINE value_t encode(uint16_t color) { return (color << 8) | (color >> 8); }
+};
+
+struct gfx_format_byte : gfx_format_rows<gfx_format_byte>
+{
+  typedef uint8_t cell_t;
+  typedef uint8_t value_t;
+
+  static GFX_INLINE void put(cell_t *fb, int16_t stride, int16_t x, int16_t y, value_t v)
+  {
+    fb[(int32_t)y * stride + x] = v;
+  }
+
+  static GFX_INLINE void vspan(cell_t *fb, int16_t stride, int16_t x, int16_t y, int16_t n, value_t v)
+  {
+    fb += (int32_t)y * stride + x;
+    while (n--)
+    {
+      *fb = v;
+      fb += stride;
+    }
+  }
+
+  static GFX_INLINE void hspan(cell_t *fb, int16_t stride, int16_t x, int16_t y, int16_t n, value_t v)
+  {
+    memset(fb + (int32_t)y * stride + x, v, n);
+  }
+};
+
+// palette index, the canvas encodes colors itself
+struct gfx_format_index8 : gfx_format_byte
+{
+  static GFX_INLINE value_t encode(uint16_t color) { return (uint8_t)color; }
+};
+
+struct gfx_format_rgb332 : gfx_format_byte
+{
+  static GFX_INLINE value_t encode(uint16_t color) { return RGB565_TO_RGB332(color); }
+};
+
+// 3 bytes R, G, B per pixel, value_t is 0xRRGGBB
+struct gfx_format_rgb888 : gfx_format_rows<gfx_format_rgb888>
+{
+  typedef uint8_t cell_t;
+  typedef uint32_t value_t;
+
+  static GFX_INLINE value_t encode(uint16_t color)
+  {
+    return ((uint32_t)RGB565_R8(color) << 16) | ((uint32_t)RGB565_G8(color) << 8) | RGB565_B8(color);
+  }
+
+  static GFX_INLINE void put(cell_t *fb, int16_t stride, int16_t x, int16_t y, value_t v)
+  {
+    fb += ((int32_t)y * stride + x) * 3;
+    fb[0] = v >> 16;
+    fb[1] = v >> 8;
+    fb[2] = v;
+  }
+
+  static GFX_INLINE void hspan(cell_t *fb, int16_t stride, int16_t x, int16_t y, int16_t n, value_t v)
+  {
+    fb += ((int32_t)y * stride + x) * 3;
+    uint8_t r = v >> 16, g = v >> 8, b = v;
+    while (n--)
+    {
+      *fb++ = r;
+      *fb++ = g;
+      *fb++ = b;
+    }
+  }
+
+  static GFX_INLINE void vspan(cell_t *fb, int16_t stride, int16_t x, int16_t y, int16_t n, value_t v)
+  {
+    fb += ((int32_t)y * stride + x) * 3;
+    int32_t step = (int32_t)stride * 3;
+    uint8_t r = v >> 16, g = v >> 8, b = v;
+    while (n--)
+    {
+      fb[0] = r;
+      fb[1] = g;
+      fb[2] = b;
+      fb += step;
+    }
+  }
+
+  // fills the first row, then copies it to the others
+  static void rect(cell_t *fb, int16_t stride, int16_t x, int16_t y, int16_t w, int16_t h, value_t v)
+  {
+    if (w == 1)
+    {
+      vspan(fb, stride, x, y, h, v);
+      return;
+    }
+    hspan(fb, stride, x, y, w, v);
+    cell_t *first = fb + ((int32_t)y * stride + x) * 3;
+    cell_t *row = first;
+    int32_t step = (int32_t)stride * 3;
+    while (--h > 0)
+    {
+      row += step;
+      memcpy(row, first, w * 3);
+    }
+  }
+};
+
+// 2 pixels per byte in bits 5..3 and 2..0, numbered linearly through the
+// framebuffer, as draw3bitRGBBitmap() takes them
+struct gfx_format_rgb3 : gfx_format_rows<gfx_format_rgb3>
+{
+  typedef uint8_t cell_t;
+  typedef uint8_t value_t;
+
+  static GFX_INLINE value_t encode(uint16_t color) { return RGB565_TO_RGB3(color); }
+
+  static GFX_INLINE void put(cell_t *fb, int16_t stride, int16_t x, int16_t y, value_t v)
+  {
+    int32_t pos = (int32_t)y * stride + x;
+    cell_t *p = fb + (pos >> 1);
+    if (pos & 1)
+    {
+      *p = (*p & 0b00111000) | v;
+    }
+    else
+    {
+      *p = (*p & 0b00000111) | (v << 3);
+    }
+  }
+
+  // whole pixel pairs with memset()
+  static void hspan(cell_t *fb, int16_t stride, int16_t x, int16_t y, int16_t n, value_t v)
+  {
+    int32_t pos = (int32_t)y * stride + x;
+    if (pos & 1)
+    {
+      fb[pos >> 1] = (fb[pos >> 1] & 0b00111000) | v;
+      ++pos;
+      --n;
+    }
+    if (n > 1)
+    {
+      memset(fb + (pos >> 1), (v << 3) | v, n >> 1);
+      pos += n & ~1;
+    }
+    if (n & 1)
+    {
+      fb[pos >> 1] = (fb[pos >> 1] & 0b00000111) | (v << 3);
+    }
+  }
+};
+
+// 1 bit per pixel, a byte holds 8 pixels of a row, MSB first
+struct gfx_format_mono_h
+{
+  typedef uint8_t cell_t;
+  typedef bool value_t;
+
+  static GFX_INLINE value_t encode(uint16_t color) { return RGB565_TO_MONO(color); }
+
+  static GFX_INLINE void put(cell_t *fb, int16_t stride, int16_t x, int16_t y, value_t v)
+  {
+    cell_t *p = fb + (int32_t)y * ((stride + 7) / 8) + (x >> 3);
+    if (v)
+    {
+      *p |= 0x80 >> (x & 7);
+    }
+    else
+    {
+      *p &= ~(0x80 >> (x & 7));
+    }
+  }
+
+  // whole bytes with memset(), only the bytes on the rect edges need a
+  // masked read-modify-write
+  static void rect(cell_t *fb, int16_t stride, int16_t x, int16_t y, int16_t w, int16_t h, value_t v)
+  {
+    uint8_t fill = v ? 0xFF : 0x00;
+    int16_t bytes = (stride + 7) / 8;
+    int16_t b1 = x >> 3;
+    int16_t b2 = (x + w - 1) >> 3;
+    uint8_t left_mask = 0xFF >> (x & 7);
+    uint8_t right_mask = 0xFF << (7 - ((x + w - 1) & 7));
+    if (b1 == b2)
+    {
+      left_mask &= right_mask;
+    }
+    cell_t *row = fb + ((int32_t)y * bytes) + b1;
+    while (h--)
+    {
+      *row = (*row & ~left_mask) | (fill & left_mask);
+      if (b2 > b1)
+      {
+        memset(row + 1, fill, b2 - b1 - 1);
+        row[b2 - b1] = (row[b2 - b1] & ~right_mask) | (fill & right_mask);
+      }
+      row += bytes;
+    }
+  }
+
+  static GFX_INLINE void hspan(cell_t *fb, int16_t stride, int16_t x, int16_t y, int16_t n, value_t v)
+  {
+    rect(fb, stride, x, y, n, 1, v);
+  }
+
+  static GFX_INLINE void vspan(cell_t *fb, int16_t stride, int16_t x, int16_t y, int16_t n, value_t v)
+  {
+    rect(fb, stride, x, y, 1, n, v);
+  }
+};
+
+// 1 bit per pixel, a byte holds 8 pixels of a column (bit 0 on top), a page
+// of 8 rows is a row of such bytes, as SSD1306 and SH1106 take it
+struct gfx_format_mono_v
+{
+  typedef uint8_t cell_t;
+  typedef bool value_t;
+
+  static GFX_INLINE value_t encode(uint16_t color) { return RGB565_TO_MONO(color); }
+
+  static GFX_INLINE void put(cell_t *fb, int16_t stride, int16_t x, int16_t y, value_t v)
+  {
+    cell_t *p = fb + (int32_t)(y >> 3) * stride + x;
+    if (v)
+    {
+      *p |= 1 << (y & 7);
+    }
+    else
+    {
+      *p &= ~(1 << (y & 7));
+    }
+  }
+
+  // whole pages with memset(), only the pages on the rect edges need a
+  // masked read-modify-write
+  static void rect(cell_t *fb, int16_t stride, int16_t x, int16_t y, int16_t w, int16_t h, value_t v)
+  {
+    uint8_t fill = v ? 0xFF : 0x00;
+    int16_t p1 = y >> 3;
+    int16_t p2 = (y + h - 1) >> 3;
+    uint8_t top_mask = 0xFF << (y & 7);
+    uint8_t bottom_mask = 0xFF >> (7 - ((y + h - 1) & 7));
+    for (int16_t p = p1; p <= p2; ++p)
+    {
+      uint8_t m = ((p == p1) ? top_mask : 0xFF) & ((p == p2) ? bottom_mask : 0xFF);
+      cell_t *row = fb + ((int32_t)p * stride) + x;
+      if (m == 0xFF)
+      {
+        memset(row, fill, w);
+      }
+      else if (v)
+      {
+        for (int16_t i = 0; i < w; ++i)
+        {
+          row[i] |= m;
+        }
+      }
+      else
+      {
+        for (int16_t i = 0; i < w; ++i)
+        {
+          row[i] &= ~m;
+        }
+      }
+    }
+  }
+
+  static GFX_INLINE void hspan(cell_t *fb, int16_t stride, int16_t x, int16_t y, int16_t n, value_t v)
+  {
+    rect(fb, stride, x, y, n, 1, v);
+  }
+
+  static GFX_INLINE void vspan(cell_t *fb, int16_t stride, int16_t x, int16_t y, int16_t n, value_t v)
+  {
+    rect(fb, stride, x, y, 1, n, v);
+  }
+};
+
+// Rotation aware writers over a framebuffer of one pixel format. Coordinates
+// are in the rotated (logical) orientation, the rotation is resolved once
+// per primitive into a framebuffer rect and the format fills that.
+template <class Format>
+struct Arduino_Canvas_Raster
+{
+  typedef Format format_t;
+  typedef typename Format::cell_t cell_t;
+  typedef typename Format::value_t value_t;
+
+  cell_t *fb;
+  int16_t width, height; // framebuffer orientation
+
+  // logical rect of rotation r to framebuffer orientation
+  GFX_INLINE void mapRect(uint8_t r, int16_t &x, int16_t &y, int16_t &w, int16_t &h) const
+  {
+    int16_t t = x;
+    switch (r)
+    {
+    case 1:
+      x = width - y - h;
+      y = t;
+      t = w;
+      w = h;
+      h = t;
+      break;
+    case 2:
+      x = width - x - w;
+      y = height - y - h;
+      break;
+    case 3:
+      x = y;
+      y = height - t - w;
+      t = w;
+      w = h;
+      h = t;
+      break;
+    }
+  }
+
+  GFX_INLINE void mapPixel(uint8_t r, int16_t &x, int16_t &y) const
+  {
+    int16_t t = x;
+    switch (r)
+    {
+    case 1:
+      x = width - 1 - y;
+      y = t;
+      break;
+    case 2:
+      x = width - 1 - x;
+      y = height - 1 - y;
+      break;
+    case 3:
+      x = y;
+      y = height - 1 - t;
+      break;
+    }
+  }
+
+  GFX_INLINE void pixel(uint8_t r, int16_t x, int16_t y, value_t v) const
+  {
+    GFX_STATS_PIXELS(1);
+    mapPixel(r, x, y);
+    Format::put(fb, width, x, y, v);
+  }
+
+  // preclipped
+  GFX_INLINE void fillRect(uint8_t r, int16_t x, int16_t y, int16_t w, int16_t h, value_t v) const
+  {
+    GFX_STATS_PIXELS((uint32_t)w * h);
+    mapRect(r, x, y, w, h);
+    Format::rect(fb, width, x, y, w, h, v);
+  }
+
+  // a 1 pixel wide or high rect, straight to the format's span writers
+  GFX_INLINE void span(uint8_t r, int16_t x, int16_t y, int16_t w, int16_t h, value_t v) const
+  {
+    GFX_STATS_PIXELS((uint32_t)w * h);
+    mapRect(r, x, y, w, h);
+    if (h == 1)
+    {
+      Format::hspan(fb, width, x, y, w, v);
+    }
+    else
+    {
+      Format::vspan(fb, width, x, y, h, v);
+    }
+  }
+
+  // Clips a line in logical coordinates, a negative length extends left or
+  // up. Returns false if nothing is left to draw.
+  static GFX_INLINE bool clipSpan(int16_t &x, int16_t &n, int16_t max)
+  {
+    if (n < 0)
+    {
+      x += n + 1;
+      n = -n;
+    }
+    if ((n == 0) || (x > max))
+    {
+      return false;
+    }
+    int16_t x2 = x + n - 1;
+    if (x2 < 0)
+    {
+      return false;
+    }
+    if (x < 0)
+    {
+      x = 0;
+      n = x2 + 1;
+    }
+    if (x2 > max)
+    {
+      n = max - x + 1;
+    }
+    return true;
+  }
+
+  GFX_INLINE bool hline(uint8_t r, int16_t x, int16_t y, int16_t w, value_t v) const
+  {
+    int16_t max_x = ((r & 1) ? height : width) - 1;
+    int16_t max_y = ((r & 1) ? width : height) - 1;
+    if ((y < 0) || (y > max_y) || !clipSpan(x, w, max_x))
+    {
+      return false;
+    }
+    span(r, x, y, w, 1, v);
+    return true;
+  }
+
+  GFX_INLINE bool vline(uint8_t r, int16_t x, int16_t y, int16_t h, value_t v) const
+  {
+    int16_t max_x = ((r & 1) ? height : width) - 1;
+    int16_t max_y = ((r & 1) ? width : height) - 1;
+    if ((x < 0) || (x > max_x) || !clipSpan(y, h, max_y))
+    {
+      return false;
+    }
+    span(r, x, y, 1, h, v);
+    return true;
+  }
+};
+
+#endif // _ARDUINO_CANVAS_RASTER_H_
+
+#endif // !defined(LITTLE_FOOT_PRINT)
@@ -11,7 +11,7 @@ Arduino_ESP32RGBPanel::Arduino_ESP32RGBPanel(
     uint16_t hsync_polarity, uint16_t hsync_front_porch, uint16_t hsync_pulse_width, uint16_t hsync_back_porch,
     uint16_t vsync_polarity, uint16_t vsync_front_porch, uint16_t vsync_pulse_width, uint16_t vsync_back_porch,
     uint16_t pclk_active_neg, int32_t prefer_speed, bool useBigEndian,
-    uint16_t de_idle_high, uint16_t pclk_idle_high)
+    uint16_t de_idle_high, uint16_t pclk_idle_high, bool double_buffer)
     : _de(de), _vsync(vsync), _hsync(hsync), _pclk(pclk),
       _r0(r0), _r1(r1), _r2(r2), _r3(r3), _r4(r4),
       _g0(g0), _g1(g1), _g2(g2), _g3(g3), _g4(g4), _g5(g5),
@@ -19,7 +19,7 @@ Arduino_ESP32RGBPanel::Arduino_ESP32RGBPanel(
       _hsync_polarity(hsync_polarity), _hsync_front_porch(hsync_front_porch), _hsync_pulse_width(hsync_pulse_width), _hsync_back_porch(hsync_back_porch),
       _vsync_polarity(vsync_polarity), _vsync_front_porch(vsync_front_porch), _vsync_pulse_width(vsync_pulse_width), _vsync_back_porch(vsync_back_porch),
       _pclk_active_neg(pclk_active_neg), _prefer_speed(prefer_speed), _useBigEndian(useBigEndian),
-      _de_idle_high(de_idle_high), _pclk_idle_high(pclk_idle_high)
+      _de_idle_high(de_idle_high), _pclk_idle_high(pclk_idle_high), _double_buffer(double_buffer)
 {
 }
 
@@ -115,6 +115,17 @@ uint16_t *Arduino_ESP32RGBPanel::getFrameBuffer(int16_t w, int16_t h)
   _panel_config->flags.relax_on_idle = 0;
   _panel_config->flags.fb_in_psram = 1; // allocate frame buffer in PSRAM
 
+  if (_double_buffer)
+  {
+    _swap_done = xSemaphoreCreateBinary();
+    if (!_swap_done)
+    {
+      return NULL;
+    }
+    _panel_config->on_frame_trans_done = onVSync;
+    _panel_config->user_ctx = this;
+  }
+
   ESP_ERROR_CHECK(esp_lcd_new_rgb_panel(_panel_config, &_panel_handle));
   ESP_ERROR_CHECK(esp_lcd_panel_reset(_panel_handle));
   ESP_ERROR_CHECK(esp_lcd_panel_init(_panel_handle));
@@ -127,7 +138,73 @@ uint16_t *Arduino_ESP32RGBPanel::getFrameBuffer(int16_t w, int16_t h)
   LCD_CAM.lcd_ctrl2.lcd_vsync_idle_pol = _vsync_polarity;
   LCD_CAM.lcd_ctrl2.lcd_hsync_idle_pol = _hsync_polarity;
 
-  return (uint16_t *)_rgb_panel->fb;
+  _front_buffer = _rgb_panel->fb;
+  if (_double_buffer)
+  {
+    // the second buffer starts as a copy of the one scanned out
+    _back_buffer = (uint8_t *)heap_caps_aligned_alloc(_panel_config->psram_trans_align, _rgb_panel->fb_size, MALLOC_CAP_SPIRAM);
+    if (!_back_buffer)
+    {
+      return NULL;
+    }
+    memcpy(_back_buffer, _front_buffer, _rgb_panel->fb_size);
+    Cache_WriteBack_Addr((uint32_t)_back_buffer, _rgb_panel->fb_size);
+    return (uint16_t *)_back_buffer;
+  }
+
+  return (uint16_t *)_front_buffer;
+}
+
+uint16_t *Arduino_ESP32RGBPanel::swapFrameBuffer()
+{
+  if (!_double_buffer)
+  {
+    return (uint16_t *)_front_buffer;
+  }
+
+  xSemaphoreTake(_swap_done, 0); // drop a stale give
+  _swap_pending = true;
+  xSemaphoreTake(_swap_done, portMAX_DELAY);
+
+  uint8_t *t = _front_buffer;
+  _front_buffer = _back_buffer;
+  _back_buffer = t;
+
+  return (uint16_t *)_back_buffer;
+}
+
+// Runs at the end of every vsync. With a swap pending, the DMA descriptors
+// are pointed at the back buffer and the transfer restarted the way
+// esp_lcd does for a one-off frame, the DMA fetches ahead of the panel and
+// may already have read the head of the old buffer.
+IRAM_ATTR bool Arduino_ESP32RGBPanel::onVSync(esp_lcd_panel_handle_t panel, esp_lcd_rgb_panel_event_data_t *edata, void *user_ctx)
+{
+  Arduino_ESP32RGBPanel *self = (Arduino_ESP32RGBPanel *)user_ctx;
+  if (!self->_swap_pending)
+  {
+    return false;
+  }
+
+  esp_rgb_panel_t *rgb_panel = self->_rgb_panel;
+  uint8_t *fb = self->_back_buffer;
+  for (size_t i = 0; i < rgb_panel->num_dma_nodes; ++i)
+  {
+    dma_descriptor_t *node = &rgb_panel->dma_nodes[i];
+    node->buffer = fb + ((uint8_t *)node->buffer - rgb_panel->fb);
+  }
+  rgb_panel->fb = fb;
+
+  gdma_reset(rgb_panel->dma_chan);
+  lcd_ll_stop(rgb_panel->hal.dev);
+  lcd_ll_fifo_reset(rgb_panel->hal.dev);
+  gdma_start(rgb_panel->dma_chan, (intptr_t)rgb_panel->dma_nodes);
+  esp_rom_delay_us(1); // let the DMA fill the LCD FIFO
+  lcd_ll_start(rgb_panel->hal.dev);
+
+  self->_swap_pending = false;
+  BaseType_t need_yield = pdFALSE;
+  xSemaphoreGiveFromISR(self->_swap_done, &need_yield);
+  return need_yield == pdTRUE;
 }
 #endif // #if (ESP_ARDUINO_VERSION_MAJOR < 3)
 #endif // #if defined(ESP32) && (CONFIG_IDF_TARGET_ESP32S3)
@@ -65,13 +65,23 @@ public:
       uint16_t hsync_polarity, uint16_t hsync_front_porch, uint16_t hsync_pulse_width, uint16_t hsync_back_porch,
       uint16_t vsync_polarity, uint16_t vsync_front_porch, uint16_t vsync_pulse_width, uint16_t vsync_back_porch,
       uint16_t pclk_active_neg = 0, int32_t prefer_speed = GFX_NOT_DEFINED, bool useBigEndian = false,
-      uint16_t de_idle_high = 0, uint16_t pclk_idle_high = 0);
+      uint16_t de_idle_high = 0, uint16_t pclk_idle_high = 0, bool double_buffer = false);
 
   bool begin(int32_t speed = GFX_NOT_DEFINED);
 
+  // returns the framebuffer to draw into, the back buffer with double_buffer
   uint16_t *getFrameBuffer(int16_t w, int16_t h);
 
+  // Double buffering: scans out the back buffer from the next vsync on and
+  // returns the new back buffer, the one scanned out before. Blocks until
+  // the swap took place, the back buffer must be written back from cache.
+  uint16_t *swapFrameBuffer();
+  uint16_t *getFrontBuffer() { return (uint16_t *)_front_buffer; }
+  bool isDoubleBuffered() { return _double_buffer; }
+
 protected:
+  static bool onVSync(esp_lcd_panel_handle_t panel, esp_lcd_rgb_panel_event_data_t *edata, void *user_ctx);
+
 private:
   int32_t _speed;
   int8_t _de, _vsync, _hsync, _pclk;
@@ -91,9 +101,15 @@ private:
   bool _useBigEndian;
   uint16_t _de_idle_high;
   uint16_t _pclk_idle_high;
+  bool _double_buffer;
 
   esp_lcd_panel_handle_t _panel_handle = NULL;
   esp_rgb_panel_t *_rgb_panel;
+
+  uint8_t *_front_buffer = NULL;
+  uint8_t *_back_buffer = NULL;
+  volatile bool _swap_pending = false;
+  SemaphoreHandle_t _swap_done = NULL;
 };
 
 #endif // _ARDUINO_ESP32RGBPANEL_H_
@@ -1,4 +1,5 @@
 #include "Arduino_ESP32SPIDMA.h"
+#include "../Arduino_GFX_Trace.h"
 
 #if defined(ESP32)
 
@@ -993,6 +994,7 @@ GFX_INLINE void Arduino_ESP32SPIDMA::CS_LOW(void)
  */
 GFX_INLINE void Arduino_ESP32SPIDMA::POLL_START()
 {
+  GFX_TRACE_BEGIN(GFX_TRACE_TRACK_BUS, GFX_TRACE_DMA, 0);
   spi_device_polling_start(_handle, &_spi_tran, portMAX_DELAY);
 }
 
@@ -1004,6 +1006,7 @@ GFX_INLINE void Arduino_ESP32SPIDMA::POLL_START()
 GFX_INLINE void Arduino_ESP32SPIDMA::POLL_END()
 {
   spi_device_polling_end(_handle, portMAX_DELAY);
+  GFX_TRACE_END(GFX_TRACE_TRACK_BUS, GFX_TRACE_DMA, 0);
 }
 
 #endif // #if defined(ESP32)
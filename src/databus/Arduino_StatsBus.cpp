@@ -0,0 +1,163 @@
+#include "Arduino_StatsBus.h"
+
+#if defined(ARDUINO_GFX_STATS)
+
+#define STATS_BUS_TIMED(counter, n, call)   \
+  {                                         \
+    uint32_t start = GFX_STATS_TICKS();     \
+    call;                                   \
+    uint32_t t = GFX_STATS_TICKS() - start; \
+    ++gfx_stats.counter.calls;              \
+    gfx_stats.counter.pixels += (n);        \
+    gfx_stats.counter.ticks += t;           \
+    if (t > gfx_stats.counter.max_ticks)    \
+    {                                       \
+      gfx_stats.counter.max_ticks = t;      \
+    }                                       \
+  }
+
+Arduino_StatsBus::Arduino_StatsBus(Arduino_DataBus *bus)
+    : _bus(bus)
+{
+}
+
+bool Arduino_StatsBus::begin(int32_t speed, int8_t dataMode)
+{
+  _speed = speed;
+  _dataMode = dataMode;
+  return _bus->begin(speed, dataMode);
+}
+
+void Arduino_StatsBus::beginWrite()
+{
+  ++gfx_stats.bus_transactions;
+  _bus->beginWrite();
+}
+
+void Arduino_StatsBus::endWrite()
+{
+  _bus->endWrite();
+}
+
+void Arduino_StatsBus::writeCommand(uint8_t c)
+{
+  gfx_stats.bus_command_bytes += 1;
+  _bus->writeCommand(c);
+}
+
+void Arduino_StatsBus::writeCommand16(uint16_t c)
+{
+  gfx_stats.bus_command_bytes += 2;
+  _bus->writeCommand16(c);
+}
+
+void Arduino_StatsBus::writeCommandBytes(uint8_t *data, uint32_t len)
+{
+  gfx_stats.bus_command_bytes += len;
+  _bus->writeCommandBytes(data, len);
+}
+
+void Arduino_StatsBus::write(uint8_t d)
+{
+  gfx_stats.bus_data_bytes += 1;
+  _bus->write(d);
+}
+
+void Arduino_StatsBus::write16(uint16_t d)
+{
+  gfx_stats.bus_data_bytes += 2;
+  _bus->write16(d);
+}
+
+void Arduino_StatsBus::writeC8D8(uint8_t c, uint8_t d)
+{
+  gfx_stats.bus_command_bytes += 1;
+  gfx_stats.bus_data_bytes += 1;
+  _bus->writeC8D8(c, d);
+}
+
+void Arduino_StatsBus::writeC16D16(uint16_t c, uint16_t d)
+{
+  gfx_stats.bus_command_bytes += 2;
+  gfx_stats.bus_data_bytes += 2;
+  _bus->writeC16D16(c, d);
+}
+
+void Arduino_StatsBus::writeC8D16(uint8_t c, uint16_t d)
+{
+  gfx_stats.bus_command_bytes += 1;
+  gfx_stats.bus_data_bytes += 2;
+  _bus->writeC8D16(c, d);
+}
+
+void Arduino_StatsBus::writeC8D16D16(uint8_t c, uint16_t d1, uint16_t d2)
+{
+  gfx_stats.bus_command_bytes += 1;
+  gfx_stats.bus_data_bytes += 4;
+  _bus->writeC8D16D16(c, d1, d2);
+}
+
+void Arduino_StatsBus::writeC8D16D16Split(uint8_t c, uint16_t d1, uint16_t d2)
+{
+  gfx_stats.bus_command_bytes += 1;
+  gfx_stats.bus_data_bytes += 4;
+  _bus->writeC8D16D16Split(c, d1, d2);
+}
+
+void Arduino_StatsBus::writeRepeat(uint16_t p, uint32_t len)
+{
+  gfx_stats.bus_data_bytes += len * 2;
+  STATS_BUS_TIMED(bus_write_repeat, len, _bus->writeRepeat(p, len));
+}
+
+void Arduino_StatsBus::writeBytes(uint8_t *data, uint32_t len)
+{
+  gfx_stats.bus_data_bytes += len;
+  STATS_BUS_TIMED(bus_write_bytes, len, _bus->writeBytes(data, len));
+}
+
+void Arduino_StatsBus::writePixels(uint16_t *data, uint32_t len)
+{
+  gfx_stats.bus_data_bytes += len * 2;
+  STATS_BUS_TIMED(bus_write_pixels, len, _bus->writePixels(data, len));
+}
+
+#if !defined(LITTLE_FOOT_PRINT)
+void Arduino_StatsBus::writePattern(uint8_t *data, uint8_t len, uint32_t repeat)
+{
+  gfx_stats.bus_data_bytes += (uint64_t)len * repeat;
+  _bus->writePattern(data, len, repeat);
+}
+
+void Arduino_StatsBus::writeIndexedPixels(uint8_t *data, uint16_t *idx, uint32_t len)
+{
+  gfx_stats.bus_data_bytes += len * 2;
+  STATS_BUS_TIMED(bus_write_pixels, len, _bus->writeIndexedPixels(data, idx, len));
+}
+
+void Arduino_StatsBus::writeIndexedPixelsDouble(uint8_t *data, uint16_t *idx, uint32_t len)
+{
+  gfx_stats.bus_data_bytes += len * 4;
+  STATS_BUS_TIMED(bus_write_pixels, len * 2, _bus->writeIndexedPixelsDouble(data, idx, len));
+}
+
+void Arduino_StatsBus::writeYCbCrPixels(uint8_t *yData, uint8_t *cbData, uint8_t *crData, uint16_t w, uint16_t h)
+{
+  gfx_stats.bus_data_bytes += (uint32_t)w * h * 2;
+  STATS_BUS_TIMED(bus_write_pixels, (uint32_t)w * h, _bus->writeYCbCrPixels(yData, cbData, crData, w, h));
+}
+#endif // !defined(LITTLE_FOOT_PRINT)
+
+#if defined(ARDUINO_GFX_INC_READ_OPERATIONS)
+uint8_t Arduino_StatsBus::receive(uint8_t commandByte, uint8_t index)
+{
+  return _bus->receive(commandByte, index);
+}
+
+uint16_t Arduino_StatsBus::receive16(uint16_t addr)
+{
+  return _bus->receive16(addr);
+}
+#endif // defined(ARDUINO_GFX_INC_READ_OPERATIONS)
+
+#endif // defined(ARDUINO_GFX_STATS)
@@ -0,0 +1,58 @@
+/*
+ * Counting decorator for any Arduino_DataBus, only built with
+ * ARDUINO_GFX_STATS. Wrap the real bus and hand this one to the display:
+ *   Arduino_DataBus *bus = new Arduino_StatsBus(new Arduino_ESP32SPI(...));
+ */
+#ifndef _ARDUINO_STATSBUS_H_
+#define _ARDUINO_STATSBUS_H_
+
+#include "../Arduino_DataBus.h"
+#include "../Arduino_GFX_Stats.h"
+
+#if defined(ARDUINO_GFX_STATS)
+
+class Arduino_StatsBus : public Arduino_DataBus
+{
+public:
+  Arduino_StatsBus(Arduino_DataBus *bus); // Constructor
+
+  bool begin(int32_t speed = GFX_NOT_DEFINED, int8_t dataMode = GFX_NOT_DEFINED) override;
+  void beginWrite() override;
+  void endWrite() override;
+  void writeCommand(uint8_t c) override;
+  void writeCommand16(uint16_t c) override;
+  void writeCommandBytes(uint8_t *data, uint32_t len) override;
+  void write(uint8_t) override;
+  void write16(uint16_t) override;
+  void writeC8D8(uint8_t c, uint8_t d) override;
+  void writeC16D16(uint16_t c, uint16_t d) override;
+  void writeC8D16(uint8_t c, uint16_t d) override;
+  void writeC8D16D16(uint8_t c, uint16_t d1, uint16_t d2) override;
+  void writeC8D16D16Split(uint8_t c, uint16_t d1, uint16_t d2) override;
+  void writeRepeat(uint16_t p, uint32_t len) override;
+  void writeBytes(uint8_t *data, uint32_t len) override;
+  void writePixels(uint16_t *data, uint32_t len) override;
+
+#if !defined(LITTLE_FOOT_PRINT)
+  void writePattern(uint8_t *data, uint8_t len, uint32_t repeat) override;
+  void writeIndexedPixels(uint8_t *data, uint16_t *idx, uint32_t len) override;
+  void writeIndexedPixelsDouble(uint8_t *data, uint16_t *idx, uint32_t len) override;
+  void writeYCbCrPixels(uint8_t *yData, uint8_t *cbData, uint8_t *crData, uint16_t w, uint16_t h) override;
+#endif // !defined(LITTLE_FOOT_PRINT)
+
+#if defined(ARDUINO_GFX_INC_READ_OPERATIONS)
+  uint8_t receive(uint8_t commandByte, uint8_t index = 1) override;
+  uint16_t receive16(uint16_t addr) override;
+#endif // defined(ARDUINO_GFX_INC_READ_OPERATIONS)
+
+  Arduino_DataBus *getBus() { return _bus; }
+
+protected:
+  Arduino_DataBus *_bus;
+
+private:
+};
+
+#endif // defined(ARDUINO_GFX_STATS)
+
+#endif // _ARDUINO_STATSBUS_H_
@@ -11,6 +11,8 @@ Arduino_AXS15231B::Arduino_AXS15231B(
     uint8_t col_offset1, uint8_t row_offset1, uint8_t col_offset2, uint8_t row_offset2)
     : Arduino_TFT(bus, rst, r, ips, w, h, col_offset1, row_offset1, col_offset2, row_offset2)
 {
+  // partial updates need even window start and end + 1
+  _addr_align = 2;
 }
 
 bool Arduino_AXS15231B::begin(int32_t speed)
@@ -51,24 +53,20 @@ void Arduino_AXS15231B::setRotation(uint8_t r)
   _bus->endWrite();
 }
 
-void Arduino_AXS15231B::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_AXS15231B::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    _currentX = x;
-    _currentW = w;
-    x += _xStart;
-    _bus->writeC8D16D16(AXS15231B_CASET, x, x + w - 1);
-  }
+  x += _xStart;
+  _bus->writeC8D16D16(AXS15231B_CASET, x, x + w - 1);
+}
 
-  if ((y != _currentY) || (h != _currentH))
-  {
-    _currentY = y;
-    _currentH = h;
-    y += _yStart;
-    _bus->writeC8D16D16(AXS15231B_RASET, y, y + h - 1);
-  }
+void Arduino_AXS15231B::writeRowAddr(int16_t y, uint16_t h)
+{
+  y += _yStart;
+  _bus->writeC8D16D16(AXS15231B_RASET, y, y + h - 1);
+}
 
+void Arduino_AXS15231B::writeMemoryStart()
+{
   _bus->writeCommand(AXS15231B_RAMWR); // write to RAM
 }
 
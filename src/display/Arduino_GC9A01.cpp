@@ -7,6 +7,7 @@ Arduino_GC9A01::Arduino_GC9A01(
     uint8_t col_offset1, uint8_t row_offset1, uint8_t col_offset2, uint8_t row_offset2)
     : Arduino_TFT(bus, rst, r, ips, w, h, col_offset1, row_offset1, col_offset2, row_offset2)
 {
+  _addr_both_axes = true;
 }
 
 bool Arduino_GC9A01::begin(int32_t speed)
@@ -16,19 +17,18 @@ bool Arduino_GC9A01::begin(int32_t speed)
   return Arduino_TFT::begin(speed);
 }
 
-void Arduino_GC9A01::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_GC9A01::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW) || (y != _currentY) || (h != _currentH))
-  {
-    _bus->writeC8D16D16(GC9A01_CASET, x + _xStart, x + w - 1 + _xStart);
-    _bus->writeC8D16D16(GC9A01_RASET, y + _yStart, y + h - 1 + _yStart);
+  _bus->writeC8D16D16(GC9A01_CASET, x + _xStart, x + w - 1 + _xStart);
+}
 
-    _currentX = x;
-    _currentY = y;
-    _currentW = w;
-    _currentH = h;
-  }
+void Arduino_GC9A01::writeRowAddr(int16_t y, uint16_t h)
+{
+  _bus->writeC8D16D16(GC9A01_RASET, y + _yStart, y + h - 1 + _yStart);
+}
 
+void Arduino_GC9A01::writeMemoryStart()
+{
   _bus->writeCommand(GC9A01_RAMWR); // write to RAM
 }
 
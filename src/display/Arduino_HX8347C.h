@@ -22,13 +22,15 @@ public:
       uint8_t col_offset1 = 0, uint8_t row_offset1 = 0, uint8_t col_offset2 = 0, uint8_t row_offset2 = 0);
 
   bool begin(int32_t speed = GFX_NOT_DEFINED) override;
-  void writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h) override;
   void setRotation(uint8_t r) override;
   void invertDisplay(bool) override;
   void displayOn() override;
   void displayOff() override;
 
 protected:
+  void writeColumnAddr(int16_t x, uint16_t w) override;
+  void writeRowAddr(int16_t y, uint16_t h) override;
+  void writeMemoryStart() override;
   void tftInit() override;
   bool _invert = false;
 
@@ -46,31 +46,26 @@ void Arduino_HX8347D::tftInit()
   invertDisplay(false);
 }
 
-void Arduino_HX8347D::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_HX8347D::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    int16_t x_start = x + _xStart, x_end = x + w - 1 + _xStart;
-    _bus->writeC8D8(0x02, x_start >> 8);
-    _bus->writeC8D8(0x03, x_start & 0xFF);
-    _bus->writeC8D8(0x04, x_end >> 8);
-    _bus->writeC8D8(0x05, x_end & 0xFF);
-
-    _currentX = x;
-    _currentW = w;
-  }
-  if ((y != _currentY) || (h != _currentH))
-  {
-    int16_t y_start = y + _yStart, y_end = y + h - 1 + _yStart;
-    _bus->writeC8D8(0x06, y_start >> 8);
-    _bus->writeC8D8(0x07, y_start & 0xFF);
-    _bus->writeC8D8(0x08, y_end >> 8);
-    _bus->writeC8D8(0x09, y_end & 0xFF);
+  int16_t x_start = x + _xStart, x_end = x + w - 1 + _xStart;
+  _bus->writeC8D8(0x02, x_start >> 8);
+  _bus->writeC8D8(0x03, x_start & 0xFF);
+  _bus->writeC8D8(0x04, x_end >> 8);
+  _bus->writeC8D8(0x05, x_end & 0xFF);
+}
 
-    _currentY = y;
-    _currentH = h;
-  }
+void Arduino_HX8347D::writeRowAddr(int16_t y, uint16_t h)
+{
+  int16_t y_start = y + _yStart, y_end = y + h - 1 + _yStart;
+  _bus->writeC8D8(0x06, y_start >> 8);
+  _bus->writeC8D8(0x07, y_start & 0xFF);
+  _bus->writeC8D8(0x08, y_end >> 8);
+  _bus->writeC8D8(0x09, y_end & 0xFF);
+}
 
+void Arduino_HX8347D::writeMemoryStart()
+{
   _bus->writeCommand(0x22); // write to RAM
 }
 
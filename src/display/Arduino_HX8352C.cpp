@@ -328,39 +328,34 @@ void Arduino_HX8352C::tftInit()
   _bus->sendCommand(0x22); // Start GRAM write
 }
 
-void Arduino_HX8352C::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_HX8352C::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    int16_t x_start = x + _xStart, x_end = x + w - 1 + _xStart;
-    _bus->writeCommand(0x02);
-    _bus->write(x_start >> 8);
-    _bus->writeCommand(0x03);
-    _bus->write(x_start & 0xFF);
-    _bus->writeCommand(0x04);
-    _bus->write(x_end >> 8);
-    _bus->writeCommand(0x05);
-    _bus->write(x_end & 0xFF);
-
-    _currentX = x;
-    _currentW = w;
-  }
-  if ((y != _currentY) || (h != _currentH))
-  {
-    int16_t y_start = y + _yStart, y_end = y + h - 1 + _yStart;
-    _bus->writeCommand(0x06);
-    _bus->write(y_start >> 8);
-    _bus->writeCommand(0x07);
-    _bus->write(y_start & 0xFF);
-    _bus->writeCommand(0x08);
-    _bus->write(y_end >> 8);
-    _bus->writeCommand(0x09);
-    _bus->write(y_end & 0xFF);
+  int16_t x_start = x + _xStart, x_end = x + w - 1 + _xStart;
+  _bus->writeCommand(0x02);
+  _bus->write(x_start >> 8);
+  _bus->writeCommand(0x03);
+  _bus->write(x_start & 0xFF);
+  _bus->writeCommand(0x04);
+  _bus->write(x_end >> 8);
+  _bus->writeCommand(0x05);
+  _bus->write(x_end & 0xFF);
+}
 
-    _currentY = y;
-    _currentH = h;
-  }
+void Arduino_HX8352C::writeRowAddr(int16_t y, uint16_t h)
+{
+  int16_t y_start = y + _yStart, y_end = y + h - 1 + _yStart;
+  _bus->writeCommand(0x06);
+  _bus->write(y_start >> 8);
+  _bus->writeCommand(0x07);
+  _bus->write(y_start & 0xFF);
+  _bus->writeCommand(0x08);
+  _bus->write(y_end >> 8);
+  _bus->writeCommand(0x09);
+  _bus->write(y_end & 0xFF);
+}
 
+void Arduino_HX8352C::writeMemoryStart()
+{
   _bus->writeCommand(0x22); // write to RAM
 }
 
@@ -41,38 +41,34 @@ void Arduino_HX8357A::setRotation(uint8_t r)
   _bus->endWrite();
 }
 
-void Arduino_HX8357A::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_HX8357A::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    _currentX = x;
-    _currentW = w;
-    x += _xStart;
-    _data16.value = x;
-    _bus->writeC8D8(HX8357A_COLUMN_ADDRESS_COUNTER_2, _data16.msb);
-    _bus->writeC8D8(HX8357A_COLUMN_ADDRESS_COUNTER_1, _data16.lsb);
-    _bus->writeC8D8(HX8357A_COLUMN_ADDRESS_START_2, _data16.msb);
-    _bus->writeC8D8(HX8357A_COLUMN_ADDRESS_START_1, _data16.lsb);
-    _data16.value = x + w - 1;
-    _bus->writeC8D8(HX8357A_COLUMN_ADDRESS_END_2, _data16.msb);
-    _bus->writeC8D8(HX8357A_COLUMN_ADDRESS_END_1, _data16.lsb);
-  }
+  x += _xStart;
+  _data16.value = x;
+  _bus->writeC8D8(HX8357A_COLUMN_ADDRESS_COUNTER_2, _data16.msb);
+  _bus->writeC8D8(HX8357A_COLUMN_ADDRESS_COUNTER_1, _data16.lsb);
+  _bus->writeC8D8(HX8357A_COLUMN_ADDRESS_START_2, _data16.msb);
+  _bus->writeC8D8(HX8357A_COLUMN_ADDRESS_START_1, _data16.lsb);
+  _data16.value = x + w - 1;
+  _bus->writeC8D8(HX8357A_COLUMN_ADDRESS_END_2, _data16.msb);
+  _bus->writeC8D8(HX8357A_COLUMN_ADDRESS_END_1, _data16.lsb);
+}
 
-  if ((y != _currentY) || (h != _currentH))
-  {
-    _currentY = y;
-    _currentH = h;
-    y += _yStart;
-    _data16.value = y;
-    _bus->writeC8D8(HX8357A_ROW_ADDRESS_COUNTER_2, _data16.msb);
-    _bus->writeC8D8(HX8357A_ROW_ADDRESS_COUNTER_1, _data16.lsb);
-    _bus->writeC8D8(HX8357A_ROW_ADDRESS_START_2, _data16.msb);
-    _bus->writeC8D8(HX8357A_ROW_ADDRESS_START_1, _data16.lsb);
-    _data16.value = y + h - 1;
-    _bus->writeC8D8(HX8357A_ROW_ADDRESS_END_2, _data16.msb);
-    _bus->writeC8D8(HX8357A_ROW_ADDRESS_END_1, _data16.lsb);
-  }
+void Arduino_HX8357A::writeRowAddr(int16_t y, uint16_t h)
+{
+  y += _yStart;
+  _data16.value = y;
+  _bus->writeC8D8(HX8357A_ROW_ADDRESS_COUNTER_2, _data16.msb);
+  _bus->writeC8D8(HX8357A_ROW_ADDRESS_COUNTER_1, _data16.lsb);
+  _bus->writeC8D8(HX8357A_ROW_ADDRESS_START_2, _data16.msb);
+  _bus->writeC8D8(HX8357A_ROW_ADDRESS_START_1, _data16.lsb);
+  _data16.value = y + h - 1;
+  _bus->writeC8D8(HX8357A_ROW_ADDRESS_END_2, _data16.msb);
+  _bus->writeC8D8(HX8357A_ROW_ADDRESS_END_1, _data16.lsb);
+}
 
+void Arduino_HX8357A::writeMemoryStart()
+{
   _bus->writeCommand(HX8357A_SRAM_CONTROL);
 }
 
@@ -439,13 +439,14 @@ public:
 
   void setRotation(uint8_t r) override;
 
-  void writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h) override;
-
   void invertDisplay(bool) override;
   void displayOn() override;
   void displayOff() override;
 
 protected:
+  void writeColumnAddr(int16_t x, uint16_t w) override;
+  void writeRowAddr(int16_t y, uint16_t h) override;
+  void writeMemoryStart() override;
   void tftInit() override;
 
 private:
@@ -39,24 +39,20 @@ void Arduino_HX8357B::setRotation(uint8_t r)
   _bus->endWrite();
 }
 
-void Arduino_HX8357B::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_HX8357B::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    _currentX = x;
-    _currentW = w;
-    x += _xStart;
-    _bus->writeC8D16D16(HX8357B_SET_COLUMN_ADDRESS, x, x + w - 1);
-  }
+  x += _xStart;
+  _bus->writeC8D16D16(HX8357B_SET_COLUMN_ADDRESS, x, x + w - 1);
+}
 
-  if ((y != _currentY) || (h != _currentH))
-  {
-    _currentY = y;
-    _currentH = h;
-    y += _yStart;
-    _bus->writeC8D16D16(HX8357B_SET_PAGE_ADDRESS, y, y + h - 1);
-  }
+void Arduino_HX8357B::writeRowAddr(int16_t y, uint16_t h)
+{
+  y += _yStart;
+  _bus->writeC8D16D16(HX8357B_SET_PAGE_ADDRESS, y, y + h - 1);
+}
 
+void Arduino_HX8357B::writeMemoryStart()
+{
   _bus->writeCommand(HX8357B_WRITE_MEMORY_START); // write to RAM
 }
 
@@ -55,24 +55,20 @@ void Arduino_HX8369A::setRotation(uint8_t r)
   _bus->endWrite();
 }
 
-void Arduino_HX8369A::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_HX8369A::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    _currentX = x;
-    _currentW = w;
-    x += _xStart;
-    _bus->writeC8D16D16Split(HX8369A_SET_CLUMN_ADDRESS, x, x + w - 1);
-  }
+  x += _xStart;
+  _bus->writeC8D16D16Split(HX8369A_SET_CLUMN_ADDRESS, x, x + w - 1);
+}
 
-  if ((y != _currentY) || (h != _currentH))
-  {
-    _currentY = y;
-    _currentH = h;
-    y += _yStart;
-    _bus->writeC8D16D16Split(HX8369A_SET_PAGE_ADDRESS, y, y + h - 1);
-  }
+void Arduino_HX8369A::writeRowAddr(int16_t y, uint16_t h)
+{
+  y += _yStart;
+  _bus->writeC8D16D16Split(HX8369A_SET_PAGE_ADDRESS, y, y + h - 1);
+}
 
+void Arduino_HX8369A::writeMemoryStart()
+{
   _bus->writeCommand(HX8369A_WRITE_MEMORY_START);
 }
 
@@ -47,53 +47,50 @@ void Arduino_ILI9225::setRotation(uint8_t r)
   _bus->endWrite();
 }
 
-void Arduino_ILI9225::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_ILI9225::writeColumnAddr(int16_t x, uint16_t w)
 {
   uint8_t cmd1, cmd2, cmd3;
+  x += _xStart;
+  if (_rotation & 0x01) // Landscape
+  {
+    cmd1 = ILI9225_VERTICAL_WINDOW_ADDR2;
+    cmd2 = ILI9225_VERTICAL_WINDOW_ADDR1;
+    cmd3 = ILI9225_RAM_ADDR_SET2;
+  }
+  else
+  {
+    cmd1 = ILI9225_HORIZONTAL_WINDOW_ADDR2;
+    cmd2 = ILI9225_HORIZONTAL_WINDOW_ADDR1;
+    cmd3 = ILI9225_RAM_ADDR_SET1;
+  }
+  _bus->writeC8D16(cmd1, x);
+  _bus->writeC8D16(cmd2, x + w - 1);
+  _bus->writeC8D16(cmd3, x);
+}
 
-  if ((x != _currentX) || (w != _currentW))
+void Arduino_ILI9225::writeRowAddr(int16_t y, uint16_t h)
+{
+  uint8_t cmd1, cmd2, cmd3;
+  y += _yStart;
+  if (_rotation & 0x01) // Landscape
   {
-    _currentX = x;
-    _currentW = w;
-    x += _xStart;
-    if (_rotation & 0x01) // Landscape
-    {
-      cmd1 = ILI9225_VERTICAL_WINDOW_ADDR2;
-      cmd2 = ILI9225_VERTICAL_WINDOW_ADDR1;
-      cmd3 = ILI9225_RAM_ADDR_SET2;
-    }
-    else
-    {
-      cmd1 = ILI9225_HORIZONTAL_WINDOW_ADDR2;
-      cmd2 = ILI9225_HORIZONTAL_WINDOW_ADDR1;
-      cmd3 = ILI9225_RAM_ADDR_SET1;
-    }
-    _bus->writeC8D16(cmd1, x);
-    _bus->writeC8D16(cmd2, x + w - 1);
-    _bus->writeC8D16(cmd3, x);
+    cmd1 = ILI9225_HORIZONTAL_WINDOW_ADDR2;
+    cmd2 = ILI9225_HORIZONTAL_WINDOW_ADDR1;
+    cmd3 = ILI9225_RAM_ADDR_SET1;
   }
-  if ((y != _currentY) || (h != _currentH))
+  else
   {
-    _currentY = y;
-    _currentH = h;
-    y += _yStart;
-    if (_rotation & 0x01) // Landscape
-    {
-      cmd1 = ILI9225_HORIZONTAL_WINDOW_ADDR2;
-      cmd2 = ILI9225_HORIZONTAL_WINDOW_ADDR1;
-      cmd3 = ILI9225_RAM_ADDR_SET1;
-    }
-    else
-    {
-      cmd1 = ILI9225_VERTICAL_WINDOW_ADDR2;
-      cmd2 = ILI9225_VERTICAL_WINDOW_ADDR1;
-      cmd3 = ILI9225_RAM_ADDR_SET2;
-    }
-    _bus->writeC8D16(cmd1, y);
-    _bus->writeC8D16(cmd2, y + h - 1);
-    _bus->writeC8D16(cmd3, y);
+    cmd1 = ILI9225_VERTICAL_WINDOW_ADDR2;
+    cmd2 = ILI9225_VERTICAL_WINDOW_ADDR1;
+    cmd3 = ILI9225_RAM_ADDR_SET2;
   }
+  _bus->writeC8D16(cmd1, y);
+  _bus->writeC8D16(cmd2, y + h - 1);
+  _bus->writeC8D16(cmd3, y);
+}
 
+void Arduino_ILI9225::writeMemoryStart()
+{
   _bus->writeCommand(ILI9225_GRAM_DATA_REG); // write to RAM
 }
 
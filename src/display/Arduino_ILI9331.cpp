@@ -68,28 +68,24 @@ void Arduino_ILI9331::setRotation(uint8_t r)
   _bus->endWrite();
 }
 
-void Arduino_ILI9331::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_ILI9331::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    _currentX = x;
-    _currentW = w;
-    x += _xStart;
-    _bus->writeC16D16(_MC, x);
-    _bus->writeC16D16(_SC, x);
-    _bus->writeC16D16(_EC, x + w - 1);
-  }
+  x += _xStart;
+  _bus->writeC16D16(_MC, x);
+  _bus->writeC16D16(_SC, x);
+  _bus->writeC16D16(_EC, x + w - 1);
+}
 
-  if ((y != _currentY) || (h != _currentH))
-  {
-    _currentY = y;
-    _currentH = h;
-    y += _yStart;
-    _bus->writeC16D16(_MP, y);
-    _bus->writeC16D16(_SP, y);
-    _bus->writeC16D16(_EP, y + h - 1);
-  }
+void Arduino_ILI9331::writeRowAddr(int16_t y, uint16_t h)
+{
+  y += _yStart;
+  _bus->writeC16D16(_MP, y);
+  _bus->writeC16D16(_SP, y);
+  _bus->writeC16D16(_EP, y + h - 1);
+}
 
+void Arduino_ILI9331::writeMemoryStart()
+{
   _bus->writeCommand16(ILI9331_MW);
 }
 
@@ -47,25 +47,40 @@ void Arduino_ILI9341::setRotation(uint8_t r)
   _bus->endWrite();
 }
 
-void Arduino_ILI9341::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_ILI9341::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    _currentX = x;
-    _currentW = w;
-    x += _xStart;
-    _bus->writeC8D16D16(ILI9341_CASET, x, x + w - 1);
-  }
+  x += _xStart;
+  _bus->writeC8D16D16(ILI9341_CASET, x, x + w - 1);
+}
+
+void Arduino_ILI9341::writeRowAddr(int16_t y, uint16_t h)
+{
+  y += _yStart;
+  _bus->writeC8D16D16(ILI9341_PASET, y, y + h - 1);
+}
 
-  if ((y != _currentY) || (h != _currentH))
+void Arduino_ILI9341::writeMemoryStart()
+{
+  _bus->writeCommand(ILI9341_RAMWR); // write to RAM
+}
+
+bool Arduino_ILI9341::writeScrollArea(uint16_t top_fixed, uint16_t rows)
+{
+  if ((top_fixed + rows) > ILI9341_TFTHEIGHT)
   {
-    _currentY = y;
-    _currentH = h;
-    y += _yStart;
-    _bus->writeC8D16D16(ILI9341_PASET, y, y + h - 1);
+    return false;
   }
+  _bus->writeCommand(ILI9341_VSCRDEF);
+  _bus->write16(top_fixed);
+  _bus->write16(rows);
+  _bus->write16(ILI9341_TFTHEIGHT - top_fixed - rows); // bottom fixed rows
+  return true;
+}
 
-  _bus->writeCommand(ILI9341_RAMWR); // write to RAM
+void Arduino_ILI9341::writeScrollStart(uint16_t row)
+{
+  _bus->writeCommand(ILI9341_VSCRSADD);
+  _bus->write16(row);
 }
 
 void Arduino_ILI9341::invertDisplay(bool i)
@@ -73,6 +88,20 @@ void Arduino_ILI9341::invertDisplay(bool i)
   _bus->sendCommand((_ips ^ i) ? ILI9341_INVON : ILI9341_INVOFF);
 }
 
+void Arduino_ILI9341::tearingEffect(bool enable)
+{
+  if (enable)
+  {
+    _bus->beginWrite();
+    _bus->writeC8D8(ILI9341_TEON, 0x00); // V-blanking only
+    _bus->endWrite();
+  }
+  else
+  {
+    _bus->sendCommand(ILI9341_TEOFF);
+  }
+}
+
 void Arduino_ILI9341::displayOn(void)
 {
   _bus->sendCommand(ILI9341_SLPOUT);
@@ -45,6 +45,8 @@
 
 #define ILI9341_PTLAR 0x30    ///< Partial Area
 #define ILI9341_VSCRDEF 0x33  ///< Vertical Scrolling Definition
+#define ILI9341_TEOFF 0x34    ///< Tearing Effect Line OFF
+#define ILI9341_TEON 0x35     ///< Tearing Effect Line ON
 #define ILI9341_MADCTL 0x36   ///< Memory Access Control
 #define ILI9341_VSCRSADD 0x37 ///< Vertical Scrolling Start Address
 #define ILI9341_PIXFMT 0x3A   ///< COLMOD: Pixel Format Set
@@ -127,13 +129,19 @@ public:
 
   void setRotation(uint8_t r) override;
 
-  void writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h) override;
-
   void invertDisplay(bool) override;
   void displayOn() override;
   void displayOff() override;
 
+  // TE output at the start of every vertical blanking, for Arduino_GFX_TESync
+  void tearingEffect(bool enable);
+
 protected:
+  void writeColumnAddr(int16_t x, uint16_t w) override;
+  void writeRowAddr(int16_t y, uint16_t h) override;
+  void writeMemoryStart() override;
+  bool writeScrollArea(uint16_t top_fixed, uint16_t rows) override;
+  void writeScrollStart(uint16_t row) override;
   void tftInit() override;
 
 private:
@@ -124,35 +124,30 @@ void Arduino_ILI9481_18bit::tftInit()
   invertDisplay(false);
 }
 
-void Arduino_ILI9481_18bit::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_ILI9481_18bit::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    int16_t x_start = x + _xStart, x_end = x + w - 1 + _xStart;
-
-    _bus->writeCommand(ILI9481_CASET); // Column addr set
-    _bus->write(x_start >> 8);
-    _bus->write(x_start & 0xFF); // XSTART
-    _bus->write(x_end >> 8);
-    _bus->write(x_end & 0xFF); // XEND
+  int16_t x_start = x + _xStart, x_end = x + w - 1 + _xStart;
 
-    _currentX = x;
-    _currentW = w;
-  }
-  if ((y != _currentY) || (h != _currentH))
-  {
-    int16_t y_start = y + _yStart, y_end = y + h - 1 + _yStart;
+  _bus->writeCommand(ILI9481_CASET); // Column addr set
+  _bus->write(x_start >> 8);
+  _bus->write(x_start & 0xFF); // XSTART
+  _bus->write(x_end >> 8);
+  _bus->write(x_end & 0xFF); // XEND
+}
 
-    _bus->writeCommand(ILI9481_PASET); // Row addr set
-    _bus->write(y_start >> 8);
-    _bus->write(y_start & 0xFF); // YSTART
-    _bus->write(y_end >> 8);
-    _bus->write(y_end & 0xFF); // YEND
+void Arduino_ILI9481_18bit::writeRowAddr(int16_t y, uint16_t h)
+{
+  int16_t y_start = y + _yStart, y_end = y + h - 1 + _yStart;
 
-    _currentY = y;
-    _currentH = h;
-  }
+  _bus->writeCommand(ILI9481_PASET); // Row addr set
+  _bus->write(y_start >> 8);
+  _bus->write(y_start & 0xFF); // YSTART
+  _bus->write(y_end >> 8);
+  _bus->write(y_end & 0xFF); // YEND
+}
 
+void Arduino_ILI9481_18bit::writeMemoryStart()
+{
   _bus->writeCommand(ILI9481_RAMWR); // write to RAM
 }
 
@@ -55,23 +55,20 @@ void Arduino_ILI9486::setRotation(uint8_t r)
   _bus->endWrite();
 }
 
-void Arduino_ILI9486::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_ILI9486::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    _currentX = x;
-    _currentW = w;
-    x += _xStart;
-    _bus->writeC8D16D16Split(ILI9486_CASET, x, x + w - 1);
-  }
-  if ((y != _currentY) || (h != _currentH))
-  {
-    _currentY = y;
-    _currentH = h;
-    y += _yStart;
-    _bus->writeC8D16D16Split(ILI9486_PASET, y, y + h - 1);
-  }
+  x += _xStart;
+  _bus->writeC8D16D16Split(ILI9486_CASET, x, x + w - 1);
+}
 
+void Arduino_ILI9486::writeRowAddr(int16_t y, uint16_t h)
+{
+  y += _yStart;
+  _bus->writeC8D16D16Split(ILI9486_PASET, y, y + h - 1);
+}
+
+void Arduino_ILI9486::writeMemoryStart()
+{
   _bus->writeCommand(ILI9486_RAMWR); // write to RAM
 }
 
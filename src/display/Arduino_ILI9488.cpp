@@ -39,24 +39,46 @@ void Arduino_ILI9488::setRotation(uint8_t r)
   _bus->endWrite();
 }
 
-void Arduino_ILI9488::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_ILI9488::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    _currentX = x;
-    _currentW = w;
-    x += _xStart;
-    _bus->writeC8D16D16Split(ILI9488_CASET, x, x + w - 1);
-  }
-  if ((y != _currentY) || (h != _currentH))
+  x += _xStart;
+  _bus->writeC8D16D16Split(ILI9488_CASET, x, x + w - 1);
+}
+
+void Arduino_ILI9488::writeRowAddr(int16_t y, uint16_t h)
+{
+  y += _yStart;
+  _bus->writeC8D16D16Split(ILI9488_PASET, y, y + h - 1);
+}
+
+void Arduino_ILI9488::writeMemoryStart()
+{
+  _bus->writeCommand(ILI9488_RAMWR); // write to RAM
+}
+
+bool Arduino_ILI9488::writeScrollArea(uint16_t top_fixed, uint16_t rows)
+{
+  if ((top_fixed + rows) > ILI9488_TFTHEIGHT)
   {
-    _currentY = y;
-    _currentH = h;
-    y += _yStart;
-    _bus->writeC8D16D16Split(ILI9488_PASET, y, y + h - 1);
+    return false;
   }
+  uint16_t bottom_fixed = ILI9488_TFTHEIGHT - top_fixed - rows;
 
-  _bus->writeCommand(ILI9488_RAMWR); // write to RAM
+  _bus->writeCommand(ILI9488_VSCRDEF);
+  _bus->write(top_fixed >> 8);
+  _bus->write(top_fixed & 0xFF); // TFA
+  _bus->write(rows >> 8);
+  _bus->write(rows & 0xFF); // VSA
+  _bus->write(bottom_fixed >> 8);
+  _bus->write(bottom_fixed & 0xFF); // BFA
+  return true;
+}
+
+void Arduino_ILI9488::writeScrollStart(uint16_t row)
+{
+  _bus->writeCommand(ILI9488_VSCRSADD);
+  _bus->write(row >> 8);
+  _bus->write(row & 0xFF); // VSP
 }
 
 void Arduino_ILI9488::invertDisplay(bool i)
@@ -34,7 +34,9 @@
 
 #define ILI9488_RAMRD 0x2E
 
+#define ILI9488_VSCRDEF 0x33
 #define ILI9488_MADCTL 0x36
+#define ILI9488_VSCRSADD 0x37
 
 #define ILI9488_MADCTL_MY 0x80
 #define ILI9488_MADCTL_MX 0x40
@@ -107,13 +109,16 @@ public:
 
   void setRotation(uint8_t r) override;
 
-  void writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h) override;
-
   void invertDisplay(bool) override;
   void displayOn() override;
   void displayOff() override;
 
 protected:
+  void writeColumnAddr(int16_t x, uint16_t w) override;
+  void writeRowAddr(int16_t y, uint16_t h) override;
+  void writeMemoryStart() override;
+  bool writeScrollArea(uint16_t top_fixed, uint16_t rows) override;
+  void writeScrollStart(uint16_t row) override;
   void tftInit() override;
 
 private:
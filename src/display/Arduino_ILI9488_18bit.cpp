@@ -39,24 +39,40 @@ void Arduino_ILI9488_18bit::setRotation(uint8_t r)
   _bus->endWrite();
 }
 
-void Arduino_ILI9488_18bit::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_ILI9488_18bit::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    _currentX = x;
-    _currentW = w;
-    x += _xStart;
-    _bus->writeC8D16D16(ILI9488_CASET, x, x + w - 1);
-  }
-  if ((y != _currentY) || (h != _currentH))
+  x += _xStart;
+  _bus->writeC8D16D16(ILI9488_CASET, x, x + w - 1);
+}
+
+void Arduino_ILI9488_18bit::writeRowAddr(int16_t y, uint16_t h)
+{
+  y += _yStart;
+  _bus->writeC8D16D16(ILI9488_PASET, y, y + h - 1);
+}
+
+void Arduino_ILI9488_18bit::writeMemoryStart()
+{
+  _bus->writeCommand(ILI9488_RAMWR); // write to RAM
+}
+
+bool Arduino_ILI9488_18bit::writeScrollArea(uint16_t top_fixed, uint16_t rows)
+{
+  if ((top_fixed + rows) > ILI9488_TFTHEIGHT)
   {
-    _currentY = y;
-    _currentH = h;
-    y += _yStart;
-    _bus->writeC8D16D16(ILI9488_PASET, y, y + h - 1);
+    return false;
   }
+  _bus->writeCommand(ILI9488_VSCRDEF);
+  _bus->write16(top_fixed);
+  _bus->write16(rows);
+  _bus->write16(ILI9488_TFTHEIGHT - top_fixed - rows); // bottom fixed rows
+  return true;
+}
 
-  _bus->writeCommand(ILI9488_RAMWR); // write to RAM
+void Arduino_ILI9488_18bit::writeScrollStart(uint16_t row)
+{
+  _bus->writeCommand(ILI9488_VSCRSADD);
+  _bus->write16(row);
 }
 
 void Arduino_ILI9488_18bit::invertDisplay(bool i)
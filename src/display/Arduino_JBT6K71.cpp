@@ -42,87 +42,82 @@ void Arduino_JBT6K71::tftInit()
   invertDisplay(false);
 }
 
-void Arduino_JBT6K71::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_JBT6K71::writeColumnAddr(int16_t x, uint16_t w)
 {
   uint16_t cmd1, cmd2, cmd3;
+  int16_t x_start, x_end, x_pos;
 
-  if ((x != _currentX) || (w != _currentW))
+  if (_rotation & 0x01) // Landscape
   {
-    int16_t x_start, x_end, x_pos;
-
-    if (_rotation & 0x01) // Landscape
-    {
-      cmd1 = 0x0408;
-      cmd2 = 0x0409;
-      cmd3 = 0x0201;
-    }
-    else
-    {
-      cmd1 = 0x0406;
-      cmd2 = 0x0407;
-      cmd3 = 0x0200;
-    }
-    if (_rotation == 1)
-    {
-      x_start = JBT6K71_TFTHEIGHT - x - w - _xStart;
-      x_end = JBT6K71_TFTHEIGHT - x - 1 - _xStart;
-      x_pos = x_end;
-    }
-    else
-    {
-      x_start = x + _xStart;
-      x_end = x + w - 1 + _xStart;
-      x_pos = x_start;
-    }
-    _bus->writeCommand16(cmd1);
-    _bus->write16(x_start);
-    _bus->writeCommand16(cmd2);
-    _bus->write16(x_end);
-    _bus->writeCommand16(cmd3);
-    _bus->write16(x_pos);
-
-    _currentX = x;
-    _currentW = w;
+    cmd1 = 0x0408;
+    cmd2 = 0x0409;
+    cmd3 = 0x0201;
+  }
+  else
+  {
+    cmd1 = 0x0406;
+    cmd2 = 0x0407;
+    cmd3 = 0x0200;
+  }
+  if (_rotation == 1)
+  {
+    x_start = JBT6K71_TFTHEIGHT - x - w - _xStart;
+    x_end = JBT6K71_TFTHEIGHT - x - 1 - _xStart;
+    x_pos = x_end;
   }
-  if ((y != _currentY) || (h != _currentH))
+  else
   {
-    int16_t y_start, y_end, y_pos;
+    x_start = x + _xStart;
+    x_end = x + w - 1 + _xStart;
+    x_pos = x_start;
+  }
+  _bus->writeCommand16(cmd1);
+  _bus->write16(x_start);
+  _bus->writeCommand16(cmd2);
+  _bus->write16(x_end);
+  _bus->writeCommand16(cmd3);
+  _bus->write16(x_pos);
+}
 
-    if (_rotation & 0x01) // Portrait
-    {
-      cmd1 = 0x0406;
-      cmd2 = 0x0407;
-      cmd3 = 0x0200;
-    }
-    else
-    {
-      cmd1 = 0x0408;
-      cmd2 = 0x0409;
-      cmd3 = 0x0201;
-    }
-    if (_rotation == 0)
-    {
-      y_start = JBT6K71_TFTHEIGHT - y - h - _yStart;
-      y_end = JBT6K71_TFTHEIGHT - y - 1 - _yStart;
-      y_pos = y_end;
-    }
-    else
-    {
-      y_start = y + _yStart;
-      y_end = y + h - 1 + _yStart;
-      y_pos = y_start;
-    }
-    _bus->writeCommand16(cmd1);
-    _bus->write16(y_start);
-    _bus->writeCommand16(cmd2);
-    _bus->write16(y_end);
-    _bus->writeCommand16(cmd3);
-    _bus->write16(y_pos);
+void Arduino_JBT6K71::writeRowAddr(int16_t y, uint16_t h)
+{
+  uint16_t cmd1, cmd2, cmd3;
+  int16_t y_start, y_end, y_pos;
 
-    _currentY = y;
-    _currentH = h;
+  if (_rotation & 0x01) // Portrait
+  {
+    cmd1 = 0x0406;
+    cmd2 = 0x0407;
+    cmd3 = 0x0200;
+  }
+  else
+  {
+    cmd1 = 0x0408;
+    cmd2 = 0x0409;
+    cmd3 = 0x0201;
+  }
+  if (_rotation == 0)
+  {
+    y_start = JBT6K71_TFTHEIGHT - y - h - _yStart;
+    y_end = JBT6K71_TFTHEIGHT - y - 1 - _yStart;
+    y_pos = y_end;
   }
+  else
+  {
+    y_start = y + _yStart;
+    y_end = y + h - 1 + _yStart;
+    y_pos = y_start;
+  }
+  _bus->writeCommand16(cmd1);
+  _bus->write16(y_start);
+  _bus->writeCommand16(cmd2);
+  _bus->write16(y_end);
+  _bus->writeCommand16(cmd3);
+  _bus->write16(y_pos);
+}
 
+void Arduino_JBT6K71::writeMemoryStart()
+{
   _bus->writeCommand16(0x0202); // write to RAM
 }
 
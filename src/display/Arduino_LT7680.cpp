@@ -74,6 +74,20 @@ void Arduino_LT7680::tftInit()
 
     // Set up S1
     initialiseWindowReadyForDrawing(BTE_S1, _mem_address.bte_s0 + display_mem_size);
+
+    // Off-screen surfaces take the display RAM after the windows above
+    _surfaces[LT7680_SCREEN] = {_mem_address.main_window, _config.horizontal_width, _config.vertical_height};
+    _surface_count = 1;
+    _surface_base = _mem_address.bte_s1 + display_mem_size;
+    _surface_top = _surface_base;
+
+    // The main window is the only page until beginPages()
+    _pages[0] = LT7680_SCREEN;
+    _page_surfaces = 1;
+    _page_count = 1;
+    _page_front = 0;
+    _page_back = 0;
+    _flip_pending = false;
 }
 
 void Arduino_LT7680::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
@@ -824,6 +838,7 @@ void Arduino_LT7680::softwareReset(uint16_t delayAfterReset)
     while(isBusy());
     _bus->sendCommand(LT7680_SRR);
     _bus->sendData(0x02);
+    engineStarted(0);
     delay(delayAfterReset);
 }
 
@@ -850,14 +865,94 @@ bool Arduino_LT7680::getStatus(LT7680_Status_Register_Mask v)
 #endif
 }
 
+/**************************************************************************/
+/*!
+  @brief  Whether the engine operation started last is still running.
+          Returns at once when none is, so callers only wait when they
+          are about to touch the engine after starting an operation.
+          The status register is polled where the bus can read it, else
+          the operation is given the time engineStarted() estimated.
+*/
+/**************************************************************************/
 bool Arduino_LT7680::isBusy()
 {
+    if (!_engine_pending)
+        return false;
+
 #if defined(ARDUINO_GFX_INC_READ_OPERATIONS)
-    return getStatus(CORE_TASK_BUSY);
+    if (getStatus(CORE_TASK_BUSY))
+        return true;
 #else
-    delayMicroseconds(LT7680_PROCESSING_TIME_US);
-    return false;
+    if ((uint32_t)(micros() - _engine_start_us) < _engine_time_us)
+        return true;
 #endif
+    _engine_pending = false;
+    return false;
+}
+
+// Records the start of an engine operation that draws up to pixels pixels,
+// 0 when its duration is unknown (reset, PLL, SDRAM initialisation).
+void Arduino_LT7680::engineStarted(uint32_t pixels)
+{
+    _engine_pending = true;
+    _engine_start_us = micros();
+    if (pixels == 0)
+    {
+        _engine_time_us = LT7680_PROCESSING_TIME_US;
+    }
+    else
+    {
+        uint32_t mclk = _clocks.MCLK ? _clocks.MCLK : 1;
+        _engine_time_us = LT7680_ENGINE_SETUP_US + (uint32_t)(((uint64_t)pixels * LT7680_ENGINE_CYCLES_PER_PIXEL) / mclk);
+    }
+}
+
+// Upper bound of the pixels drawn by a shape, from the coordinates and
+// radii last set. 0 for the polygons whose extra points are not tracked.
+uint32_t Arduino_LT7680::shapePixels(LT7680_Draw_Shape_Option shp, bool Fill)
+{
+    uint16_t x1 = _shape_x[0], x2 = _shape_x[0];
+    uint16_t y1 = _shape_y[0], y2 = _shape_y[0];
+    uint8_t points = (shp == DRAW_TRIANGLE) ? 3 : 2;
+    for (uint8_t i = 1; i < points; i++)
+    {
+        if (_shape_x[i] < x1) x1 = _shape_x[i];
+        if (_shape_x[i] > x2) x2 = _shape_x[i];
+        if (_shape_y[i] < y1) y1 = _shape_y[i];
+        if (_shape_y[i] > y2) y2 = _shape_y[i];
+    }
+    uint32_t w = x2 - x1 + 1;
+    uint32_t h = y2 - y1 + 1;
+    uint32_t a = _shape_rx + 1;
+    uint32_t b = _shape_ry + 1;
+
+    switch(shp)
+    {
+        case DRAW_LINE:
+            return (w > h) ? w : h;
+        case DRAW_TRIANGLE:
+        case DRAW_RECT:
+        case DRAW_RND_RECT:
+            return Fill ? (w * h) : (2 * (w + h));
+        case DRAW_ELLIPSE:
+            return Fill ? (4 * a * b) : (4 * (a + b));
+        case DRAW_ARC_UPRT:
+        case DRAW_ARC_UPLT:
+        case DRAW_ARC_LOLT:
+        case DRAW_ARC_LORT:
+            return Fill ? (a * b) : (a + b);
+        default:
+            return 0;
+    }
+}
+
+// Upper bound of the pixels drawn by chars characters at the character
+// height and enlargement set, taking every character as full width.
+uint32_t Arduino_LT7680::textPixels(uint16_t chars)
+{
+    uint32_t size = 16 + 8 * ((_registers.CCR0 >> 4) & 0x03);
+    uint32_t zoom = (((_registers.CCR1 >> 2) & 0x03) + 1) * ((_registers.CCR1 & 0x03) + 1);
+    return chars * size * size * zoom;
 }
 
 bool Arduino_LT7680::isNormalOperation()
@@ -997,6 +1092,7 @@ void Arduino_LT7680::initialisePLL()
     _bus->sendCommand(LT7680_SRR);
     delayMicroseconds(1);
     _bus->sendData(0x80);
+    engineStarted(0);
     delay(1);
 }
 
@@ -1022,6 +1118,7 @@ void Arduino_LT7680::initialiseSDRAM()
     // Start SDRAM initialisation procedure
     _bus->sendCommand(LT7680_SDRCR);
     _bus->sendData(0x01);
+    engineStarted(0);
 
     while(!isDisplayRAMReady());
 }
@@ -1207,7 +1304,6 @@ Arduino_LT7680::LT7680_Power_Mode Arduino_LT7680::getPowerManagementMode()
 
 void Arduino_LT7680::setPWMPrescaler(uint8_t prescaler_minus1)
 {
-    while(isBusy());
     _bus->sendCommand(LT7680_PSCLR);
     _bus->sendData(prescaler_minus1);
 }
@@ -1226,7 +1322,6 @@ void Arduino_LT7680::setPWM0Parameters(uint8_t divisor, uint16_t total_count, ui
     _registers.PCFGR &= ~val;
     _registers.PCFGR |= val;
 
-    while(isBusy());
     _bus->sendCommand(LT7680_PMUXR);
     _bus->sendData(_registers.PMUXR);
     _bus->sendCommand(LT7680_PCFGR);
@@ -1254,7 +1349,6 @@ void Arduino_LT7680::setPWM1Parameters(uint8_t divisor, uint16_t total_count, ui
     _registers.PCFGR &= ~val;
     _registers.PCFGR |= val;
 
-    while(isBusy());
     _bus->sendCommand(LT7680_PMUXR);
     _bus->sendData(_registers.PMUXR);
     _bus->sendCommand(LT7680_PCFGR);
@@ -1268,7 +1362,6 @@ void Arduino_LT7680::setPWM1Parameters(uint8_t divisor, uint16_t total_count, ui
 
 void Arduino_LT7680::updatePWM0Compare(uint16_t value)
 {
-    while(isBusy());
     _bus->sendCommand(LT7680_TCMPB0_LO);
     _bus->sendData(value & 0xFF);
     _bus->sendCommand(LT7680_TCMPB0_HI);
@@ -1277,7 +1370,6 @@ void Arduino_LT7680::updatePWM0Compare(uint16_t value)
 
 void Arduino_LT7680::updatePWM1Compare(uint16_t value)
 {
-    while(isBusy());
     _bus->sendCommand(LT7680_TCMPB1_LO);
     _bus->sendData(value & 0xFF);
     _bus->sendCommand(LT7680_TCMPB1_HI);
@@ -1291,7 +1383,6 @@ void Arduino_LT7680::enablePWM0(bool enable)
     else
         _registers.PCFGR &= ~0x01;
 
-    while(isBusy());
     _bus->sendCommand(LT7680_PCFGR);
     _bus->sendData(_registers.PCFGR);
 }
@@ -1303,7 +1394,6 @@ void Arduino_LT7680::enablePWM1(bool enable)
     else
         _registers.PCFGR &= ~0x10;
 
-    while(isBusy());
     _bus->sendCommand(LT7680_PCFGR);
     _bus->sendData(_registers.PCFGR);
 }
@@ -2259,6 +2349,8 @@ void Arduino_LT7680::setStraightShapeCoordinates(uint16_t x0, uint16_t y0)
     // Only 13 bits are allowed
     x0 &= 0x1FFF;
     y0 &= 0x1FFF;
+    _shape_x[0] = x0;
+    _shape_y[0] = y0;
 
     while(isBusy());
 
@@ -2280,6 +2372,8 @@ void Arduino_LT7680::setStraightShapeCoordinates(uint16_t x0, uint16_t y0, uint1
     // Only 13 bits are allowed
     x1 &= 0x1FFF;
     y1 &= 0x1FFF;
+    _shape_x[1] = x1;
+    _shape_y[1] = y1;
 
     while(isBusy());
 
@@ -2301,6 +2395,8 @@ void Arduino_LT7680::setStraightShapeCoordinates(uint16_t x0, uint16_t y0, uint1
     // Only 13 bits are allowed
     x2 &= 0x1FFF;
     y2 &= 0x1FFF;
+    _shape_x[2] = x2;
+    _shape_y[2] = y2;
 
     while(isBusy());
 
@@ -2320,6 +2416,8 @@ void Arduino_LT7680::setCurvedShapeParameters(uint16_t major_radius, uint16_t mi
     // Only 13 bits are allowed
     major_radius &= 0x1FFF;
     minor_radius &= 0x1FFF;
+    _shape_rx = major_radius;
+    _shape_ry = minor_radius;
 
     while(isBusy());
 
@@ -2372,6 +2470,7 @@ void Arduino_LT7680::startDrawingShape(LT7680_Draw_Shape_Option shp, bool Fill,
             while(isBusy());
             _bus->sendCommand(LT7680_DCR0);
             _bus->sendData(0x80 | (Fill?0x20:0) | (PolylineClose?1:0) | ((shp & 0x0F) << 1));
+            engineStarted(shapePixels(shp, Fill));
             return;
 
         case DRAW_RECT:
@@ -2400,6 +2499,7 @@ void Arduino_LT7680::startDrawingShape(LT7680_Draw_Shape_Option shp, bool Fill,
     while(isBusy());
     _bus->sendCommand(LT7680_DCR1);
     _bus->sendData(0x80 | data | (Fill?0x40:0));
+    engineStarted(shapePixels(shp, Fill));
 }
 
 void Arduino_LT7680::setForegroundColour(uint8_t red, uint8_t green, uint8_t blue)
@@ -2563,12 +2663,16 @@ void Arduino_LT7680::BTE_enable()
     while(isBusy());
     _bus->sendCommand(LT7680_BLT_CTRL0);
     _bus->sendData(_registers.BLT_CTRL0);
+    // a copy reads the sources and writes the destination
+    engineStarted((uint32_t)_bte_width * _bte_height * 2);
 }
 
 void Arduino_LT7680::BTE_setWindowSize(uint16_t width, uint16_t height)
 {
-    width &= 0x1FFC; // Maximum of 13 bits are allowed
+    width &= 0x1FFF; // Maximum of 13 bits are allowed
     height &= 0x1FFF; // Maximum of 13 bits are allowed
+    _bte_width = width;
+    _bte_height = height;
 
     while(isBusy());
     _bus->sendCommand(LT7680_BLT_WTH_LO);
@@ -2598,6 +2702,373 @@ void Arduino_LT7680::BTE_setOperation(LT7680_BTE_Operation_Code op, uint8_t ROP)
     _bus->sendData((op & 0xF) | ((ROP & 0xF) << 4));
 }
 
+// Points a BTE source or the destination at surface s, from (hw_x, hw_y)
+void Arduino_LT7680::BTE_setSurface(LT7680_WindowSelection wnd, int8_t s, uint16_t hw_x, uint16_t hw_y)
+{
+    setStartMemoryAddress(wnd, _surfaces[s].address);
+    setWindowWidth(wnd, _surfaces[s].width);
+    setWindowUpperLeftXY(wnd, hw_x, hw_y);
+    setImageColourDepth(wnd, _config.mem_colour_depth);
+}
+
+/**************************************************************************/
+/*!
+  @brief  Allocate an off-screen surface in display RAM
+  @param  hw_width    Width in pixels, rounded up to a multiple of 4
+  @param  hw_height   Height in pixels
+  @return Surface handle, -1 when display RAM or handles ran out
+*/
+/**************************************************************************/
+int8_t Arduino_LT7680::createSurface(uint16_t hw_width, uint16_t hw_height)
+{
+    if (_surface_count >= LT7680_MAX_SURFACES)
+        return -1;
+
+    hw_width = (hw_width + 3) & ~3;
+    uint8_t bpp = (_config.mem_colour_depth == ::DEPTH_8BPP) ? 1 : ((_config.mem_colour_depth == ::DEPTH_16BPP) ? 2 : 3);
+    uint32_t size = (uint32_t)hw_width * hw_height * bpp;
+    if ((_surface_top + size) > LT7680_SDRAM_SIZE)
+        return -1;
+
+    _surfaces[_surface_count] = {_surface_top, hw_width, hw_height};
+    _surface_top += (size + 3) & ~3UL;
+    return _surface_count++;
+}
+
+void Arduino_LT7680::releaseSurfaces()
+{
+    beginPages(1); // Pages are surfaces too
+    _page_surfaces = 1;
+    _surface_count = 1;
+    _surface_top = _surface_base;
+}
+
+uint16_t Arduino_LT7680::getSurfaceWidth(int8_t s)
+{
+    return _surfaces[s].width;
+}
+
+uint16_t Arduino_LT7680::getSurfaceHeight(int8_t s)
+{
+    return _surfaces[s].height;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Direct drawing and image writes to a surface, LT7680_SCREEN to
+          draw on the screen again
+  @param  s       Surface handle
+*/
+/**************************************************************************/
+void Arduino_LT7680::selectSurface(int8_t s)
+{
+    setStartMemoryAddress(CANVAS, _surfaces[s].address);
+    setWindowWidth(CANVAS, _surfaces[s].width);
+    setImageColourDepth(CANVAS, _config.mem_colour_depth);
+    setActiveWindowArea(0, 0, _surfaces[s].width, _surfaces[s].height);
+}
+
+/**************************************************************************/
+/*!
+  @brief  Upload a 16-bit image (RGB 5/6/5) into a surface with a BTE MCU
+          write, without moving the canvas
+  @param  s       Surface handle
+  @param  hw_x    Top left corner x coordinate in the surface
+  @param  hw_y    Top left corner y coordinate in the surface
+  @param  bitmap  Image data, w * h pixels
+  @param  w       Width of the image in pixels
+  @param  h       Height of the image in pixels
+*/
+/**************************************************************************/
+void Arduino_LT7680::writeSurface(int8_t s, uint16_t hw_x, uint16_t hw_y, const uint16_t *bitmap, uint16_t w, uint16_t h)
+{
+    LT7680_ColourDepth cd = _config.mem_colour_depth;
+
+    BTE_setSurface(BTE_DEST, s, hw_x, hw_y);
+    setImageColourDepth(BTE_S0, cd); // MCU data is source 0
+    BTE_setWindowSize(w, h);
+    BTE_setOperation(MCU_WRITE_WITH_ROP, S0);
+    BTE_enable();
+
+    _bus->sendCommand(LT7680_MRWDP);
+    for(uint16_t j = 0; j < h; j++)
+    {
+        for(uint16_t i = 0; i < w; i++)
+            writeColor(*bitmap++, cd);
+
+        while(!isWriteFIFOEmpty());
+    }
+}
+
+/**************************************************************************/
+/*!
+  @brief  Copy a rectangle between or within surfaces in display RAM
+  @param  src     Source surface handle
+  @param  src_x   Top left corner x coordinate in the source
+  @param  src_y   Top left corner y coordinate in the source
+  @param  w       Width in pixels
+  @param  h       Height in pixels
+  @param  dst     Destination surface handle
+  @param  dst_x   Top left corner x coordinate in the destination
+  @param  dst_y   Top left corner y coordinate in the destination
+  @param  rop     Raster operation of source (S0) and destination (S1)
+*/
+/**************************************************************************/
+void Arduino_LT7680::blit(int8_t src, uint16_t src_x, uint16_t src_y, uint16_t w, uint16_t h, int8_t dst, uint16_t dst_x, uint16_t dst_y, LT7680_BTE_ROP rop)
+{
+    BTE_setSurface(BTE_S0, src, src_x, src_y);
+    if ((rop != BLACKNESS) && (rop != NOT_S0) && (rop != S0) && (rop != WHITENESS))
+        BTE_setSurface(BTE_S1, dst, dst_x, dst_y);
+    BTE_setSurface(BTE_DEST, dst, dst_x, dst_y);
+    BTE_setWindowSize(w, h);
+    BTE_setOperation(MEM_COPY_WITH_ROP, rop);
+    BTE_enable();
+}
+
+/**************************************************************************/
+/*!
+  @brief  Copy a rectangle between surfaces, leaving out the pixels of the
+          key colour (sprites)
+  @param  key_colour  16-bit 5-6-5 color not copied
+*/
+/**************************************************************************/
+void Arduino_LT7680::blitChromaKey(int8_t src, uint16_t src_x, uint16_t src_y, uint16_t w, uint16_t h, int8_t dst, uint16_t dst_x, uint16_t dst_y, uint16_t key_colour)
+{
+    BTE_setSurface(BTE_S0, src, src_x, src_y);
+    BTE_setSurface(BTE_DEST, dst, dst_x, dst_y);
+    BTE_setWindowSize(w, h);
+    setBackgroundColour(key_colour); // The key is the background colour
+    BTE_setOperation(MEM_COPY_WITH_CHROMA_KEY);
+    BTE_enable();
+}
+
+/**************************************************************************/
+/*!
+  @brief  Tile a rectangle with an 8x8 or 16x16 pattern surface
+  @param  pattern Pattern surface handle, 8x8 or 16x16 pixels
+  @param  dst     Destination surface handle
+  @param  rop     Raster operation of pattern (S0) and destination (S1)
+*/
+/**************************************************************************/
+void Arduino_LT7680::patternFill(int8_t pattern, int8_t dst, uint16_t hw_x, uint16_t hw_y, uint16_t w, uint16_t h, LT7680_BTE_ROP rop)
+{
+    uint16_t size = _surfaces[pattern].height;
+    if ((size != 8 && size != 16) || (_surfaces[pattern].width != size))
+        return;
+
+    if (size == 16)
+        _registers.BLT_CTRL0 |= 0x01;
+    else
+        _registers.BLT_CTRL0 &= ~0x01;
+    _registers.BLT_CTRL0 &= ~0x10; // Written with the start bit by BTE_enable()
+
+    BTE_setSurface(BTE_S0, pattern, 0, 0);
+    if ((rop != BLACKNESS) && (rop != NOT_S0) && (rop != S0) && (rop != WHITENESS))
+        BTE_setSurface(BTE_S1, dst, hw_x, hw_y);
+    BTE_setSurface(BTE_DEST, dst, hw_x, hw_y);
+    BTE_setWindowSize(w, h);
+    BTE_setOperation(PATTERN_FILL_WITH_ROP, rop);
+    BTE_enable();
+}
+
+/**************************************************************************/
+/*!
+  @brief  Move a rectangle of a surface by (dx, dy), e.g. to scroll the
+          screen. The area uncovered keeps its old content.
+  @param  s       Surface handle
+  @param  hw_x    Top left corner x coordinate of the area to move
+  @param  hw_y    Top left corner y coordinate of the area to move
+  @param  w       Width in pixels
+  @param  h       Height in pixels
+  @param  dx      Horizontal offset
+  @param  dy      Vertical offset
+*/
+/**************************************************************************/
+void Arduino_LT7680::scrollRect(int8_t s, uint16_t hw_x, uint16_t hw_y, uint16_t w, uint16_t h, int16_t dx, int16_t dy)
+{
+    // The BTE copies rows top down, left to right: a move up or left is one
+    // copy. Other moves over themselves go in bands no taller (or wider)
+    // than the offset, the far band first, so no band reads pixels an
+    // earlier one wrote.
+    if ((dy < 0) || ((dy == 0) && (dx <= 0)) || (dy >= h) || ((dy == 0) && (dx >= w)))
+    {
+        blit(s, hw_x, hw_y, w, h, s, hw_x + dx, hw_y + dy);
+    }
+    else if (dy > 0)
+    {
+        for (int16_t y = h; y > 0; y -= dy)
+        {
+            int16_t band = (y < dy) ? y : dy;
+            blit(s, hw_x, hw_y + y - band, w, band, s, hw_x + dx, hw_y + y - band + dy);
+        }
+    }
+    else
+    {
+        for (int16_t x = w; x > 0; x -= dx)
+        {
+            int16_t band = (x < dx) ? x : dx;
+            blit(s, hw_x + x - band, hw_y, band, h, s, hw_x + x - band + dx, hw_y);
+        }
+    }
+}
+
+/**************************************************************************/
+/*!
+  @brief  Draw on hidden pages from now on, shown one at a time by
+          flipPage(). The pages are screen sized surfaces, the first
+          one being LT7680_SCREEN.
+  @param  count   2 for double, 3 for triple buffering, 1 to draw on the
+                  screen directly again
+  @return false when display RAM for the pages ran out
+*/
+/**************************************************************************/
+bool Arduino_LT7680::beginPages(uint8_t count)
+{
+    if ((count < 1) || (count > LT7680_MAX_PAGES))
+        return false;
+    // The main window scans every page out with its own width register,
+    // which holds multiples of 4 only, as page surfaces are allocated
+    if ((count > 1) && (_surfaces[LT7680_SCREEN].width & 3))
+        return false;
+
+    if (_flip_pending)
+        waitForVSync();
+    if (_page_front != 0)
+        setStartMemoryAddress(MAIN, _surfaces[LT7680_SCREEN].address);
+    _page_count = 1;
+    _page_front = 0;
+    _page_back = 0;
+
+    for (uint8_t i = _page_surfaces; i < count; i++)
+    {
+        int8_t s = createSurface(_surfaces[LT7680_SCREEN].width, _surfaces[LT7680_SCREEN].height);
+        if (s < 0)
+        {
+            selectSurface(LT7680_SCREEN);
+            return false;
+        }
+        _pages[i] = s;
+        _page_surfaces = i + 1;
+    }
+
+    _page_count = count;
+    _page_back = (count > 1) ? 1 : 0;
+    selectSurface(_pages[_page_back]);
+    return true;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Show the page drawn since the last flip and draw on the next.
+          The controller takes the new main window start address at the
+          next VSYNC. With two pages the page given up is still shown
+          until then, so flipPage() waits for it. With three the next
+          page is free at once and only the flip after waits, if it comes
+          within the same frame.
+  @param  copy    Start the new hidden page as a copy of the page shown,
+                  for drawing changes only
+*/
+/**************************************************************************/
+void Arduino_LT7680::flipPage(bool copy)
+{
+    if (_page_count < 2)
+        return;
+
+    if (_flip_pending)
+        waitForVSync();
+    while(isBusy()); // Drawing on the page finishes first
+
+    setStartMemoryAddress(MAIN, _surfaces[_pages[_page_back]].address);
+    startVSyncWait();
+    _flip_pending = true;
+
+    uint8_t shown = _page_front;
+    _page_front = _page_back;
+    _page_back = (_page_back + 1) % _page_count;
+    if (_page_back == shown)
+        waitForVSync();
+
+    if (copy)
+        blit(_pages[_page_front], 0, 0, _surfaces[LT7680_SCREEN].width, _surfaces[LT7680_SCREEN].height, _pages[_page_back], 0, 0);
+    selectSurface(_pages[_page_back]);
+}
+
+int8_t Arduino_LT7680::getBackPage()
+{
+    return _pages[_page_back];
+}
+
+// Clears the VSYNC flag, so waitForVSync() returns after the next one
+void Arduino_LT7680::startVSyncWait()
+{
+#if defined(ARDUINO_GFX_INC_READ_OPERATIONS)
+    _bus->sendCommand(LT7680_INTF);
+    _bus->sendData(LT7680_INTF_VSYNC);
+#endif
+    _vsync_wait_start_us = micros();
+}
+
+/**************************************************************************/
+/*!
+  @brief  Wait for the VSYNC that takes a pending flip, or else for the
+          next one. Without read operations the flag cannot be polled,
+          a frame period is waited out instead.
+*/
+/**************************************************************************/
+void Arduino_LT7680::waitForVSync()
+{
+    if (!_flip_pending)
+        startVSyncWait();
+
+#if defined(ARDUINO_GFX_INC_READ_OPERATIONS)
+    uint32_t start = millis();
+    while(!(_bus->receive(LT7680_INTF) & LT7680_INTF_VSYNC) && ((millis() - start) < LT7680_VSYNC_TIMEOUT_MS));
+#else
+    uint32_t h_total = _config.horizontal_width + _config.HSYNC_front_porch + _config.HSYNC_pulse_width + _config.HSYNC_back_porch;
+    uint32_t v_total = _config.vertical_height + _config.VSYNC_front_porch + _config.VSYNC_pulse_width + _config.VSYNC_back_porch;
+    uint32_t frame_us = (h_total * v_total) / (_clocks.PCLK ? _clocks.PCLK : 1);
+    while((uint32_t)(micros() - _vsync_wait_start_us) < frame_us);
+#endif
+    _flip_pending = false;
+}
+
+/**************************************************************************/
+/*!
+  @brief  Show a surface in a PIP window, on top of the main window
+          without touching it, e.g. for a cursor or a status bar. PIP
+          positions and sizes are multiples of 4 pixels.
+  @param  pip     PIP1 or PIP2, PIP1 being on top
+  @param  s       Surface handle
+  @param  hw_x    Top left corner x coordinate on the screen
+  @param  hw_y    Top left corner y coordinate on the screen
+*/
+/**************************************************************************/
+void Arduino_LT7680::showOverlay(LT7680_WindowSelection pip, int8_t s, uint16_t hw_x, uint16_t hw_y)
+{
+    if(pip != PIP1 && pip != PIP2)
+        return;
+
+    setStartMemoryAddress(pip, _surfaces[s].address);
+    setWindowWidth(pip, _surfaces[s].width);
+    setImageColourDepth(pip, _config.mem_colour_depth);
+    setPIPWindow(pip, 0, 0, _surfaces[s].width, _surfaces[s].height);
+    setWindowUpperLeftXY(pip, hw_x, hw_y);
+    enablePIP(pip, true);
+}
+
+void Arduino_LT7680::moveOverlay(LT7680_WindowSelection pip, uint16_t hw_x, uint16_t hw_y)
+{
+    if(pip != PIP1 && pip != PIP2)
+        return;
+
+    setWindowUpperLeftXY(pip, hw_x, hw_y);
+}
+
+void Arduino_LT7680::hideOverlay(LT7680_WindowSelection pip)
+{
+    enablePIP(pip, false);
+}
+
 
 void Arduino_LT7680::setLT7680Rotation(LT7680_Rotation r)
 {
@@ -2806,6 +3277,7 @@ void Arduino_LT7680::writeText(char c)
     while(isBusy());
     _bus->sendCommand(LT7680_MRWDP);
     _bus->sendData(c);
+    engineStarted(textPixels(1));
 }
 
 void Arduino_LT7680::writeText(const char *chars)
@@ -2815,6 +3287,7 @@ void Arduino_LT7680::writeText(const char *chars)
     uint16_t len = strlen(chars);
     for(uint16_t i=0; i<len; i++)
         _bus->sendData(chars[i]);
+    engineStarted(textPixels(len));
 }
 
 void Arduino_LT7680::setTextCursorEnable(bool enable)
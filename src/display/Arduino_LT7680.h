@@ -7,9 +7,32 @@
 
 #include <Arduino.h>
 #include <SPI.h>
-#include "Arduino_Databus.h"
+#include "../Arduino_DataBus.h"
 
-#define LT7680_PROCESSING_TIME_US   5000    // Delay to allow time for the chip to process a drawing command.
+#define LT7680_PROCESSING_TIME_US   5000    // Delay to allow time for the chip to process a command of unknown duration.
+
+// Without ARDUINO_GFX_INC_READ_OPERATIONS the status register cannot be read,
+// isBusy() then waits out an estimate of the running engine operation:
+// setup time plus cycles per pixel drawn at the memory clock.
+#ifndef LT7680_ENGINE_SETUP_US
+#define LT7680_ENGINE_SETUP_US      10
+#endif
+#ifndef LT7680_ENGINE_CYCLES_PER_PIXEL
+#define LT7680_ENGINE_CYCLES_PER_PIXEL 4
+#endif
+
+// Off-screen surfaces in display RAM, see createSurface()
+#ifndef LT7680_MAX_SURFACES
+#define LT7680_MAX_SURFACES         16
+#endif
+#define LT7680_SCREEN               0    // Surface handle of the main window
+
+// Page flipping, see beginPages()
+#define LT7680_MAX_PAGES            3
+#define LT7680_INTF_VSYNC           0x10 // INTF bit set at the start of every VSYNC, write 1 to clear
+#ifndef LT7680_VSYNC_TIMEOUT_MS
+#define LT7680_VSYNC_TIMEOUT_MS     50
+#endif
 
 #if !defined(LT7680A_R) && !defined(LT7680B_R)
 // Default to LT7680A_R variant of chip
@@ -150,6 +173,7 @@ struct LT7680_Config {
 #endif // ifdef LT7680A_R
 
 #define LT7680_SDRAR_SETTING        0x29 // Four banks, Row size 4096, Column Size 512
+#define LT7680_SDRAM_SIZE           (4UL * 4096 * 512 * 2) // Bytes of display RAM with the setting above
 #define LT7680_SDR_REF_LO_SETTING   0x1A // SDRAM Auto Refresh Timing for chip (LSB)
 #define LT7680_SDR_REF_HI_SETTING   0x06 // SDRAM Auto Refresh Timing for chip (MSB)
 
@@ -628,11 +652,53 @@ private:
         LT7680_ColourDepth colourDepth;
     } _user_space_config[4];
 
+    // Off-screen surfaces, allocated upwards from _surface_base. Surface 0
+    // (LT7680_SCREEN) is the main window.
+    struct LT7680Surface {
+        uint32_t address;
+        uint16_t width;     // Hardware pixels, multiple of 4
+        uint16_t height;
+    } _surfaces[LT7680_MAX_SURFACES];
+    uint8_t _surface_count = 0;
+    uint32_t _surface_base = 0;
+    uint32_t _surface_top = 0;
+
+    void BTE_setSurface(LT7680_WindowSelection wnd, int8_t s, uint16_t hw_x, uint16_t hw_y);
+
+    // Page flipping: surface handles of the pages, the shown one and the
+    // one drawn to. _flip_pending until the main window start address
+    // written by flipPage() was taken at a VSYNC. Page surfaces stay
+    // allocated until releaseSurfaces(), _page_surfaces counting them with
+    // the main window, so beginPages() again reuses them.
+    int8_t _pages[LT7680_MAX_PAGES];
+    uint8_t _page_surfaces = 1;
+    uint8_t _page_count = 0;
+    uint8_t _page_front = 0;
+    uint8_t _page_back = 0;
+    bool _flip_pending = false;
+    uint32_t _vsync_wait_start_us = 0;
+
+    void startVSyncWait();
+
     LT7680_Config _config;
     Freq_Config _clocks;
     Arduino_DataBus * _lcd_bus = nullptr;
     LT7680_Rotation _lt7680_rotation = ROTATE_NORMAL;
 
+    // Engine operation in flight: isBusy() returns at once when there is none,
+    // so only the command after an operation waits for it.
+    bool _engine_pending = false;
+    uint32_t _engine_start_us = 0;
+    uint32_t _engine_time_us = 0;
+    // Geometry of the shape and BTE operation about to start, for the estimate
+    uint16_t _shape_x[3] = {0, 0, 0}, _shape_y[3] = {0, 0, 0};
+    uint16_t _shape_rx = 0, _shape_ry = 0;
+    uint16_t _bte_width = 0, _bte_height = 0;
+
+    void engineStarted(uint32_t pixels);
+    uint32_t shapePixels(LT7680_Draw_Shape_Option shp, bool Fill);
+    uint32_t textPixels(uint16_t chars);
+
     uint8_t reverseBits(uint8_t in);
     uint16_t rotate1bitBitmapByLine(uint8_t *data, uint16_t org_w, uint16_t org_h, uint16_t y, uint8_t *output);
     uint16_t rotate1bitBitmapByLine(const uint8_t data[], uint16_t org_w, uint16_t org_h, uint16_t y, uint8_t *output);
@@ -719,6 +785,30 @@ public:
     void BTE_setAlphaBlending(uint8_t alpha);
     void BTE_setOperation(LT7680_BTE_Operation_Code op, uint8_t ROP = 0);
 
+    // Off-screen surfaces: rectangles of display RAM at the memory colour
+    // depth, addressed by handle, in hardware coordinates. Images uploaded
+    // once are then drawn by the BTE without host bus traffic.
+    int8_t createSurface(uint16_t hw_width, uint16_t hw_height); // Handle, or -1 when out of display RAM or handles
+    void releaseSurfaces(); // Frees every surface but LT7680_SCREEN
+    uint16_t getSurfaceWidth(int8_t s);
+    uint16_t getSurfaceHeight(int8_t s);
+    void selectSurface(int8_t s); // Points the canvas, which drawing goes to, at s
+    void writeSurface(int8_t s, uint16_t hw_x, uint16_t hw_y, const uint16_t *bitmap, uint16_t w, uint16_t h);
+    void blit(int8_t src, uint16_t src_x, uint16_t src_y, uint16_t w, uint16_t h, int8_t dst, uint16_t dst_x, uint16_t dst_y, LT7680_BTE_ROP rop = S0);
+    void blitChromaKey(int8_t src, uint16_t src_x, uint16_t src_y, uint16_t w, uint16_t h, int8_t dst, uint16_t dst_x, uint16_t dst_y, uint16_t key_colour);
+    void patternFill(int8_t pattern, int8_t dst, uint16_t hw_x, uint16_t hw_y, uint16_t w, uint16_t h, LT7680_BTE_ROP rop = S0);
+    void scrollRect(int8_t s, uint16_t hw_x, uint16_t hw_y, uint16_t w, uint16_t h, int16_t dx, int16_t dy);
+
+    // Page flipping: drawing goes to a hidden page, flipPage() shows it at
+    // the next VSYNC. PIP windows are overlays on top of the shown page.
+    bool beginPages(uint8_t count); // 2 (double) or 3 (triple buffered), 1 to draw on the screen again
+    void flipPage(bool copy = false); // copy: the new hidden page starts as a copy of the page shown
+    int8_t getBackPage(); // Surface handle of the page drawn to, e.g. for blit()
+    void waitForVSync();
+    void showOverlay(LT7680_WindowSelection pip, int8_t s, uint16_t hw_x, uint16_t hw_y);
+    void moveOverlay(LT7680_WindowSelection pip, uint16_t hw_x, uint16_t hw_y);
+    void hideOverlay(LT7680_WindowSelection pip);
+
     size_t getImageMemorySize(LT7680_WindowSelection wnd);
 
     // Extra version to allow for background colour
@@ -18,23 +18,18 @@ bool Arduino_NT35310::begin(int32_t speed)
   return Arduino_TFT::begin(speed);
 }
 
-void Arduino_NT35310::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_NT35310::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    _bus->writeC8D16D16(NT35310_SET_HORIZONTAL_ADDRESS, x + _xStart, x + w - 1 + _xStart);
-
-    _currentX = x;
-    _currentW = w;
-  }
-  if ((y != _currentY) || (h != _currentH))
-  {
-    _bus->writeC8D16D16(NT35310_SET_VERTICAL_ADDRESS, y + _yStart, y + h - 1 + _yStart);
+  _bus->writeC8D16D16(NT35310_SET_HORIZONTAL_ADDRESS, x + _xStart, x + w - 1 + _xStart);
+}
 
-    _currentY = y;
-    _currentH = h;
-  }
+void Arduino_NT35310::writeRowAddr(int16_t y, uint16_t h)
+{
+  _bus->writeC8D16D16(NT35310_SET_VERTICAL_ADDRESS, y + _yStart, y + h - 1 + _yStart);
+}
 
+void Arduino_NT35310::writeMemoryStart()
+{
   _bus->writeCommand(NT35310_WRITE_MEMORY_START); // write to RAM
 }
 
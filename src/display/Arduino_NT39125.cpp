@@ -18,23 +18,18 @@ bool Arduino_NT39125::begin(int32_t speed)
   return Arduino_TFT::begin(speed);
 }
 
-void Arduino_NT39125::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_NT39125::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    _bus->writeC8D16D16(NT39125_CASET, x + _xStart, x + w - 1 + _xStart);
-
-    _currentX = x;
-    _currentW = w;
-  }
-  if ((y != _currentY) || (h != _currentH))
-  {
-    _bus->writeC8D16D16(NT39125_RASET, y + _yStart, y + h - 1 + _yStart);
+  _bus->writeC8D16D16(NT39125_CASET, x + _xStart, x + w - 1 + _xStart);
+}
 
-    _currentY = y;
-    _currentH = h;
-  }
+void Arduino_NT39125::writeRowAddr(int16_t y, uint16_t h)
+{
+  _bus->writeC8D16D16(NT39125_RASET, y + _yStart, y + h - 1 + _yStart);
+}
 
+void Arduino_NT39125::writeMemoryStart()
+{
   _bus->writeCommand(NT39125_RAMWR); // write to RAM
 }
 
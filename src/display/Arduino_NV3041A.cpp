@@ -47,24 +47,20 @@ void Arduino_NV3041A::setRotation(uint8_t r)
   _bus->endWrite();
 }
 
-void Arduino_NV3041A::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_NV3041A::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    _currentX = x;
-    _currentW = w;
-    x += _xStart;
-    _bus->writeC8D16D16Split(NV3041A_CASET, x, x + w - 1);
-  }
+  x += _xStart;
+  _bus->writeC8D16D16Split(NV3041A_CASET, x, x + w - 1);
+}
 
-  if ((y != _currentY) || (h != _currentH))
-  {
-    _currentY = y;
-    _currentH = h;
-    y += _yStart;
-    _bus->writeC8D16D16Split(NV3041A_RASET, y, y + h - 1);
-  }
+void Arduino_NV3041A::writeRowAddr(int16_t y, uint16_t h)
+{
+  y += _yStart;
+  _bus->writeC8D16D16Split(NV3041A_RASET, y, y + h - 1);
+}
 
+void Arduino_NV3041A::writeMemoryStart()
+{
   _bus->writeCommand(NV3041A_RAMWR); // write to RAM
 }
 
@@ -43,32 +43,28 @@ void Arduino_OTM8009A::setRotation(uint8_t r)
   _bus->endWrite();
 }
 
-void Arduino_OTM8009A::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_OTM8009A::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    _currentX = x;
-    _currentW = w;
-    _data16.value = x + _xStart;
-    _bus->writeC16D16(OTM8009A_CASET, _data16.msb);
-    _bus->writeC16D16(OTM8009A_CASET + 1, _data16.lsb);
-    _data16.value += w - 1;
-    _bus->writeC16D16(OTM8009A_CASET + 2, _data16.msb);
-    _bus->writeC16D16(OTM8009A_CASET + 3, _data16.lsb);
-  }
+  _data16.value = x + _xStart;
+  _bus->writeC16D16(OTM8009A_CASET, _data16.msb);
+  _bus->writeC16D16(OTM8009A_CASET + 1, _data16.lsb);
+  _data16.value += w - 1;
+  _bus->writeC16D16(OTM8009A_CASET + 2, _data16.msb);
+  _bus->writeC16D16(OTM8009A_CASET + 3, _data16.lsb);
+}
 
-  if ((y != _currentY) || (h != _currentH))
-  {
-    _currentY = y;
-    _currentH = h;
-    _data16.value = y + _yStart;
-    _bus->writeC16D16(OTM8009A_PASET, _data16.msb);
-    _bus->writeC16D16(OTM8009A_PASET + 1, _data16.lsb);
-    _data16.value += h - 1;
-    _bus->writeC16D16(OTM8009A_PASET + 2, _data16.msb);
-    _bus->writeC16D16(OTM8009A_PASET + 3, _data16.lsb);
-  }
+void Arduino_OTM8009A::writeRowAddr(int16_t y, uint16_t h)
+{
+  _data16.value = y + _yStart;
+  _bus->writeC16D16(OTM8009A_PASET, _data16.msb);
+  _bus->writeC16D16(OTM8009A_PASET + 1, _data16.lsb);
+  _data16.value += h - 1;
+  _bus->writeC16D16(OTM8009A_PASET + 2, _data16.msb);
+  _bus->writeC16D16(OTM8009A_PASET + 3, _data16.lsb);
+}
 
+void Arduino_OTM8009A::writeMemoryStart()
+{
   _bus->writeCommand16(OTM8009A_RAMWR); // write to RAM
 }
 
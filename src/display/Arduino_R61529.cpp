@@ -39,23 +39,18 @@ void Arduino_R61529::tftInit()
   _bus->batchOperation(r61529_init_operations, sizeof(r61529_init_operations));
 }
 
-void Arduino_R61529::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_R61529::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    _bus->writeC8D16D16Split(R61529_CASET, x + _xStart, x + w - 1 + _xStart);
-
-    _currentX = x;
-    _currentW = w;
-  }
-  if ((y != _currentY) || (h != _currentH))
-  {
-    _bus->writeC8D16D16Split(R61529_PASET, y + _yStart, y + h - 1 + _yStart);
+  _bus->writeC8D16D16Split(R61529_CASET, x + _xStart, x + w - 1 + _xStart);
+}
 
-    _currentY = y;
-    _currentH = h;
-  }
+void Arduino_R61529::writeRowAddr(int16_t y, uint16_t h)
+{
+  _bus->writeC8D16D16Split(R61529_PASET, y + _yStart, y + h - 1 + _yStart);
+}
 
+void Arduino_R61529::writeMemoryStart()
+{
   _bus->writeCommand(R61529_RAMWR); // write to RAM
 }
 
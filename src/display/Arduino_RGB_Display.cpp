@@ -4,13 +4,19 @@
 #if (ESP_ARDUINO_VERSION_MAJOR < 3)
 
 #include "../Arduino_GFX.h"
+#include "../canvas/Arduino_Canvas_Raster.h"
 #include "Arduino_RGB_Display.h"
 
+static void rgb_display_write_back(uintptr_t addr, uint32_t size)
+{
+  Cache_WriteBack_Addr((uint32_t)addr, size);
+}
+
 Arduino_RGB_Display::Arduino_RGB_Display(
     int16_t w, int16_t h, Arduino_ESP32RGBPanel *rgbpanel, uint8_t r, bool auto_flush,
     Arduino_DataBus *bus, int8_t rst, const uint8_t *init_operations, size_t init_operations_len,
     uint8_t col_offset1, uint8_t row_offset1, uint8_t col_offset2, uint8_t row_offset2)
-    : Arduino_GFX(w, h), _rgbpanel(rgbpanel), _auto_flush(auto_flush),
+    : Arduino_GFX(w, h), _rgbpanel(rgbpanel), _auto_flush(auto_flush), _writeback(rgb_display_write_back),
       _bus(bus), _rst(rst), _init_operations(init_operations), _init_operations_len(init_operations_len),
       COL_OFFSET1(col_offset1), ROW_OFFSET1(row_offset1),
       COL_OFFSET2(col_offset2), ROW_OFFSET2(row_offset2)
@@ -71,52 +77,69 @@ bool Arduino_RGB_Display::begin(int32_t speed)
     return false;
   }
 
+  _double_buffer = _rgbpanel->isDoubleBuffered();
+  if (_auto_flush || _double_buffer)
+  {
+    if (!_writeback.begin(_framebuffer, _fb_width, _fb_height, 2))
+    {
+      return false;
+    }
+  }
+  if (_double_buffer)
+  {
+    if (!_frame_x1)
+    {
+      _frame_x1 = (int16_t *)malloc(_fb_height * 2 * sizeof(int16_t));
+      if (!_frame_x1)
+      {
+        return false;
+      }
+      _frame_x2 = _frame_x1 + _fb_height;
+    }
+    for (int16_t y = 0; y < _fb_height; ++y)
+    {
+      _frame_x1[y] = _fb_width;
+      _frame_x2[y] = -1;
+    }
+    _frame_y1 = _fb_height;
+    _frame_y2 = -1;
+  }
+
   return true;
 }
 
+void Arduino_RGB_Display::endWrite(void)
+{
+  if (_auto_flush)
+  {
+    _writeback.flush();
+  }
+}
+
 void Arduino_RGB_Display::writePixelPreclipped(int16_t x, int16_t y, uint16_t color)
 {
   x += COL_OFFSET1;
   y += ROW_OFFSET1;
-  uint16_t *fb = _framebuffer;
+  int16_t t;
   switch (_rotation)
   {
   case 1:
-    fb += (int32_t)x * _fb_width;
-    fb += _fb_max_x - y;
-    *fb = color;
-    if (_auto_flush)
-    {
-      Cache_WriteBack_Addr((uint32_t)fb, 2);
-    }
+    t = x;
+    x = _fb_max_x - y;
+    y = t;
     break;
   case 2:
-    fb += (int32_t)(_fb_max_y - y) * _fb_width;
-    fb += _fb_max_x - x;
-    *fb = color;
-    if (_auto_flush)
-    {
-      Cache_WriteBack_Addr((uint32_t)fb, 2);
-    }
+    x = _fb_max_x - x;
+    y = _fb_max_y - y;
     break;
   case 3:
-    fb += (int32_t)(_fb_max_y - x) * _fb_width;
-    fb += y;
-    *fb = color;
-    if (_auto_flush)
-    {
-      Cache_WriteBack_Addr((uint32_t)fb, 2);
-    }
+    t = x;
+    x = y;
+    y = _fb_max_y - t;
     break;
-  default: // case 0:
-    fb += (int32_t)y * _fb_width;
-    fb += x;
-    *fb = color;
-    if (_auto_flush)
-    {
-      Cache_WriteBack_Addr((uint32_t)fb, 2);
-    }
   }
+  _framebuffer[(int32_t)y * _fb_width + x] = color;
+  markDirty(x, y, 1, 1);
 }
 
 void Arduino_RGB_Display::writeFastVLine(int16_t x, int16_t y,
@@ -168,24 +191,8 @@ void Arduino_RGB_Display::writeFastVLineCore(int16_t x, int16_t y,
 
         x += COL_OFFSET1;
         y += ROW_OFFSET1;
-        uint16_t *fb = _framebuffer + ((int32_t)y * _fb_width) + x;
-        if (_auto_flush)
-        {
-          while (h--)
-          {
-            *fb = color;
-            Cache_WriteBack_Addr((uint32_t)fb, 2);
-            fb += _fb_width;
-          }
-        }
-        else
-        {
-          while (h--)
-          {
-            *fb = color;
-            fb += _fb_width;
-          }
-        }
+        gfx_format_rgb565::vspan(_framebuffer, _fb_width, x, y, h, color);
+        markDirty(x, y, 1, h);
       }
     }
   }
@@ -240,17 +247,8 @@ void Arduino_RGB_Display::writeFastHLineCore(int16_t x, int16_t y,
 
         x += COL_OFFSET1;
         y += ROW_OFFSET1;
-        uint16_t *fb = _framebuffer + ((int32_t)y * _fb_width) + x;
-        uint32_t cachePos = (uint32_t)fb;
-        int16_t writeSize = w * 2;
-        while (w--)
-        {
-          *(fb++) = color;
-        }
-        if (_auto_flush)
-        {
-          Cache_WriteBack_Addr(cachePos, writeSize);
-        }
+        gfx_format_rgb565::hspan(_framebuffer, _fb_width, x, y, w, color);
+        markDirty(x, y, w, 1);
       }
     }
   }
@@ -288,22 +286,8 @@ void Arduino_RGB_Display::writeFillRectPreclipped(int16_t x, int16_t y,
   // log_i("adjusted writeFillRectPreclipped(x: %d, y: %d, w: %d, h: %d)", x, y, w, h);
   x += COL_OFFSET1;
   y += ROW_OFFSET1;
-  uint16_t *row = _framebuffer;
-  row += y * _fb_width;
-  uint32_t cachePos = (uint32_t)row;
-  row += x;
-  for (int j = 0; j < h; j++)
-  {
-    for (int i = 0; i < w; i++)
-    {
-      row[i] = color;
-    }
-    row += _fb_width;
-  }
-  if (_auto_flush)
-  {
-    Cache_WriteBack_Addr(cachePos, _fb_width * h * 2);
-  }
+  gfx_format_rgb565::rect(_framebuffer, _fb_width, x, y, w, h, color);
+  markDirty(x, y, w, h);
 }
 
 void Arduino_RGB_Display::drawIndexedBitmap(int16_t x, int16_t y, uint8_t *bitmap, uint16_t *color_index, int16_t w, int16_t h, int16_t x_skip)
@@ -352,7 +336,6 @@ void Arduino_RGB_Display::drawIndexedBitmap(int16_t x, int16_t y, uint8_t *bitma
       y += ROW_OFFSET1;
       uint16_t *row = _framebuffer;
       row += y * _fb_width;
-      uint32_t cachePos = (uint32_t)row;
       row += x;
       for (int j = 0; j < h; j++)
       {
@@ -363,9 +346,10 @@ void Arduino_RGB_Display::drawIndexedBitmap(int16_t x, int16_t y, uint8_t *bitma
         bitmap += x_skip;
         row += _fb_width;
       }
+      markDirty(x, y, w, h);
       if (_auto_flush)
       {
-        Cache_WriteBack_Addr(cachePos, _fb_width * h * 2);
+        _writeback.flush();
       }
     }
   }
@@ -411,29 +395,23 @@ void Arduino_RGB_Display::draw16bitRGBBitmap(int16_t x, int16_t y,
 
   if (result)
   {
+    switch (_rotation)
+    {
+    case 1:
+      markDirty(0, x, _fb_width, w);
+      break;
+    case 2:
+      markDirty(0, HEIGHT - y - h, _fb_width, h);
+      break;
+    case 3:
+      markDirty(0, HEIGHT - x - w, _fb_width, w);
+      break;
+    default: // case 0:
+      markDirty(x, y, w, h);
+    }
     if (_auto_flush)
     {
-      uint32_t cachePos;
-      size_t cache_size;
-      switch (_rotation)
-      {
-      case 1:
-        cachePos = (uint32_t)(_framebuffer + (x * _fb_width));
-        cache_size = _fb_width * w * 2;
-        break;
-      case 2:
-        cachePos = (uint32_t)(_framebuffer + ((HEIGHT - y - h) * _fb_width));
-        cache_size = _fb_width * h * 2;
-        break;
-      case 3:
-        cachePos = (uint32_t)(_framebuffer + ((HEIGHT - x - w) * _fb_width));
-        cache_size = _fb_width * w * 2;
-        break;
-      default: // case 0:
-        cachePos = (uint32_t)(_framebuffer + (y * _fb_width) + x);
-        cache_size = (_fb_width * (h - 1) + w) * 2;
-      }
-      Cache_WriteBack_Addr(cachePos, cache_size);
+      _writeback.flush();
     }
   }
 }
@@ -485,7 +463,6 @@ void Arduino_RGB_Display::draw16bitBeRGBBitmap(int16_t x, int16_t y,
       }
       uint16_t *row = _framebuffer;
       row += y * _fb_width;
-      uint32_t cachePos = (uint32_t)row;
       row += x;
       uint16_t color;
       for (int j = 0; j < h; j++)
@@ -498,17 +475,105 @@ void Arduino_RGB_Display::draw16bitBeRGBBitmap(int16_t x, int16_t y,
         bitmap += x_skip;
         row += _fb_width;
       }
+      markDirty(x, y, w, h);
       if (_auto_flush)
       {
-        Cache_WriteBack_Addr(cachePos, _fb_width * h * 2);
+        _writeback.flush();
       }
     }
   }
 }
 
+// Records the changed column range of every row drawn into the back buffer,
+// to be copied forward after the swap. Area in framebuffer pixels.
+void Arduino_RGB_Display::markFrame(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  if (x < 0)
+  {
+    w += x;
+    x = 0;
+  }
+  if (y < 0)
+  {
+    h += y;
+    y = 0;
+  }
+  if ((x + w) > _fb_width)
+  {
+    w = _fb_width - x;
+  }
+  if ((y + h) > _fb_height)
+  {
+    h = _fb_height - y;
+  }
+  if ((w <= 0) || (h <= 0))
+  {
+    return;
+  }
+
+  int16_t x2 = x + w - 1;
+  int16_t y2 = y + h - 1;
+  for (int16_t j = y; j <= y2; ++j)
+  {
+    if (x < _frame_x1[j])
+    {
+      _frame_x1[j] = x;
+    }
+    if (x2 > _frame_x2[j])
+    {
+      _frame_x2[j] = x2;
+    }
+  }
+  if (y < _frame_y1)
+  {
+    _frame_y1 = y;
+  }
+  if (y2 > _frame_y2)
+  {
+    _frame_y2 = y2;
+  }
+}
+
 void Arduino_RGB_Display::flush(void)
 {
-  if (!_auto_flush)
+  if (_fb_handed_out)
+  {
+    // writes straight into the framebuffer are not tracked, any row may
+    // have changed
+    markDirty(0, 0, _fb_width, _fb_height);
+  }
+
+  if (_double_buffer)
+  {
+    // the back buffer must be in PSRAM before the DMA reads it
+    _writeback.flush();
+    uint16_t *front = _framebuffer;
+    _framebuffer = _rgbpanel->swapFrameBuffer();
+    _writeback.setFramebuffer(_framebuffer);
+
+    // The new back buffer holds the frame before the one just swapped in,
+    // copy the rows changed since forward so partial redraws stay valid.
+    for (int16_t y = _frame_y1; y <= _frame_y2; ++y)
+    {
+      int16_t x1 = _frame_x1[y];
+      int16_t x2 = _frame_x2[y];
+      if (x1 <= x2)
+      {
+        int32_t offset = (int32_t)y * _fb_width + x1;
+        memcpy(_framebuffer + offset, front + offset, (x2 - x1 + 1) * 2);
+        _writeback.mark(x1, y, x2 - x1 + 1, 1);
+        _frame_x1[y] = _fb_width;
+        _frame_x2[y] = -1;
+      }
+    }
+    _frame_y1 = _fb_height;
+    _frame_y2 = -1;
+  }
+  else if (_auto_flush)
+  {
+    _writeback.flush();
+  }
+  else
   {
     Cache_WriteBack_Addr((uint32_t)_framebuffer, _framebuffer_size);
   }
@@ -516,6 +581,7 @@ void Arduino_RGB_Display::flush(void)
 
 uint16_t *Arduino_RGB_Display::getFramebuffer()
 {
+  _fb_handed_out = true;
   return _framebuffer;
 }
 
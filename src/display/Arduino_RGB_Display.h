@@ -7,6 +7,7 @@
 #define _ARDUINO_RGB_DISPLAY_H_
 
 #include "../Arduino_GFX.h"
+#include "../Arduino_GFX_WriteBack.h"
 #include "../databus/Arduino_ESP32RGBPanel.h"
 
 static const uint8_t gc9503v_type1_init_operations[] = {
@@ -2268,6 +2269,7 @@ public:
       uint8_t col_offset1 = 0, uint8_t row_offset1 = 0, uint8_t col_offset2 = 0, uint8_t row_offset2 = 0);
 
   bool begin(int32_t speed = GFX_NOT_DEFINED) override;
+  void endWrite(void) override;
   void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override;
   void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
   void writeFastVLineCore(int16_t x, int16_t y, int16_t h, uint16_t color);
@@ -2277,15 +2279,41 @@ public:
   void drawIndexedBitmap(int16_t x, int16_t y, uint8_t *bitmap, uint16_t *color_index, int16_t w, int16_t h, int16_t x_skip = 0) override;
   void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) override;
   void draw16bitBeRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) override;
+  // with a double buffered panel: presents the back buffer at the next vsync
   void flush(void) override;
 
+  // The buffer drawn into, the back buffer with a double buffered panel.
+  // flush() then swaps it for the other buffer, so get it again after every
+  // flush(). Writes straight into it are not tracked: once it was handed
+  // out, flush() writes back (and with double buffering copies forward) the
+  // whole frame.
   uint16_t *getFramebuffer();
 
 protected:
+  // x, y, w, h in framebuffer pixels
+  GFX_INLINE void markDirty(int16_t x, int16_t y, int16_t w, int16_t h)
+  {
+    if (_auto_flush || _double_buffer)
+    {
+      _writeback.mark(x, y, w, h);
+    }
+    if (_double_buffer)
+    {
+      markFrame(x, y, w, h);
+    }
+  }
+  void markFrame(int16_t x, int16_t y, int16_t w, int16_t h);
+
   uint16_t *_framebuffer;
   size_t _framebuffer_size;
   Arduino_ESP32RGBPanel *_rgbpanel;
   bool _auto_flush;
+  Arduino_GFX_WriteBack _writeback; // pending cache write-back with auto_flush or double buffering
+  bool _double_buffer = false;
+  bool _fb_handed_out = false; // getFramebuffer() was called
+  int16_t *_frame_x1 = nullptr; // changed column range of every row since the last swap
+  int16_t *_frame_x2 = nullptr;
+  int16_t _frame_y1, _frame_y2;
   Arduino_DataBus *_bus;
   int8_t _rst;
   const uint8_t *_init_operations;
@@ -4,6 +4,8 @@
 Arduino_RM67162::Arduino_RM67162(Arduino_DataBus *bus, int8_t rst, uint8_t r, bool ips)
     : Arduino_TFT(bus, rst, r, ips, RM67162_TFTWIDTH, RM67162_TFTHEIGHT, 0, 0, 0, 0)
 {
+  // partial updates need even window start and end + 1
+  _addr_align = 2;
 }
 
 bool Arduino_RM67162::begin(int32_t speed)
@@ -40,24 +42,20 @@ void Arduino_RM67162::setRotation(uint8_t r)
   _bus->endWrite();
 }
 
-void Arduino_RM67162::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_RM67162::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    _currentX = x;
-    _currentW = w;
-    x += _xStart;
-    _bus->writeC8D16D16(RM67162_CASET, x, x + w - 1);
-  }
+  x += _xStart;
+  _bus->writeC8D16D16(RM67162_CASET, x, x + w - 1);
+}
 
-  if ((y != _currentY) || (h != _currentH))
-  {
-    _currentY = y;
-    _currentH = h;
-    y += _yStart;
-    _bus->writeC8D16D16(RM67162_PASET, y, y + h - 1);
-  }
+void Arduino_RM67162::writeRowAddr(int16_t y, uint16_t h)
+{
+  y += _yStart;
+  _bus->writeC8D16D16(RM67162_PASET, y, y + h - 1);
+}
 
+void Arduino_RM67162::writeMemoryStart()
+{
   _bus->writeCommand(RM67162_RAMWR); // write to RAM
 }
 
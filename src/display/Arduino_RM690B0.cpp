@@ -7,6 +7,8 @@ Arduino_RM690B0::Arduino_RM690B0(
     uint8_t col_offset1, uint8_t row_offset1, uint8_t col_offset2, uint8_t row_offset2)
     : Arduino_TFT(bus, rst, r, false, w, h, col_offset1, row_offset1, col_offset2, row_offset2)
 {
+  // partial updates need even window start and end + 1
+  _addr_align = 2;
 }
 
 bool Arduino_RM690B0::begin(int32_t speed)
@@ -43,24 +45,20 @@ void Arduino_RM690B0::setRotation(uint8_t r)
   _bus->endWrite();
 }
 
-void Arduino_RM690B0::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_RM690B0::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    _currentX = x;
-    _currentW = w;
-    x += _xStart;
-    _bus->writeC8D16D16(RM690B0_CASET, x, x + w - 1);
-  }
+  x += _xStart;
+  _bus->writeC8D16D16(RM690B0_CASET, x, x + w - 1);
+}
 
-  if ((y != _currentY) || (h != _currentH))
-  {
-    _currentY = y;
-    _currentH = h;
-    y += _yStart;
-    _bus->writeC8D16D16(RM690B0_PASET, y, y + h - 1);
-  }
+void Arduino_RM690B0::writeRowAddr(int16_t y, uint16_t h)
+{
+  y += _yStart;
+  _bus->writeC8D16D16(RM690B0_PASET, y, y + h - 1);
+}
 
+void Arduino_RM690B0::writeMemoryStart()
+{
   _bus->writeCommand(RM690B0_RAMWR); // write to RAM
 }
 
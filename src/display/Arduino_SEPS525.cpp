@@ -104,60 +104,56 @@ void Arduino_SEPS525::tftInit()
   _bus->sendData(0x01);
 }
 
-void Arduino_SEPS525::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_SEPS525::writeColumnAddr(int16_t x, uint16_t w)
 {
   uint8_t cmd1, cmd2, cmd3;
-  if ((x != _currentX) || (w != _currentW))
+  int16_t x_start = x + _xStart, x_end = x + w - 1 + _xStart;
+  if (_rotation & 0x01) // Portrait
   {
-    int16_t x_start = x + _xStart, x_end = x + w - 1 + _xStart;
-    if (_rotation & 0x01) // Portrait
-    {
-      cmd1 = SEPS525_MY1_ADDR;
-      cmd2 = SEPS525_M_AP_Y;
-      cmd3 = SEPS525_MY2_ADDR;
-    }
-    else
-    {
-      cmd1 = SEPS525_MX1_ADDR;
-      cmd2 = SEPS525_M_AP_X;
-      cmd3 = SEPS525_MX2_ADDR;
-    }
-    _bus->writeCommand(cmd1);
-    _bus->write16(x_start);
-    _bus->writeCommand(cmd2);
-    _bus->write16(x_start);
-    _bus->writeCommand(cmd3);
-    _bus->write16(x_end);
-
-    _currentX = x;
-    _currentW = w;
+    cmd1 = SEPS525_MY1_ADDR;
+    cmd2 = SEPS525_M_AP_Y;
+    cmd3 = SEPS525_MY2_ADDR;
   }
-  if ((y != _currentY) || (h != _currentH))
+  else
+  {
+    cmd1 = SEPS525_MX1_ADDR;
+    cmd2 = SEPS525_M_AP_X;
+    cmd3 = SEPS525_MX2_ADDR;
+  }
+  _bus->writeCommand(cmd1);
+  _bus->write16(x_start);
+  _bus->writeCommand(cmd2);
+  _bus->write16(x_start);
+  _bus->writeCommand(cmd3);
+  _bus->write16(x_end);
+}
+
+void Arduino_SEPS525::writeRowAddr(int16_t y, uint16_t h)
+{
+  uint8_t cmd1, cmd2, cmd3;
+  int16_t y_start = y + _yStart, y_end = y + h - 1 + _yStart;
+  if (_rotation & 0x01) // Portrait
+  {
+    cmd1 = SEPS525_MX1_ADDR;
+    cmd2 = SEPS525_M_AP_X;
+    cmd3 = SEPS525_MX2_ADDR;
+  }
+  else
   {
-    int16_t y_start = y + _yStart, y_end = y + h - 1 + _yStart;
-    if (_rotation & 0x01) // Portrait
-    {
-      cmd1 = SEPS525_MX1_ADDR;
-      cmd2 = SEPS525_M_AP_X;
-      cmd3 = SEPS525_MX2_ADDR;
-    }
-    else
-    {
-      cmd1 = SEPS525_MY1_ADDR;
-      cmd2 = SEPS525_M_AP_Y;
-      cmd3 = SEPS525_MY2_ADDR;
-    }
-    _bus->writeCommand(cmd1);
-    _bus->write16(y_start);
-    _bus->writeCommand(cmd2);
-    _bus->write16(y_start);
-    _bus->writeCommand(cmd3);
-    _bus->write16(y_end);
-
-    _currentY = y;
-    _currentH = h;
+    cmd1 = SEPS525_MY1_ADDR;
+    cmd2 = SEPS525_M_AP_Y;
+    cmd3 = SEPS525_MY2_ADDR;
   }
+  _bus->writeCommand(cmd1);
+  _bus->write16(y_start);
+  _bus->writeCommand(cmd2);
+  _bus->write16(y_start);
+  _bus->writeCommand(cmd3);
+  _bus->write16(y_end);
+}
 
+void Arduino_SEPS525::writeMemoryStart()
+{
   _bus->writeCommand(SEPS525_RAMWR); // write to RAM
 }
 
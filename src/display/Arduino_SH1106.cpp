@@ -129,10 +129,13 @@ void Arduino_SH1106::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w
 {
   // printf("SH1106::drawBitmap %d/%d w:%d h:%d\n", x, y, w, h);
 
-  // transfer the whole bitmap
-  for (uint8_t p = (y / 8); p < (h / 8); p++)
+  // transfer the bitmap page by page, starting at page y / 8 and column x
+  uint8_t col = 2 + x; // the SH1106 RAM is 132 columns wide, the panel shows 2..129
+  uint8_t pages = (h + 7) / 8;
+  for (uint8_t i = 0; i < pages; i++)
   {
-    uint8_t *pptr = bitmap + (p * w); // page start pointer
+    uint8_t p = (y / 8) + i;
+    uint8_t *pptr = bitmap + (i * w); // page start pointer
 
     // start page sequence
     _bus->beginWrite();
@@ -142,8 +145,8 @@ void Arduino_SH1106::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w
 
     uint8_t page_sequence[] = {
         (uint8_t)(SH110X_SETPAGEADDR + p),
-        SH110X_SETLOWCOLUMN + 2,
-        SH110X_SETHIGHCOLUMN + 0};
+        (uint8_t)(SH110X_SETLOWCOLUMN + (col & 0x0F)),
+        (uint8_t)(SH110X_SETHIGHCOLUMN + (col >> 4))};
     _bus->writeCommandBytes(page_sequence, sizeof(page_sequence));
     _bus->endWrite();
 
@@ -108,6 +108,8 @@ void Arduino_SSD1283A::tftInit()
 
 void Arduino_SSD1283A::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
 {
+  flushPixelRun();
+
   uint8_t v1 = 0, v2 = 0, v3 = 0, h1 = 0, h2 = 0, h3 = 0;
 
   // TODO: it works, but should have better way
@@ -134,11 +134,12 @@ void Arduino_SSD1306::drawBitmap(int16_t xStart, int16_t yStart, uint8_t *bitmap
   Serial.println();
 #endif
 
-  // start page sequence
+  // start page sequence, the window covers only the pages and columns given
+  // so a partial update sends just its own bytes
   _bus->beginWrite();
   uint8_t page_sequence[] = {
-      SSD1306_PAGEADDR, 0, 0xFF,
-      SSD1306_COLUMNADDR, _colStart, _colEnd};
+      SSD1306_PAGEADDR, (uint8_t)(yStart / 8), (uint8_t)((yStart + h - 1) / 8),
+      SSD1306_COLUMNADDR, (uint8_t)(_colStart + xStart), (uint8_t)(_colStart + xStart + w - 1)};
   _bus->writeCommandBytes(page_sequence, sizeof(page_sequence));
   _bus->endWrite();
 
@@ -74,32 +74,24 @@ void Arduino_SSD1331::tftInit()
   _bus->sendCommand(SSD1331_DISPLAYON); //--turn on oled panel
 }
 
-void Arduino_SSD1331::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_SSD1331::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    uint8_t cmd = (_rotation & 0x01) ? SSD1331_SETROW : SSD1331_SETCOLUMN;
-    uint8_t x_start = x + _xStart, x_end = x + w - 1 + _xStart;
-
-    _bus->writeCommand(cmd);     // Column addr set
-    _bus->writeCommand(x_start); // XSTART
-    _bus->writeCommand(x_end);   // XEND
+  uint8_t cmd = (_rotation & 0x01) ? SSD1331_SETROW : SSD1331_SETCOLUMN;
+  uint8_t x_start = x + _xStart, x_end = x + w - 1 + _xStart;
 
-    _currentX = x;
-    _currentW = w;
-  }
-  if ((y != _currentY) || (h != _currentH))
-  {
-    uint8_t cmd = (_rotation & 0x01) ? SSD1331_SETCOLUMN : SSD1331_SETROW;
-    uint8_t y_start = y + _yStart, y_end = y + h - 1 + _yStart;
+  _bus->writeCommand(cmd);     // Column addr set
+  _bus->writeCommand(x_start); // XSTART
+  _bus->writeCommand(x_end);   // XEND
+}
 
-    _bus->writeCommand(cmd);     // Row addr set
-    _bus->writeCommand(y_start); // YSTART
-    _bus->writeCommand(y_end);   // YEND
+void Arduino_SSD1331::writeRowAddr(int16_t y, uint16_t h)
+{
+  uint8_t cmd = (_rotation & 0x01) ? SSD1331_SETCOLUMN : SSD1331_SETROW;
+  uint8_t y_start = y + _yStart, y_end = y + h - 1 + _yStart;
 
-    _currentY = y;
-    _currentH = h;
-  }
+  _bus->writeCommand(cmd);     // Row addr set
+  _bus->writeCommand(y_start); // YSTART
+  _bus->writeCommand(y_end);   // YEND
 }
 
 /**************************************************************************/
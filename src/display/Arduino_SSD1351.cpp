@@ -62,34 +62,28 @@ void Arduino_SSD1351::tftInit()
   _bus->sendCommand(SSD1351_DISPLAYON);     // Main screen turn on
 }
 
-void Arduino_SSD1351::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_SSD1351::writeColumnAddr(int16_t x, uint16_t w)
 {
-  uint8_t cmd;
-  if ((x != _currentX) || (w != _currentW))
-  {
-    cmd = (_rotation & 0x01) ? SSD1351_SETROW : SSD1351_SETCOLUMN;
-    uint8_t x_start = x + _xStart, x_end = x + w - 1 + _xStart;
-
-    _bus->writeCommand(cmd); // Column addr set
-    _bus->write(x_start);    // XSTART
-    _bus->write(x_end);      // XEND
+  uint8_t cmd = (_rotation & 0x01) ? SSD1351_SETROW : SSD1351_SETCOLUMN;
+  uint8_t x_start = x + _xStart, x_end = x + w - 1 + _xStart;
 
-    _currentX = x;
-    _currentW = w;
-  }
-  if ((y != _currentY) || (h != _currentH))
-  {
-    cmd = (_rotation & 0x01) ? SSD1351_SETCOLUMN : SSD1351_SETROW;
-    uint8_t y_start = y + _yStart, y_end = y + h - 1 + _yStart;
+  _bus->writeCommand(cmd); // Column addr set
+  _bus->write(x_start);    // XSTART
+  _bus->write(x_end);      // XEND
+}
 
-    _bus->writeCommand(cmd); // Row addr set
-    _bus->write(y_start);    // YSTART
-    _bus->write(y_end);      // YEND
+void Arduino_SSD1351::writeRowAddr(int16_t y, uint16_t h)
+{
+  uint8_t cmd = (_rotation & 0x01) ? SSD1351_SETCOLUMN : SSD1351_SETROW;
+  uint8_t y_start = y + _yStart, y_end = y + h - 1 + _yStart;
 
-    _currentY = y;
-    _currentH = h;
-  }
+  _bus->writeCommand(cmd); // Row addr set
+  _bus->write(y_start);    // YSTART
+  _bus->write(y_end);      // YEND
+}
 
+void Arduino_SSD1351::writeMemoryStart()
+{
   _bus->writeCommand(SSD1351_WRITERAM); // write to RAM
 }
 
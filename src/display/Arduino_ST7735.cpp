@@ -59,36 +59,56 @@ void Arduino_ST7735::tftInit()
   invertDisplay(false);
 }
 
-void Arduino_ST7735::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_ST7735::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    int16_t x_start = x + _xStart, x_end = x + w - 1 + _xStart;
+  int16_t x_start = x + _xStart, x_end = x + w - 1 + _xStart;
 
-    _bus->writeCommand(ST7735_CASET); // Column addr set
-    _bus->write(x_start >> 8);
-    _bus->write(x_start & 0xFF); // XSTART
-    _bus->write(x_end >> 8);
-    _bus->write(x_end & 0xFF); // XEND
+  _bus->writeCommand(ST7735_CASET); // Column addr set
+  _bus->write(x_start >> 8);
+  _bus->write(x_start & 0xFF); // XSTART
+  _bus->write(x_end >> 8);
+  _bus->write(x_end & 0xFF); // XEND
+}
 
-    _currentX = x;
-    _currentW = w;
-  }
-  if ((y != _currentY) || (h != _currentH))
-  {
-    int16_t y_start = y + _yStart, y_end = y + h - 1 + _yStart;
+void Arduino_ST7735::writeRowAddr(int16_t y, uint16_t h)
+{
+  int16_t y_start = y + _yStart, y_end = y + h - 1 + _yStart;
 
-    _bus->writeCommand(ST7735_RASET); // Row addr set
-    _bus->write(y_start >> 8);
-    _bus->write(y_start & 0xFF); // YSTART
-    _bus->write(y_end >> 8);
-    _bus->write(y_end & 0xFF); // YEND
+  _bus->writeCommand(ST7735_RASET); // Row addr set
+  _bus->write(y_start >> 8);
+  _bus->write(y_start & 0xFF); // YSTART
+  _bus->write(y_end >> 8);
+  _bus->write(y_end & 0xFF); // YEND
+}
 
-    _currentY = y;
-    _currentH = h;
+void Arduino_ST7735::writeMemoryStart()
+{
+  _bus->writeCommand(ST7735_RAMWR); // write to RAM
+}
+
+bool Arduino_ST7735::writeScrollArea(uint16_t top_fixed, uint16_t rows)
+{
+  if ((top_fixed + rows) > ST7735_GRAMHEIGHT)
+  {
+    return false;
   }
+  uint16_t bottom_fixed = ST7735_GRAMHEIGHT - top_fixed - rows;
+
+  _bus->writeCommand(ST7735_VSCRDEF);
+  _bus->write(top_fixed >> 8);
+  _bus->write(top_fixed & 0xFF); // TFA
+  _bus->write(rows >> 8);
+  _bus->write(rows & 0xFF); // VSA
+  _bus->write(bottom_fixed >> 8);
+  _bus->write(bottom_fixed & 0xFF); // BFA
+  return true;
+}
 
-  _bus->writeCommand(ST7735_RAMWR); // write to RAM
+void Arduino_ST7735::writeScrollStart(uint16_t row)
+{
+  _bus->writeCommand(ST7735_VSCRSADD);
+  _bus->write(row >> 8);
+  _bus->write(row & 0xFF); // VSP
 }
 
 /**************************************************************************/
@@ -36,8 +36,11 @@
 #define ST7735_RAMRD 0x2E
 
 #define ST7735_PTLAR 0x30
+#define ST7735_VSCRDEF 0x33
 #define ST7735_COLMOD 0x3A
 #define ST7735_MADCTL 0x36
+#define ST7735_VSCRSADD 0x37
+#define ST7735_GRAMHEIGHT 162 ///< frame memory rows, the scroll area is set in these
 
 #define ST7735_FRMCTR1 0xB1
 #define ST7735_FRMCTR2 0xB2
@@ -117,13 +120,17 @@ public:
       bool bgr = true);
 
   bool begin(int32_t speed = GFX_NOT_DEFINED) override;
-  void writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h) override;
   void setRotation(uint8_t r) override;
   void invertDisplay(bool) override;
   void displayOn() override;
   void displayOff() override;
 
 protected:
+  void writeColumnAddr(int16_t x, uint16_t w) override;
+  void writeRowAddr(int16_t y, uint16_t h) override;
+  void writeMemoryStart() override;
+  bool writeScrollArea(uint16_t top_fixed, uint16_t rows) override;
+  void writeScrollStart(uint16_t row) override;
   void tftInit() override;
   bool _bgr;
 
@@ -54,25 +54,40 @@ void Arduino_ST7789::setRotation(uint8_t r)
   _bus->endWrite();
 }
 
-void Arduino_ST7789::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_ST7789::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    _currentX = x;
-    _currentW = w;
-    x += _xStart;
-    _bus->writeC8D16D16(ST7789_CASET, x, x + w - 1);
-  }
+  x += _xStart;
+  _bus->writeC8D16D16(ST7789_CASET, x, x + w - 1);
+}
+
+void Arduino_ST7789::writeRowAddr(int16_t y, uint16_t h)
+{
+  y += _yStart;
+  _bus->writeC8D16D16(ST7789_RASET, y, y + h - 1);
+}
 
-  if ((y != _currentY) || (h != _currentH))
+void Arduino_ST7789::writeMemoryStart()
+{
+  _bus->writeCommand(ST7789_RAMWR); // write to RAM
+}
+
+bool Arduino_ST7789::writeScrollArea(uint16_t top_fixed, uint16_t rows)
+{
+  if ((top_fixed + rows) > ST7789_TFTHEIGHT)
   {
-    _currentY = y;
-    _currentH = h;
-    y += _yStart;
-    _bus->writeC8D16D16(ST7789_RASET, y, y + h - 1);
+    return false;
   }
+  _bus->writeCommand(ST7789_VSCRDEF);
+  _bus->write16(top_fixed);
+  _bus->write16(rows);
+  _bus->write16(ST7789_TFTHEIGHT - top_fixed - rows); // bottom fixed rows
+  return true;
+}
 
-  _bus->writeCommand(ST7789_RAMWR); // write to RAM
+void Arduino_ST7789::writeScrollStart(uint16_t row)
+{
+  _bus->writeCommand(ST7789_VSCRSADD);
+  _bus->write16(row);
 }
 
 void Arduino_ST7789::invertDisplay(bool i)
@@ -80,6 +95,20 @@ void Arduino_ST7789::invertDisplay(bool i)
   _bus->sendCommand((_ips ^ i) ? ST7789_INVON : ST7789_INVOFF);
 }
 
+void Arduino_ST7789::tearingEffect(bool enable)
+{
+  if (enable)
+  {
+    _bus->beginWrite();
+    _bus->writeC8D8(ST7789_TEON, 0x00); // V-blanking only
+    _bus->endWrite();
+  }
+  else
+  {
+    _bus->sendCommand(ST7789_TEOFF);
+  }
+}
+
 void Arduino_ST7789::displayOn(void)
 {
   _bus->sendCommand(ST7789_SLPOUT);
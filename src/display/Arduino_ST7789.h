@@ -37,8 +37,12 @@
 #define ST7789_RAMRD 0x2E
 
 #define ST7789_PTLAR 0x30
+#define ST7789_VSCRDEF 0x33
+#define ST7789_TEOFF 0x34
+#define ST7789_TEON 0x35
 #define ST7789_COLMOD 0x3A
 #define ST7789_MADCTL 0x36
+#define ST7789_VSCRSADD 0x37
 
 #define ST7789_MADCTL_MY 0x80
 #define ST7789_MADCTL_MX 0x40
@@ -131,13 +135,19 @@ public:
 
   void setRotation(uint8_t r) override;
 
-  void writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h) override;
-
   void invertDisplay(bool) override;
   void displayOn() override;
   void displayOff() override;
 
+  // TE output at the start of every vertical blanking, for Arduino_GFX_TESync
+  void tearingEffect(bool enable);
+
 protected:
+  void writeColumnAddr(int16_t x, uint16_t w) override;
+  void writeRowAddr(int16_t y, uint16_t h) override;
+  void writeMemoryStart() override;
+  bool writeScrollArea(uint16_t top_fixed, uint16_t rows) override;
+  void writeScrollStart(uint16_t row) override;
   void tftInit() override;
 
 private:
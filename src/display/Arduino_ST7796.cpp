@@ -46,24 +46,20 @@ void Arduino_ST7796::setRotation(uint8_t r)
   _bus->endWrite();
 }
 
-void Arduino_ST7796::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_ST7796::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    _currentX = x;
-    _currentW = w;
-    x += _xStart;
-    _bus->writeC8D16D16(ST7796_CASET, x, x + w - 1);
-  }
+  x += _xStart;
+  _bus->writeC8D16D16(ST7796_CASET, x, x + w - 1);
+}
 
-  if ((y != _currentY) || (h != _currentH))
-  {
-    _currentY = y;
-    _currentH = h;
-    y += _yStart;
-    _bus->writeC8D16D16(ST7796_RASET, y, y + h - 1);
-  }
+void Arduino_ST7796::writeRowAddr(int16_t y, uint16_t h)
+{
+  y += _yStart;
+  _bus->writeC8D16D16(ST7796_RASET, y, y + h - 1);
+}
 
+void Arduino_ST7796::writeMemoryStart()
+{
   _bus->writeCommand(ST7796_RAMWR); // write to RAM
 }
 
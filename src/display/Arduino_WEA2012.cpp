@@ -29,24 +29,20 @@ void Arduino_WEA2012::setRotation(uint8_t r)
   // not implemented
 }
 
-void Arduino_WEA2012::writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+void Arduino_WEA2012::writeColumnAddr(int16_t x, uint16_t w)
 {
-  if ((x != _currentX) || (w != _currentW))
-  {
-    _currentX = x;
-    _currentW = w;
-    x += _xStart;
-    _bus->writeC8D16D16(WEA2012_CASET, x, x + w - 1);
-  }
+  x += _xStart;
+  _bus->writeC8D16D16(WEA2012_CASET, x, x + w - 1);
+}
 
-  if ((y != _currentY) || (h != _currentH))
-  {
-    _currentY = y;
-    _currentH = h;
-    y += _yStart;
-    _bus->writeC8D16D16(WEA2012_PASET, y, y + h - 1);
-  }
+void Arduino_WEA2012::writeRowAddr(int16_t y, uint16_t h)
+{
+  y += _yStart;
+  _bus->writeC8D16D16(WEA2012_PASET, y, y + h - 1);
+}
 
+void Arduino_WEA2012::writeMemoryStart()
+{
   _bus->writeCommand(WEA2012_RAMWR); // write to RAM
 }
 